@@ -0,0 +1,74 @@
+/**
+ * @file AlignedAllocator.h
+ * @brief The specification file for a Cache Line Aligned Allocator (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_ALIGNEDALLOCATOR_H
+#define REISER_RT_ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Alignment Used for Kernel Buffers
+         *
+         * A cache line, which also satisfies the widest vector load we compile kernels for.
+         */
+        constexpr size_t kernelBufferAlignment = 64;
+
+        /**
+         * @brief Aligned Allocator
+         *
+         * A minimal standard allocator delivering storage aligned to `kernelBufferAlignment`.
+         * It relies on the C++17 aligned forms of `operator new` and `operator delete`.
+         *
+         * @tparam T The value type allocated.
+         */
+        template < typename T >
+        class AlignedAllocator
+        {
+        public:
+            using value_type = T;
+
+            AlignedAllocator() noexcept = default;
+
+            template < typename U >
+            explicit AlignedAllocator( const AlignedAllocator< U > & ) noexcept {}
+
+            T * allocate( size_t n )
+            {
+                return static_cast< T * >( ::operator new( n * sizeof( T ), std::align_val_t{ kernelBufferAlignment } ) );
+            }
+
+            void deallocate( T * p, size_t ) noexcept
+            {
+                ::operator delete( p, std::align_val_t{ kernelBufferAlignment } );
+            }
+
+            template < typename U >
+            bool operator ==( const AlignedAllocator< U > & ) const noexcept { return true; }
+
+            template < typename U >
+            bool operator !=( const AlignedAllocator< U > & ) const noexcept { return false; }
+        };
+
+        /**
+         * @brief A Standard Vector of Aligned Scalars
+         */
+        using AlignedScalarVector = std::vector< double, AlignedAllocator< double > >;
+
+        /**
+         * @brief A Standard Vector of Aligned Single Precision Scalars
+         */
+        using AlignedSingleVector = std::vector< float, AlignedAllocator< float > >;
+    }
+}
+
+#endif //REISER_RT_ALIGNEDALLOCATOR_H
@@ -0,0 +1,197 @@
+/**
+ * @file ClosedFormEngine.cpp
+ * @brief The implementation file for the Closed Form Geometric Series Engine
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "ClosedFormEngine.h"
+#include "PhaseArithmetic.h"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    /**
+     * @brief The Number of Samples Between Analytic Re-anchoring of the Phasors
+     */
+    constexpr size_t anchorInterval = 1024;
+
+    /**
+     * @brief The Squared Magnitude of (1 - z) Below Which the Dirichlet Form is Used
+     *
+     * The direct ratio loses roughly log10( 1 / |1 - z| ) digits. Below |1 - z| = 1e-3, we lose
+     * no more than three digits with the direct ratio and switch to the Dirichlet form.
+     */
+    constexpr double singularityGuard = 1e-6;
+
+    /**
+     * @brief The Tolerance for Linear Phase Detection, in Radians
+     */
+    constexpr double linearPhaseTolerance = 1e-12;
+}
+
+bool ClosedFormEngine::accepts( size_t numHarmonics, const double * pMag, const double * pPhase )
+{
+    if ( pMag )
+    {
+        for ( size_t i = 1; i < numHarmonics; ++i )
+            if ( pMag[i] != pMag[0] ) return false;
+    }
+
+    if ( pPhase && 2 < numHarmonics )
+    {
+        const auto delta = PhaseArithmetic::wrap( pPhase[1] - pPhase[0] );
+        for ( size_t i = 2; i < numHarmonics; ++i )
+        {
+            const auto expected = pPhase[0] + double( i ) * delta;
+            if ( linearPhaseTolerance < std::abs( PhaseArithmetic::wrap( pPhase[i] - expected ) ) )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void ClosedFormEngine::reset( size_t numHarmonics, double fundamentalRadiansPerSample,
+                              const double * pMag, const double * pPhase )
+{
+    if ( !accepts( numHarmonics, pMag, pPhase ) )
+        throw std::invalid_argument{ "The harmonic series does not form a geometric series!" };
+
+    const auto mag = ( pMag && numHarmonics ) ? pMag[0] : 1.0;
+    const auto a = ( pPhase && numHarmonics ) ? pPhase[0] : 0.0;
+    const auto d = ( pPhase && 1 < numHarmonics ) ? PhaseArithmetic::wrap( pPhase[1] - pPhase[0] ) : 0.0;
+
+    numTones = double( numHarmonics );
+    thetaPhase = d;
+    thetaRate = fundamentalRadiansPerSample;
+    scaleReal = mag * std::cos( a - d );
+    scaleImag = mag * std::sin( a - d );
+    zRateReal = std::cos( thetaRate );
+    zRateImag = std::sin( thetaRate );
+    zNRateReal = std::cos( numTones * thetaRate );
+    zNRateImag = std::sin( numTones * thetaRate );
+    sampleCount = 0;
+    anchor();
+}
+
+void ClosedFormEngine::reset()
+{
+    numTones = 0.0;
+    thetaPhase = thetaRate = 0.0;
+    scaleReal = scaleImag = 0.0;
+    zRateReal = zNRateReal = 1.0;
+    zRateImag = zNRateImag = 0.0;
+    sampleCount = 0;
+    anchor();
+}
+
+void ClosedFormEngine::anchor()
+{
+    // The angle of z^N is derived from the wrapped angle of z rather than from a rate of N times the fundamental.
+    // The rounding of such a rate would otherwise be scaled by the sample count.
+    const auto theta = PhaseArithmetic::phaseAt( thetaPhase, thetaRate, sampleCount );
+    const auto thetaN = PhaseArithmetic::wrap( numTones * theta );
+    zReal = std::cos( theta );
+    zImag = std::sin( theta );
+    zNReal = std::cos( thetaN );
+    zNImag = std::sin( thetaN );
+}
+
+void ClosedFormEngine::synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   const HarmonicEnvelope & /*envelope*/, bool accumulate )
+{
+    // Complex values are layout compatible with an array of two scalars.
+    auto pOut = reinterpret_cast< double * >( pElementBuffer );
+
+    while ( numSamples )
+    {
+        // Run to the next anchor point, or the end of the buffer.
+        const auto toAnchor = anchorInterval - sampleCount % anchorInterval;
+        const auto runLen = numSamples < toAnchor ? numSamples : toAnchor;
+
+        for ( size_t n = 0; runLen != n; ++n )
+        {
+            // Sum of z^k for k = 1 to N.
+            double sumReal;
+            double sumImag;
+            const auto denReal = 1.0 - zReal;
+            const auto denImag = -zImag;
+            const auto denNorm = denReal * denReal + denImag * denImag;
+            if ( singularityGuard < denNorm )
+            {
+                // z * ( 1 - z^N ) / ( 1 - z )
+                const auto oneLessReal = 1.0 - zNReal;
+                const auto oneLessImag = -zNImag;
+                const auto numReal = zReal * oneLessReal - zImag * oneLessImag;
+                const auto numImag = zReal * oneLessImag + zImag * oneLessReal;
+                sumReal = ( numReal * denReal + numImag * denImag ) / denNorm;
+                sumImag = ( numImag * denReal - numReal * denImag ) / denNorm;
+            }
+            else
+            {
+                // Dirichlet kernel: e^(j theta (N+1)/2) sin( N theta / 2 ) / sin( theta / 2 ), N at theta = 0.
+                const auto theta = std::atan2( zImag, zReal );
+                const auto halfSine = std::sin( 0.5 * theta );
+                const auto ratio = 0.0 != halfSine ? std::sin( 0.5 * numTones * theta ) / halfSine : numTones;
+                const auto rotation = 0.5 * ( numTones + 1.0 ) * theta;
+                sumReal = ratio * std::cos( rotation );
+                sumImag = ratio * std::sin( rotation );
+            }
+
+            const auto outReal = scaleReal * sumReal - scaleImag * sumImag;
+            const auto outImag = scaleReal * sumImag + scaleImag * sumReal;
+            if ( accumulate )
+            {
+                pOut[0] += outReal;
+                pOut[1] += outImag;
+            }
+            else
+            {
+                pOut[0] = outReal;
+                pOut[1] = outImag;
+            }
+            pOut += 2;
+
+            // Advance z and z^N.
+            auto re = zReal * zRateReal - zImag * zRateImag;
+            zImag = zReal * zRateImag + zImag * zRateReal;
+            zReal = re;
+            re = zNReal * zNRateReal - zNImag * zNRateImag;
+            zNImag = zNReal * zNRateImag + zNImag * zNRateReal;
+            zNReal = re;
+        }
+
+        sampleCount += runLen;
+        numSamples -= runLen;
+        if ( 0 == sampleCount % anchorInterval )
+            anchor();
+    }
+}
+
+void ClosedFormEngine::retune( double fundamentalRadiansPerSample, const double * /*pPhase*/ )
+{
+    // Every harmonic phase is linear in that of z, so z alone need continue at the new rate.
+    thetaPhase = PhaseArithmetic::retunedPhase( thetaPhase, thetaRate, fundamentalRadiansPerSample, sampleCount );
+    thetaRate = fundamentalRadiansPerSample;
+    zRateReal = std::cos( thetaRate );
+    zRateImag = std::sin( thetaRate );
+    zNRateReal = std::cos( numTones * thetaRate );
+    zNRateImag = std::sin( numTones * thetaRate );
+    anchor();
+}
+
+void ClosedFormEngine::seek( size_t sampleIndex )
+{
+    sampleCount = sampleIndex;
+    anchor();
+}
+
+size_t ClosedFormEngine::getSampleCount() const
+{
+    return sampleCount;
+}
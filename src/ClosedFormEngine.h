@@ -0,0 +1,91 @@
+/**
+ * @file ClosedFormEngine.h
+ * @brief The specification file for the Closed Form Geometric Series Engine (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_CLOSEDFORMENGINE_H
+#define REISER_RT_CLOSEDFORMENGINE_H
+
+#include "HarmonicEngine.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Closed Form Geometric Series Engine
+         *
+         * A comb of `N` equal magnitude harmonics whose phases are linear in harmonic number,
+         * phi_k = a + k * d, is a truncated geometric series. With theta_n = d + w * n, each sample is
+         *
+         *     x[n] = m * e^(j(a - d)) * z * (1 - z^N) / (1 - z),  z = e^(j theta_n)
+         *
+         * This engine carries z and z^N as two phasors and evaluates the ratio directly, in O(1) per sample
+         * regardless of `N`. Near the singularity, |1 - z| small, the equivalent Dirichlet kernel form
+         * e^(j theta (N+1)/2) sin(N theta/2) / sin(theta/2) is evaluated with the wrapped angle instead.
+         * Both phasors are re-anchored analytically at regular intervals, so phase error does not accumulate.
+         *
+         * This engine does not support envelope functors.
+         */
+        class ClosedFormEngine : public HarmonicEngine
+        {
+        public:
+            ClosedFormEngine() = default;
+            ~ClosedFormEngine() override = default;
+
+            /**
+             * @brief Determine Whether a Harmonic Series Forms a Geometric Series
+             *
+             * @param numHarmonics The number of harmonics.
+             * @param pMag The magnitudes, or nullptr for unity.
+             * @param pPhase The starting phases, or nullptr for zero.
+             * @return True if the magnitudes are all equal and the phases are linear in harmonic number.
+             */
+            static bool accepts( size_t numHarmonics, const double * pMag, const double * pPhase );
+
+            /**
+             * @brief Reset for a Harmonic Series
+             *
+             * @throw std::invalid_argument If the harmonic series is not accepted.
+             */
+            void reset( size_t numHarmonics, double fundamentalRadiansPerSample,
+                        const double * pMag, const double * pPhase ) override;
+
+            void reset() override;
+
+            void synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                             const HarmonicEnvelope & envelope, bool accumulate ) override;
+
+            void retune( double fundamentalRadiansPerSample, const double * pPhase ) override;
+
+            void seek( size_t sampleIndex ) override;
+
+            size_t getSampleCount() const override;
+
+        private:
+            /**
+             * @brief Recompute Both Phasors from the Current Sample Count
+             */
+            void anchor();
+
+            double numTones{};              // N
+            double thetaPhase{};            // d, the phase of z at sample zero.
+            double thetaRate{};             // w, the rate of z.
+            double scaleReal{};             // m * e^(j(a - d))
+            double scaleImag{};
+            double zReal{ 1.0 };            // z
+            double zImag{};
+            double zRateReal{ 1.0 };
+            double zRateImag{};
+            double zNReal{ 1.0 };           // z^N
+            double zNImag{};
+            double zNRateReal{ 1.0 };
+            double zNRateImag{};
+            size_t sampleCount{};
+        };
+    }
+}
+
+#endif //REISER_RT_CLOSEDFORMENGINE_H
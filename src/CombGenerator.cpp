@@ -6,11 +6,24 @@
  */
 
 #include "CombGenerator.h"
-#include "FlyingPhasorToneGenerator.h"
+#include "PhasorBankEngine.h"
+#include "FusedKernelEngine.h"
+#include "ClosedFormEngine.h"
+#include "InverseFftEngine.h"
+#include "WorkerPool.h"
+#include "AlignedAllocator.h"
+#include "PhaseArithmetic.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
 #include <memory>
-#include <vector>
+#include <mutex>
 #include <stdexcept>
+#include <vector>
 
 using namespace ReiserRT::Signal;
 
@@ -24,161 +37,1147 @@ public:
 private:
     friend class CombGenerator;
 
-    explicit Imple( size_t theMaxHarmonics )
+    Imple( size_t theMaxHarmonics, CombGeneratorEngineType theEngineType,
+           size_t numThreads = 1, size_t theMinToneSamplesPerThread = 0 )
       : maxHarmonics{ theMaxHarmonics }
-      , harmonicGenerators{ maxHarmonics }
+      , kernelTable{ FusedKernel::selectKernelTable( kernelVariant ) }
+      , minToneSamplesPerThread{ std::max( theMinToneSamplesPerThread, size_t( 1 ) ) }
+      , startPhases( theMaxHarmonics, 0.0 )
+      , toneRates( theMaxHarmonics, 0.0 )
+      , activeHarmonics( theMaxHarmonics, 0 )
+      , activeRates( theMaxHarmonics, 0.0 )
+      , activeMagnitudes( theMaxHarmonics, 0.0 )
+      , activePhases( theMaxHarmonics, 0.0 )
+      , ownMagnitudes{ new double[ theMaxHarmonics ] }
+      , ownMagVector{ ownMagnitudes }
+      , nominalMagnitudes( theMaxHarmonics, 0.0 )
+      , mutedHarmonics( theMaxHarmonics, false )
     {
+        setEngineType( theEngineType );
+
+        // Crossfades are applied as a batch envelope. This functor captures only `this` and does not allocate.
+        crossfadeEnvelope.batchEnvelopeFunk = [ this ]( size_t currentSample, size_t numSamples, size_t firstHarmonic,
+                                                        size_t numRangeHarmonics, double * pMatrix, size_t stride )
+        {
+            fillCrossfadeMatrix( currentSample, numSamples, firstHarmonic, numRangeHarmonics, pMatrix, stride );
+        };
+
+        // Worker threads and their partial buffers, double buffered, are only required for more than one thread.
+        if ( 1 < numThreads )
+        {
+            pWorkerPool.reset( new WorkerPool{ numThreads } );
+            partialBuffers.resize( 2 * partitionTileSamples * numThreads );
+        }
     }
 
+    /**
+     * @brief The Number of Samples Synthesized into Partial Buffers Between Reductions
+     *
+     * Each thread's pair of partial buffers, 64 KiB, stays cache resident through its reduction.
+     */
+    static constexpr size_t partitionTileSamples = 2048;
+
+    /**
+     * @brief Parameters Published for Adoption at the Next Block Boundary
+     */
+    struct ParameterBlock
+    {
+        CombGeneratorScalarVectorType magVector{};
+        CombGeneratorScalarVectorType phaseVector{};
+        size_t crossfadeSamples{};
+    };
+
+    /**
+     * @brief Flags the Shared Parameter Block Index as Published but not yet Adopted
+     */
+    static constexpr size_t freshBlockFlag = 4;
+
+    /**
+     * @brief The Nyquist Rate, at or Beyond Which Tones are Culled when Nyquist Culling is Enabled
+     */
+    static constexpr double nyquistRadiansPerSample = PhaseArithmetic::twoPiHigh / 2.0;
+
     ~Imple() = default;
 
+    void setEngineType( CombGeneratorEngineType theEngineType )
+    {
+        // Instantiate any engines the engine type may utilize that we do not already have.
+        // This is where engine memory is allocated, never during `reset` or `getSamples`.
+        switch ( theEngineType )
+        {
+            case CombGeneratorEngineType::PhasorBank:
+                provideEngine( CombGeneratorEngineType::PhasorBank );
+                break;
+            case CombGeneratorEngineType::FusedKernel:
+                provideEngine( CombGeneratorEngineType::FusedKernel );
+                break;
+            case CombGeneratorEngineType::ClosedForm:
+                provideEngine( CombGeneratorEngineType::ClosedForm );
+                break;
+            case CombGeneratorEngineType::InverseFft:
+                provideEngine( CombGeneratorEngineType::InverseFft );
+                provideEngine( CombGeneratorEngineType::FusedKernel );
+                break;
+            case CombGeneratorEngineType::Automatic:
+            default:
+                provideEngine( CombGeneratorEngineType::ClosedForm );
+                provideEngine( CombGeneratorEngineType::FusedKernel );
+                if ( inverseFftMinHarmonics( kernelVariant ) <= maxHarmonics )
+                    provideEngine( CombGeneratorEngineType::InverseFft );
+                break;
+        }
+
+        engineType = theEngineType;
+        if ( !pActiveEngine )
+            activate( defaultActiveEngineType() );
+    }
+
+    void provideEngine( CombGeneratorEngineType theEngineType )
+    {
+        auto & pEngine = engines[ size_t( theEngineType ) ];
+        if ( pEngine ) return;
+
+        switch ( theEngineType )
+        {
+            case CombGeneratorEngineType::FusedKernel:
+                pEngine.reset( new FusedKernelEngine{ maxHarmonics, kernelTable } );
+                break;
+            case CombGeneratorEngineType::ClosedForm:
+                pEngine.reset( new ClosedFormEngine{} );
+                break;
+            case CombGeneratorEngineType::InverseFft:
+                pEngine.reset( new InverseFftEngine{ maxHarmonics } );
+                break;
+            case CombGeneratorEngineType::PhasorBank:
+            default:
+                pEngine.reset( new PhasorBankEngine{ maxHarmonics } );
+                break;
+        }
+    }
+
+    void activate( CombGeneratorEngineType theEngineType )
+    {
+        pActiveEngine = engines[ size_t( theEngineType ) ].get();
+        activeEngineType = theEngineType;
+    }
+
+    CombGeneratorEngineType defaultActiveEngineType() const
+    {
+        // What is in effect prior to a `reset` with generation parameters.
+        return CombGeneratorEngineType::Automatic == engineType ? CombGeneratorEngineType::FusedKernel : engineType;
+    }
+
+    static size_t inverseFftMinHarmonics( CombGeneratorKernelVariant theKernelVariant )
+    {
+        // The harmonic count from which the InverseFft engine outperforms the FusedKernel engine.
+        // These crossovers were measured with 4096 sample `getSamples` invocations.
+        switch ( theKernelVariant )
+        {
+            case CombGeneratorKernelVariant::Avx512:
+                return 4096;
+            case CombGeneratorKernelVariant::Avx2:
+                return 2048;
+            case CombGeneratorKernelVariant::Baseline:
+            case CombGeneratorKernelVariant::Automatic:
+            default:
+                return 512;
+        }
+    }
+
+    CombGeneratorEngineType selectEngineType( size_t theNumHarmonics,
+                                              const CombGeneratorScalarVectorType & theMagVector,
+                                              const CombGeneratorScalarVectorType & thePhaseVector,
+                                              bool enveloped ) const
+    {
+        switch ( engineType )
+        {
+            case CombGeneratorEngineType::ClosedForm:
+                // The closed form engine cannot apply an envelope.
+                if ( enveloped )
+                    throw std::invalid_argument{ "The ClosedForm engine does not support envelope functors!" };
+                return engineType;
+
+            case CombGeneratorEngineType::InverseFft:
+                // The inverse FFT engine cannot apply an envelope. The fused kernel engine stands in.
+                return enveloped ? CombGeneratorEngineType::FusedKernel : engineType;
+
+            case CombGeneratorEngineType::Automatic:
+                // Prefer closed form evaluation, then inverse FFT synthesis for large harmonic counts.
+                if ( enveloped )
+                    return CombGeneratorEngineType::FusedKernel;
+                if ( ClosedFormEngine::accepts( theNumHarmonics, theMagVector.get(), thePhaseVector.get() ) )
+                    return CombGeneratorEngineType::ClosedForm;
+                if ( inverseFftMinHarmonics( kernelVariant ) <= theNumHarmonics )
+                    return CombGeneratorEngineType::InverseFft;
+                return CombGeneratorEngineType::FusedKernel;
+
+            case CombGeneratorEngineType::PhasorBank:
+            case CombGeneratorEngineType::FusedKernel:
+            default:
+                return engineType;
+        }
+    }
+
+    CombGeneratorEngineType selectChirpEngineType() const
+    {
+        // Only the fused kernel engine synthesizes chirps. It stands in for the inverse FFT engine.
+        switch ( engineType )
+        {
+            case CombGeneratorEngineType::PhasorBank:
+                throw std::invalid_argument{ "The PhasorBank engine does not support chirps!" };
+            case CombGeneratorEngineType::ClosedForm:
+                throw std::invalid_argument{ "The ClosedForm engine does not support chirps!" };
+            case CombGeneratorEngineType::FusedKernel:
+            case CombGeneratorEngineType::InverseFft:
+            case CombGeneratorEngineType::Automatic:
+            default:
+                return CombGeneratorEngineType::FusedKernel;
+        }
+    }
+
+    CombGeneratorEngineType selectToneBankEngineType() const
+    {
+        // The phasor bank and fused kernel engines take arbitrary rates. The fused kernel engine stands in for others.
+        switch ( engineType )
+        {
+            case CombGeneratorEngineType::ClosedForm:
+                throw std::invalid_argument{ "The ClosedForm engine does not support tone banks!" };
+            case CombGeneratorEngineType::PhasorBank:
+                return engineType;
+            case CombGeneratorEngineType::FusedKernel:
+            case CombGeneratorEngineType::InverseFft:
+            case CombGeneratorEngineType::Automatic:
+            default:
+                return CombGeneratorEngineType::FusedKernel;
+        }
+    }
+
     void reset(size_t theNumHarmonics, double fundamentalRadiansPerSample,
                const CombGeneratorScalarVectorType & theMagVector, const CombGeneratorScalarVectorType & thePhaseVector,
-               const CombGeneratorEnvelopeFunkType & theEnvelopeFunk )
+               const CombGeneratorEnvelopeFunkType & theEnvelopeFunk,
+               const CombGeneratorBatchEnvelopeFunkType & theBatchEnvelopeFunk,
+               const CombGeneratorChirpType * pChirp = nullptr, const double * pToneRates = nullptr,
+               const CombGeneratorSegmentEnvelopeFunkType & theSegmentEnvelopeFunk =
+                   CombGeneratorSegmentEnvelopeFunkType{},
+               const CombGeneratorCommonEnvelopeFunkType & theCommonEnvelopeFunk =
+                   CombGeneratorCommonEnvelopeFunkType{} )
     {
         // Ensure that the user has not specified more lines than they constructed us to handle.
         if ( maxHarmonics < theNumHarmonics )
             throw std::length_error{ "The number of harmonics exceeds the maximum allocated during construction!" };
 
-        // Record number of harmonics
+        // Select the engine in effect.
+        if ( pChirp )
+            activate( selectChirpEngineType() );
+        else if ( pToneRates )
+            activate( selectToneBankEngineType() );
+        else
+            activate( selectEngineType( theNumHarmonics, theMagVector, thePhaseVector,
+                                        theEnvelopeFunk || theBatchEnvelopeFunk || theSegmentEnvelopeFunk ) );
+
+        // Record number of harmonics, the fundamental rate, any chirp and any tone rates for cloning.
         numHarmonics = theNumHarmonics;
+        fundamentalRate = fundamentalRadiansPerSample;
+        chirped = nullptr != pChirp;
+        chirp = chirped ? *pChirp : CombGeneratorChirpType{};
+        toneBank = nullptr != pToneRates;
+        if ( toneBank && pToneRates != toneRates.data() )
+            std::copy( pToneRates, pToneRates + numHarmonics, toneRates.begin() );
 
-        // Record the Magnitude vector for later use by getSamples.
+        // Record the Magnitude vector for later use by getSamples and the Phase vector for cloning.
         magVector = theMagVector;
+        phaseVector = thePhaseVector;
+        recordStartPhases();
 
-        // Record the Envelope Function which could be empty.
-        envelopeFunk = theEnvelopeFunk;
+        // Record the Envelope Functions which could be empty. A batch envelope functor requires the envelope
+        // matrix, allocated on first use. Columns beyond the number of harmonics must be zero.
+        envelope.envelopeFunk = theEnvelopeFunk;
+        envelope.batchEnvelopeFunk = theBatchEnvelopeFunk;
+        envelope.segmentEnvelopeFunk = theSegmentEnvelopeFunk;
+        if ( theBatchEnvelopeFunk )
+        {
+            if ( envelopeMatrix.empty() )
+                envelopeMatrix.resize( envelopeMatrixStride() * combGeneratorBatchEnvelopeBlockSamples );
+            envelope.pEnvelopeMatrix = envelopeMatrix.data();
+            envelope.envelopeMatrixStride = envelopeMatrixStride();
+        }
+        std::fill( envelopeMatrix.begin(), envelopeMatrix.end(), 0.0 );
+        maskMutedHarmonics();
 
-        // Reset each Harmonic Tone Generator specified.
-        auto pPhase = thePhaseVector.get();
-        for ( size_t i = 0; numHarmonics != i; ++i )
+        // A common envelope is not the engine's concern. Sums are synthesized into buffers, allocated on first use,
+        // before being enveloped and accumulated.
+        commonEnvelopeFunk = theCommonEnvelopeFunk;
+        if ( theCommonEnvelopeFunk && commonBuffer.empty() )
         {
-            const auto radiansPerSample = double(i+1) * fundamentalRadiansPerSample;
-            harmonicGenerators[i].reset( radiansPerSample, pPhase ? *pPhase++ : 0.0 );
+            commonBuffer.resize( partitionTileSamples );
+            commonSingleBuffer.resize( partitionTileSamples );
         }
 
-        // Reset the excess harmonic generators. We do not want them to contain garbage.
-        for (size_t i = numHarmonics; maxHarmonics != i; ++i )
-            harmonicGenerators[i].reset();
+        // Abandon any crossfade and any parameters published, but not adopted, before this reset.
+        // Likewise any events pending.
+        discardParameterUpdates();
+        clearEvents();
+
+        // Reset the engine for each harmonic tone not culled.
+        resetActiveEngine();
+    }
+
+    void maskMutedHarmonics()
+    {
+        // An envelope functor need not make anything of the nominal magnitudes it is passed, so harmonics muted
+        // by event or by `disableHarmonic` are muted before it is consulted, as a functor would mute them. Their
+        // phases are then advanced directly. The engines are given these functors, which capture only `this`.
+        maskedEnvelope = envelope;
+        if ( envelope.envelopeFunk )
+            maskedEnvelope.envelopeFunk = [ this ]( size_t currentSample, size_t numSamples, size_t nHarmonic,
+                                                    double nominalMag ) -> const double *
+            {
+                if ( mutedHarmonics[ nHarmonic ] )
+                    return nullptr;
+                return envelope.envelopeFunk( currentSample, numSamples, nHarmonic, nominalMag );
+            };
+        if ( envelope.segmentEnvelopeFunk )
+            maskedEnvelope.segmentEnvelopeFunk = [ this ]( size_t currentSample, size_t numSamples, size_t nHarmonic,
+                                                           double nominalMag )
+            {
+                if ( mutedHarmonics[ nHarmonic ] )
+                    return CombGeneratorEnvelopeSegmentsType{};
+                return envelope.segmentEnvelopeFunk( currentSample, numSamples, nHarmonic, nominalMag );
+            };
+        if ( envelope.batchEnvelopeFunk )
+            maskedEnvelope.batchEnvelopeFunk = [ this ]( size_t currentSample, size_t numSamples, size_t firstHarmonic,
+                                                         size_t numRangeHarmonics, double * pMatrix, size_t stride )
+            {
+                envelope.batchEnvelopeFunk( currentSample, numSamples, firstHarmonic, numRangeHarmonics,
+                                            pMatrix, stride );
+                for ( size_t h = 0; numRangeHarmonics != h; ++h )
+                {
+                    if ( !mutedHarmonics[ firstHarmonic + h ] )
+                        continue;
+                    for ( size_t n = 0; numSamples != n; ++n )
+                        pMatrix[ n * stride + h ] = 0.0;
+                }
+            };
+    }
+
+    double toneRate( size_t i ) const
+    {
+        return toneBank ? toneRates[i] : double(i+1) * fundamentalRate;
+    }
+
+    bool compactable() const
+    {
+        // Culled tones may only be left out of engines synthesizing tones individually, and only while nothing
+        // addresses tones by their index. Envelopes do, and replace the magnitudes besides. Chirp anchoring does.
+        return !chirped && !envelope && !crossfadeSamples &&
+               ( CombGeneratorEngineType::PhasorBank == activeEngineType ||
+                 CombGeneratorEngineType::FusedKernel == activeEngineType );
     }
 
-    void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+    bool cullTones( bool cullZeroMagnitudes )
     {
-        // Special case of numHarmonics equal zero.
-        // Since we are "getting" samples, and not accumulating samples. We need to
-        // ensure we write zeros to the buffer if numHarmonics is zero.
-        if ( !numHarmonics )
+        // Zero magnitude tones are culled when compactable. Tones at or beyond Nyquist are culled when enabled.
+        // Zero magnitude tones culled are never synthesized, whether or not the active tones are compacted.
+        const auto compact = compactable();
+        const auto pMag = compact && cullZeroMagnitudes ? magVector.get() : nullptr;
+        numActiveHarmonics = 0;
+        zeroMagnitudesCulled = false;
+        for ( size_t i = 0; numHarmonics != i; ++i )
         {
-            for ( size_t i = 0; numSamples != i; ++i )
-                *pElementBuffer++ = FlyingPhasorElementType{};
-            return;
+            const auto zeroMagnitude = pMag && 0.0 == pMag[i];
+            const auto culled = zeroMagnitude ||
+                                ( nyquistCulling && nyquistRadiansPerSample <= std::abs( toneRate( i ) ) );
+            zeroMagnitudesCulled |= zeroMagnitude;
+            if ( !culled )
+                activeHarmonics[ numActiveHarmonics++ ] = i;
         }
 
-        // Get pointer to harmonic magnitudes. This is allowed to be nullptr.
-        auto pMag = magVector.get();
+        // An active list which is a prefix of the tones requires no compaction. Otherwise, unless compactable,
+        // only the culled tones following the last active tone are left out.
+        if ( !numActiveHarmonics || numActiveHarmonics - 1 == activeHarmonics[ numActiveHarmonics - 1 ] )
+            return false;
+        if ( compact )
+            return true;
+        numActiveHarmonics = activeHarmonics[ numActiveHarmonics - 1 ] + 1;
+        for ( size_t i = 0; numActiveHarmonics != i; ++i )
+            activeHarmonics[i] = i;
+        return false;
+    }
 
-        // If no envelope functor, we use a constant magnitude.
-        if ( !envelopeFunk )
+    void resetActiveEngine( bool cullZeroMagnitudes = true )
+    {
+        // Chirps are never culled.
+        if ( chirped )
         {
-            // For each harmonic tone specified last reset, accumulate its samples.
             for ( size_t i = 0; numHarmonics != i; ++i )
+                activeHarmonics[i] = i;
+            numActiveHarmonics = numHarmonics;
+            zeroMagnitudesCulled = false;
+            compacted = false;
+            pActiveEngine->resetChirp( numHarmonics, chirp, magVector.get(), startPhases.data() );
+            return;
+        }
+
+        // The engine may retain a pointer to the magnitudes, which our shared magnitude vector keeps alive,
+        // or to our active magnitudes when the active tones are compacted into a tone bank.
+        compacted = cullTones( cullZeroMagnitudes );
+        if ( compacted )
+        {
+            const auto pMag = magVector.get();
+            for ( size_t j = 0; numActiveHarmonics != j; ++j )
             {
-                // Get the nth harmonic magnitude or default to unity gain.
-                auto mag = pMag ? *pMag++ : 1.0;
-
-                // Fundamental tone optimization: If NOT fundamental tone, accumulate.
-                // Otherwise, we just get and store.
-                if ( i )
-                    harmonicGenerators[i].accumSamplesScaled( pElementBuffer, numSamples, mag );
-                else
-                    harmonicGenerators[i].getSamplesScaled( pElementBuffer, numSamples, mag );
+                const auto i = activeHarmonics[j];
+                activeRates[j] = toneRate( i );
+                activeMagnitudes[j] = pMag ? pMag[i] : 1.0;
+                activePhases[j] = startPhases[i];
             }
+            pActiveEngine->resetToneBank( numActiveHarmonics, activeRates.data(),
+                                          activeMagnitudes.data(), activePhases.data() );
         }
-        // Else, we have an envelope functor, we will utilize it
+        else if ( toneBank )
+            pActiveEngine->resetToneBank( numActiveHarmonics, toneRates.data(), magVector.get(), startPhases.data() );
         else
+            pActiveEngine->reset( numActiveHarmonics, fundamentalRate, magVector.get(), startPhases.data() );
+    }
+
+    void resetOffsetComb( size_t theNumTones, double offsetRadiansPerSample, double spacingRadiansPerSample,
+                          const CombGeneratorScalarVectorType & theMagVector,
+                          const CombGeneratorScalarVectorType & thePhaseVector,
+                          const CombGeneratorEnvelopeFunkType & theEnvelopeFunk )
+    {
+        if ( maxHarmonics < theNumTones )
+            throw std::length_error{ "The number of harmonics exceeds the maximum allocated during construction!" };
+
+        // Tone rates are formed in place, so no allocation is made.
+        for ( size_t i = 0; theNumTones != i; ++i )
+            toneRates[i] = offsetRadiansPerSample + double(i+1) * spacingRadiansPerSample;
+        reset( theNumTones, 0.0, theMagVector, thePhaseVector, theEnvelopeFunk, CombGeneratorBatchEnvelopeFunkType{},
+               nullptr, toneRates.data() );
+    }
+
+    template< typename ElementType >
+    void produceSamples( ElementType * pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        const auto & blockEnvelope = beginBlock();
+
+        // Samples are produced in runs over which the gate is either on or off. Ungated, there is one run.
+        // Runs are also split at the sample index of each event, which is applied before the run beginning there.
+        for ( size_t offset = 0; numSamples != offset; )
         {
-            // For, each spectral line accumulate its envelope modulated samples
-            auto nSample = harmonicGenerators[0].getSampleCount();  // All the same
+            const auto currentSample = pActiveEngine->getSampleCount();
+            applyEvents( currentSample );
+            auto on = true;
+            const auto runLen = std::min( { numSamples - offset, gateRun( currentSample, on ),
+                                            eventRun( currentSample ) } );
 
-            // For each harmonic tone specified last reset, accumulate its samples.
-            for ( size_t i = 0; numHarmonics != i; ++i )
+            // Special case of the gate off or no active harmonics, numHarmonics equal zero or all culled.
+            // Since we may be "getting" samples, and not accumulating samples. We need to ensure we write
+            // zeros to the buffer. Harmonic phases jump over the run, so coherence is kept from pulse to pulse.
+            if ( !on || !numActiveHarmonics )
             {
-                // Get the nth harmonic magnitude or default to unity gain.
-                auto mag = pMag ? *pMag++ : 1.0;
-
-                // Invoke the envelope functor for this harmonic to obtain its modulation envelope.
-                auto pEnvelope = envelopeFunk(nSample, numSamples, i, mag );
-
-                // Fundamental tone optimization: If NOT fundamental tone, accumulate.
-                // Otherwise, we just get and store.
-                if ( i )
-                    harmonicGenerators[i].accumSamplesScaled( pElementBuffer, numSamples, pEnvelope );
-                else
-                    harmonicGenerators[i].getSamplesScaled( pElementBuffer, numSamples, pEnvelope );
+                if ( !accumulate )
+                    std::fill( pElementBuffer + offset, pElementBuffer + offset + runLen, ElementType{} );
+                skipSamples( runLen );
             }
+            else if ( commonEnvelopeFunk )
+                synthesizeCommon( pElementBuffer + offset, runLen, blockEnvelope, accumulate );
+            else
+                synthesize( pElementBuffer + offset, runLen, blockEnvelope, accumulate );
+
+            offset += runLen;
         }
     }
 
-    void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+    template< typename ElementType >
+    void synthesizeCommon( ElementType * pElementBuffer, size_t numSamples, const HarmonicEnvelope & blockEnvelope,
+                           bool accumulate )
     {
-        // Get pointer to harmonic magnitudes. This is allowed to be nullptr.
-        auto pMag = magVector.get();
+        // A muted comb is treated as the gate off.
+        const auto pEnvelope = commonEnvelopeFunk( pActiveEngine->getSampleCount(), numSamples );
+        if ( !pEnvelope )
+        {
+            if ( !accumulate )
+                std::fill( pElementBuffer, pElementBuffer + numSamples, ElementType{} );
+            skipSamples( numSamples );
+            return;
+        }
 
-        // If no envelope functor, we use a constant magnitude.
-        if ( !envelopeFunk )
+        // The sum is enveloped a tile at a time, while it is cache resident. Getting samples, it is synthesized
+        // into the caller's buffer and enveloped in place. Accumulating, it is synthesized into our own buffer.
+        using ValueType = typename ElementType::value_type;
+        auto pCommon = commonBufferFor( pElementBuffer );
+        for ( size_t offset = 0; numSamples != offset; )
         {
-            // For each harmonic tone specified last reset, accumulate its samples.
-            for ( size_t i = 0; numHarmonics != i; ++i )
+            const auto tileLen = std::min( numSamples - offset, partitionTileSamples );
+            auto pOut = pElementBuffer + offset;
+            const auto pEnv = pEnvelope + offset;
+            if ( accumulate )
+            {
+                synthesize( pCommon, tileLen, blockEnvelope, false );
+                for ( size_t n = 0; tileLen != n; ++n ) pOut[n] += ValueType( pEnv[n] ) * pCommon[n];
+            }
+            else
             {
-                // Get the nth harmonic magnitude or default to unity gain.
-                auto mag = pMag ? *pMag++ : 1.0;
+                synthesize( pOut, tileLen, blockEnvelope, false );
+                for ( size_t n = 0; tileLen != n; ++n ) pOut[n] *= ValueType( pEnv[n] );
+            }
+            offset += tileLen;
+        }
+    }
+
+    FlyingPhasorElementBufferTypePtr commonBufferFor( FlyingPhasorElementBufferTypePtr )
+    {
+        return commonBuffer.data();
+    }
+
+    CombGeneratorSingleElementBufferTypePtr commonBufferFor( CombGeneratorSingleElementBufferTypePtr )
+    {
+        return commonSingleBuffer.data();
+    }
 
-                // Accumulate nth harmonic samples into the buffer
-                harmonicGenerators[i].accumSamplesScaled( pElementBuffer, numSamples, mag );
+    void synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                     const HarmonicEnvelope & blockEnvelope, bool accumulate )
+    {
+        if ( !synthesizePartitioned( pElementBuffer, numSamples, blockEnvelope, accumulate ) )
+            pActiveEngine->synthesize( pElementBuffer, numSamples, blockEnvelope, accumulate );
+    }
+
+    void synthesize( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples,
+                     const HarmonicEnvelope & blockEnvelope, bool accumulate )
+    {
+        pActiveEngine->synthesizeSingle( pElementBuffer, numSamples, blockEnvelope, accumulate );
+    }
+
+    size_t gateRun( size_t sampleIndex, bool & on ) const
+    {
+        // The number of samples from the sample index over which the gate remains as it is there.
+        // Ungated, the gate is on indefinitely.
+        if ( periodicGate )
+        {
+            if ( sampleIndex < gate.startOffsetSamples )
+            {
+                on = false;
+                return gate.startOffsetSamples - sampleIndex;
             }
+            const auto position = ( sampleIndex - gate.startOffsetSamples ) % gate.pulseRepetitionSamples;
+            on = position < gate.pulseWidthSamples;
+            return on ? gate.pulseWidthSamples - position : gate.pulseRepetitionSamples - position;
+        }
+
+        if ( toggledGate )
+        {
+            // The gate is off before the first toggle and toggles at each one. It stays as it is after the last.
+            const auto next = std::upper_bound( gateToggles.begin(), gateToggles.end(), sampleIndex );
+            on = ( next - gateToggles.begin() ) & 0x1;
+            return gateToggles.end() == next ? std::numeric_limits< size_t >::max() : *next - sampleIndex;
+        }
+
+        on = true;
+        return std::numeric_limits< size_t >::max();
+    }
+
+    void setGate( const CombGeneratorGateType & theGate )
+    {
+        if ( !theGate.pulseRepetitionSamples || theGate.pulseRepetitionSamples < theGate.pulseWidthSamples )
+            throw std::invalid_argument{ "The pulse width must not exceed a non zero pulse repetition interval!" };
+
+        gate = theGate;
+        periodicGate = true;
+        toggledGate = false;
+        gateToggles.clear();
+    }
+
+    void setGate( const size_t * pToggleSamples, size_t numToggles )
+    {
+        if ( numToggles && !pToggleSamples )
+            throw std::invalid_argument{ "A gate of toggles requires the toggle samples!" };
+        for ( size_t i = 1; i < numToggles; ++i )
+            if ( pToggleSamples[i] <= pToggleSamples[i-1] )
+                throw std::invalid_argument{ "Gate toggle samples must be strictly ascending!" };
+
+        // This is the only allocation gating makes.
+        gateToggles.assign( pToggleSamples, pToggleSamples + numToggles );
+        gate = CombGeneratorGateType{};
+        periodicGate = false;
+        toggledGate = true;
+    }
+
+    void clearGate()
+    {
+        gate = CombGeneratorGateType{};
+        periodicGate = false;
+        toggledGate = false;
+        gateToggles.clear();
+    }
+
+    size_t eventRun( size_t sampleIndex ) const
+    {
+        // The number of samples from the sample index before the next event takes effect. Due events are applied.
+        return events.size() != nextEvent ? events[ nextEvent ].sampleIndex - sampleIndex :
+                                            std::numeric_limits< size_t >::max();
+    }
+
+    void scheduleEvent( const CombGeneratorEventType & event )
+    {
+        if ( event.sampleIndex < pActiveEngine->getSampleCount() )
+            throw std::invalid_argument{ "An event may not be scheduled for a sample already produced!" };
+
+        if ( CombGeneratorEventAction::Retune == event.action )
+        {
+            if ( chirped || toneBank )
+                throw std::logic_error{ "Only a harmonic series at a constant fundamental rate may be retuned!" };
         }
-        // Else, we have an envelope functor, we will utilize it
         else
         {
-            // For, each spectral line accumulate its envelope modulated samples
-            auto nSample = harmonicGenerators[0].getSampleCount();  // All the same
+            if ( numHarmonics <= event.nHarmonic )
+                throw std::invalid_argument{ "The harmonic acted upon exceeds the number of harmonics!" };
+            if ( !pActiveEngine->acceptsParameterUpdates() )
+                throw std::logic_error{ "The active engine does not support parameter updates!" };
+        }
+
+        // Whatever magnitude vector events displaced is released here, on the scheduling side.
+        displacedMagVector = nullptr;
 
-            // For each harmonic tone specified last reset, accumulate its samples.
+        // Applied events are dropped, which does not release storage. Events for the same sample index
+        // are kept in the order scheduled.
+        events.erase( events.begin(), events.begin() + std::ptrdiff_t( nextEvent ) );
+        nextEvent = 0;
+        auto comparator = []( const CombGeneratorEventType & a, const CombGeneratorEventType & b )
+        {
+            return a.sampleIndex < b.sampleIndex;
+        };
+        events.insert( std::upper_bound( events.begin(), events.end(), event, comparator ), event );
+    }
+
+    void clearEvents()
+    {
+        events.clear();
+        nextEvent = 0;
+    }
+
+    void applyEvents( size_t currentSample )
+    {
+        // Magnitude events due together share one engine update, when culled tones require one.
+        auto magnitudesChanged = false;
+        for ( ; events.size() != nextEvent && events[ nextEvent ].sampleIndex <= currentSample; ++nextEvent )
+        {
+            const auto & event = events[ nextEvent ];
+            const auto i = event.nHarmonic;
+            switch ( event.action )
+            {
+                case CombGeneratorEventAction::SetMagnitude:
+                    takeOverMagnitudes();
+                    nominalMagnitudes[i] = event.value;
+                    break;
+                case CombGeneratorEventAction::MuteHarmonic:
+                    takeOverMagnitudes();
+                    mutedHarmonics[i] = true;
+                    break;
+                case CombGeneratorEventAction::UnmuteHarmonic:
+                    takeOverMagnitudes();
+                    mutedHarmonics[i] = false;
+                    break;
+                case CombGeneratorEventAction::Retune:
+                default:
+                    retune( event.value );
+                    continue;
+            }
+            magnitudesChanged = !updateMagnitude( i ) || magnitudesChanged;
+        }
+
+        if ( magnitudesChanged )
+            updateEngineParameters( currentSample, false );
+    }
+
+    void takeOverMagnitudes()
+    {
+        // Magnitude changes of individual harmonics are written into magnitudes of our own, allocated at
+        // construction. We take over the magnitudes in effect, unmuted, the first time after they were replaced.
+        // The vector displaced is held rather than released, so nothing is freed while producing samples.
+        if ( magVector == ownMagVector )
+            return;
+
+        const auto pFrom = magVector.get();
+        const auto pMag = ownMagnitudes.get();
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            nominalMagnitudes[i] = pFrom ? pFrom[i] : 1.0;
+            mutedHarmonics[i] = false;
+            pMag[i] = nominalMagnitudes[i];
+        }
+        displacedMagVector = std::move( magVector );
+        magVector = ownMagVector;
+    }
+
+    bool updateMagnitude( size_t nHarmonic )
+    {
+        // The engine is updated for the one harmonic when its tones are the harmonics, none culled.
+        // Otherwise, false is returned and the engine requires a full update.
+        ownMagnitudes[ nHarmonic ] = mutedHarmonics[ nHarmonic ] ? 0.0 : nominalMagnitudes[ nHarmonic ];
+        if ( numActiveHarmonics != numHarmonics )
+            return false;
+        pActiveEngine->updateMagnitude( nHarmonic, ownMagnitudes.get() );
+        return true;
+    }
+
+    void enableHarmonic( size_t nHarmonic, double magnitude, double startPhase )
+    {
+        if ( !pActiveEngine->acceptsParameterUpdates() )
+            throw std::logic_error{ "The active engine does not support parameter updates!" };
+        if ( chirped )
+            throw std::logic_error{ "Harmonics may not be enabled for a chirped series!" };
+        if ( maxHarmonics <= nHarmonic )
+            throw std::length_error{ "The harmonic exceeds the maximum allocated during construction!" };
+        if ( toneBank && numHarmonics <= nHarmonic )
+            throw std::logic_error{ "A tone bank may not be extended!" };
+
+        takeOverMagnitudes();
+        const auto direct = numActiveHarmonics == numHarmonics;
+
+        // Harmonics skipped over, when extending the series, are appended disabled.
+        for ( ; numHarmonics < nHarmonic; ++numHarmonics )
+        {
+            nominalMagnitudes[ numHarmonics ] = 0.0;
+            mutedHarmonics[ numHarmonics ] = true;
+            ownMagnitudes[ numHarmonics ] = 0.0;
+            startPhases[ numHarmonics ] = 0.0;
+            if ( direct )
+                pActiveEngine->restartHarmonic( numHarmonics, toneRate( numHarmonics ), 0.0, ownMagnitudes.get() );
+        }
+        numHarmonics = std::max( numHarmonics, nHarmonic + 1 );
+
+        nominalMagnitudes[ nHarmonic ] = magnitude;
+        mutedHarmonics[ nHarmonic ] = false;
+        ownMagnitudes[ nHarmonic ] = magnitude;
+        startPhases[ nHarmonic ] = startPhase;
+        retuned = true;     // The starting phases are no longer those of the phase vector.
+
+        // Culled tones, and a tone to be culled at or beyond Nyquist, require the engine to be reset and moved
+        // to the current sample. Otherwise, only the one harmonic is restarted.
+        const auto rate = toneRate( nHarmonic );
+        if ( direct && !( nyquistCulling && nyquistRadiansPerSample <= std::abs( rate ) ) )
+        {
+            pActiveEngine->restartHarmonic( nHarmonic, rate, startPhase, ownMagnitudes.get() );
+            numActiveHarmonics = numHarmonics;
+            return;
+        }
+        const auto currentSample = pActiveEngine->getSampleCount();
+        resetActiveEngine();
+        pActiveEngine->seek( currentSample );
+    }
+
+    void disableHarmonic( size_t nHarmonic )
+    {
+        if ( !pActiveEngine->acceptsParameterUpdates() )
+            throw std::logic_error{ "The active engine does not support parameter updates!" };
+        if ( numHarmonics <= nHarmonic )
+            throw std::invalid_argument{ "The harmonic acted upon exceeds the number of harmonics!" };
+
+        takeOverMagnitudes();
+        mutedHarmonics[ nHarmonic ] = true;
+        if ( !updateMagnitude( nHarmonic ) )
+            updateEngineParameters( pActiveEngine->getSampleCount(), false );
+    }
+
+    size_t envelopeMatrixStride() const
+    {
+        // Rows are padded as the fused kernel tone bank is, so every row is aligned.
+        return FusedKernel::paddedToneCount( maxHarmonics );
+    }
+
+    size_t partitionThreadCount( size_t numSamples ) const
+    {
+        // One thread unless we have threads, an engine able to partition, and enough work to go around.
+        const auto granularity = pActiveEngine->getPartitionGranularity();
+        if ( !pWorkerPool || !granularity )
+            return 1;
+        const auto numGroups = ( numActiveHarmonics + granularity - 1 ) / granularity;
+        const auto numByWork = numActiveHarmonics * numSamples / minToneSamplesPerThread;
+        return std::max( std::min( { pWorkerPool->getNumWorkers(), numGroups, numByWork } ), size_t( 1 ) );
+    }
+
+    bool synthesizePartitioned( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                const HarmonicEnvelope & blockEnvelope, bool accumulate )
+    {
+        const auto numThreads = partitionThreadCount( numSamples );
+        if ( 1 == numThreads )
+            return false;
+
+        // Active harmonics are divided into contiguous ranges, on granularity boundaries, one per partition.
+        // Rounding may leave fewer partitions than threads.
+        const auto granularity = pActiveEngine->getPartitionGranularity();
+        const auto numGroups = ( numActiveHarmonics + granularity - 1 ) / granularity;
+        const auto groupsPerPartition = ( numGroups + numThreads - 1 ) / numThreads;
+        const auto numPartitions = ( numGroups + groupsPerPartition - 1 ) / groupsPerPartition;
+        const auto harmonicsPerPartition = groupsPerPartition * granularity;
+        const auto currentSample = pActiveEngine->getSampleCount();
+        const auto numWorkers = pWorkerPool->getNumWorkers();
+
+        // Every worker runs the job. Those beyond the number of partitions only help reduce.
+        // Per tile, each partition is synthesized into its worker's partial buffer. After the barrier, every worker
+        // reduces its own slice of the tile, summing partials in partition order. Partial buffers alternate
+        // between tiles, so the next tile may be synthesized while slower workers are still reducing.
+        // An envelope functor may throw. Every worker must still arrive at the barrier of every tile, so the first
+        // exception is recorded, the remaining work skipped and the exception rethrown once all workers complete.
+        std::mutex exceptionMutex{};
+        std::exception_ptr firstException{};
+        std::atomic< bool > failed{};
+        auto job = [ &, this ]( size_t k )
+        {
+            const auto firstHarmonic = k * harmonicsPerPartition;
+            const auto partitionHarmonics = k < numPartitions ?
+                                            std::min( harmonicsPerPartition, numActiveHarmonics - firstHarmonic ) : 0;
+            size_t tile = 0;
+            for ( size_t offset = 0; numSamples > offset; offset += partitionTileSamples, ++tile )
+            {
+                const auto tileLen = std::min( partitionTileSamples, numSamples - offset );
+                const auto tileBuffer = ( tile & 0x1 ) * partitionTileSamples * numWorkers;
+                if ( partitionHarmonics && !failed.load( std::memory_order_relaxed ) )
+                {
+                    try
+                    {
+                        pActiveEngine->synthesizePartition( firstHarmonic, partitionHarmonics, currentSample + offset,
+                                                            partialBuffers.data() + tileBuffer +
+                                                            k * partitionTileSamples, tileLen, blockEnvelope );
+                    }
+                    catch ( ... )
+                    {
+                        std::lock_guard< std::mutex > lock{ exceptionMutex };
+                        if ( !firstException )
+                            firstException = std::current_exception();
+                        failed.store( true, std::memory_order_relaxed );
+                    }
+                }
+
+                pWorkerPool->arriveAndWait();
+                if ( failed.load( std::memory_order_relaxed ) )
+                    continue;
+
+                const auto sliceBegin = tileLen * k / numWorkers;
+                const auto sliceEnd = tileLen * ( k + 1 ) / numWorkers;
+                auto pOut = pElementBuffer + offset;
+                for ( size_t p = 0; numPartitions != p; ++p )
+                {
+                    const auto pPartial = partialBuffers.data() + tileBuffer + p * partitionTileSamples;
+                    if ( p || accumulate )
+                        for ( size_t n = sliceBegin; sliceEnd != n; ++n ) pOut[n] += pPartial[n];
+                    else
+                        for ( size_t n = sliceBegin; sliceEnd != n; ++n ) pOut[n] = pPartial[n];
+                }
+            }
+        };
+        pWorkerPool->run( std::ref( job ) );
+        if ( firstException )
+            std::rethrow_exception( firstException );
+
+        pActiveEngine->completePartitions( numSamples );
+        return true;
+    }
+
+    void publishParameters( const CombGeneratorScalarVectorType & theMagVector,
+                            const CombGeneratorScalarVectorType & thePhaseVector, size_t theCrossfadeSamples )
+    {
+        if ( !pActiveEngine->acceptsParameterUpdates() )
+            throw std::logic_error{ "The active engine does not support parameter updates!" };
+
+        // A crossfade requires the envelope matrix and the magnitudes faded from, allocated here on first use.
+        // Neither is touched by the generating thread until it adopts a block with a crossfade, published below.
+        if ( theCrossfadeSamples && crossfadeFrom.empty() )
+        {
+            if ( envelopeMatrix.empty() )
+                envelopeMatrix.resize( envelopeMatrixStride() * combGeneratorBatchEnvelopeBlockSamples );
+            crossfadeFrom.resize( maxHarmonics );
+            crossfadeEnvelope.pEnvelopeMatrix = envelopeMatrix.data();
+            crossfadeEnvelope.envelopeMatrixStride = envelopeMatrixStride();
+        }
+
+        // Fill our own block, releasing whatever it held on this thread, and exchange it for the shared block.
+        // The generating thread exchanges the shared block for its own when it sees the fresh flag.
+        auto & block = parameterBlocks[ publisherBlock ];
+        block.magVector = theMagVector;
+        block.phaseVector = thePhaseVector;
+        block.crossfadeSamples = theCrossfadeSamples;
+        publisherBlock = sharedBlock.exchange( publisherBlock | freshBlockFlag, std::memory_order_acq_rel ) &
+                         ~freshBlockFlag;
+    }
+
+    const HarmonicEnvelope & beginBlock()
+    {
+        // A crossfade completes once all of its samples have been produced. Seeking back before it abandons it.
+        const auto currentSample = pActiveEngine->getSampleCount();
+        if ( crossfadeSamples && ( currentSample < crossfadeStartSample ||
+                                   crossfadeStartSample + crossfadeSamples <= currentSample ) )
+            crossfadeSamples = 0;
+
+        // Adopt any parameters published since the last block. This is the only cost when there are none.
+        if ( sharedBlock.load( std::memory_order_relaxed ) & freshBlockFlag )
+            adoptParameters( currentSample );
+
+        // A crossfade is applied as an envelope, unless the user has an envelope of their own.
+        return crossfadeSamples && !envelope ? crossfadeEnvelope : maskedEnvelope;
+    }
+
+    void adoptParameters( size_t currentSample )
+    {
+        adoptedBlock = sharedBlock.exchange( adoptedBlock, std::memory_order_acq_rel ) & ~freshBlockFlag;
+        auto & block = parameterBlocks[ adoptedBlock ];
+
+        // Fade from the magnitudes in effect, which may be part way through an earlier crossfade.
+        if ( block.crossfadeSamples )
+        {
+            const auto pMag = magVector.get();
+            const auto ramp = crossfadeSamples ? double( currentSample - crossfadeStartSample ) /
+                                                 double( crossfadeSamples ) : 1.0;
             for ( size_t i = 0; numHarmonics != i; ++i )
             {
-                // Get the nth harmonic magnitude or default to unity gain.
-                auto mag = pMag ? *pMag++ : 1.0;
+                const auto to = pMag ? pMag[i] : 1.0;
+                crossfadeFrom[i] = crossfadeSamples ? crossfadeFrom[i] + ( to - crossfadeFrom[i] ) * ramp : to;
+            }
+            crossfadeStartSample = currentSample;
+        }
+        crossfadeSamples = block.crossfadeSamples;
+
+        // Swapping rather than assigning leaves the vectors we are done with in the block. They are released
+        // by the publishing thread when it next fills the block, so nothing is freed on this thread.
+        std::swap( magVector, block.magVector );
+        const auto newPhases = bool( block.phaseVector );
+        if ( newPhases )
+        {
+            std::swap( phaseVector, block.phaseVector );
+            recordStartPhases();
+        }
 
-                // Invoke the envelope functor for this harmonic to obtain its modulation envelope.
-                auto pEnvelope = envelopeFunk(nSample, numSamples, i, mag );
+        updateEngineParameters( currentSample, newPhases );
+    }
 
-                // Accumulate nth harmonic samples into the buffer
-                harmonicGenerators[i].accumSamplesScaled( pElementBuffer, numSamples, pEnvelope );
+    void updateEngineParameters( size_t currentSample, bool newPhases )
+    {
+        // Tones culled for zero magnitude are reinstated, as are compacted tones for a crossfade, by resetting
+        // the engine and moving it to the current sample. Zero magnitudes are not culled anew, so this happens
+        // at most once after a `reset`. Otherwise, the engine is updated in place. A tone whose magnitude becomes
+        // zero is synthesized at zero magnitude, so no update moves the phasors of the other tones and an update
+        // takes effect alike whichever block it lands in.
+        if ( zeroMagnitudesCulled || ( compacted && !compactable() ) )
+        {
+            resetActiveEngine( false );
+            pActiveEngine->seek( currentSample );
+        }
+        else if ( compacted )
+        {
+            const auto pMag = magVector.get();
+            for ( size_t j = 0; numActiveHarmonics != j; ++j )
+            {
+                const auto i = activeHarmonics[j];
+                activeMagnitudes[j] = pMag ? pMag[i] : 1.0;
+                activePhases[j] = startPhases[i];
             }
+            pActiveEngine->updateParameters( activeMagnitudes.data(), newPhases ? activePhases.data() : nullptr );
         }
+        else
+            pActiveEngine->updateParameters( magVector.get(), newPhases ? phaseVector.get() : nullptr );
+    }
+
+    double crossfadeRamp( size_t sampleIndex ) const
+    {
+        // The last sample of the crossfade, and any after it, are at the new magnitudes.
+        return std::min( double( sampleIndex - crossfadeStartSample + 1 ) / double( crossfadeSamples ), 1.0 );
+    }
+
+    void fillCrossfadeMatrix( size_t currentSample, size_t numSamples, size_t firstHarmonic, size_t numRangeHarmonics,
+                              double * pMatrix, size_t stride ) const
+    {
+        const auto pTo = magVector.get();
+        const auto pFrom = crossfadeFrom.data() + firstHarmonic;
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            const auto ramp = crossfadeRamp( currentSample + n );
+            auto pRow = pMatrix + n * stride;
+            for ( size_t h = 0; numRangeHarmonics != h; ++h )
+            {
+                const auto to = pTo ? pTo[ firstHarmonic + h ] : 1.0;
+                pRow[h] = ramp < 1.0 ? pFrom[h] + ( to - pFrom[h] ) * ramp : to;
+            }
+        }
+    }
+
+    void discardParameterUpdates()
+    {
+        crossfadeSamples = 0;
+        sharedBlock.fetch_and( ~freshBlockFlag, std::memory_order_relaxed );
+    }
+
+    void recordStartPhases()
+    {
+        // Starting phases are retained for retuning. They are those of the phase vector until retuned.
+        const auto pPhase = phaseVector.get();
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            startPhases[i] = pPhase ? pPhase[i] : 0.0;
+        retuned = false;
+    }
+
+    void retune( double newFundamentalRadiansPerSample )
+    {
+        if ( chirped || toneBank )
+            throw std::logic_error{ "Only a harmonic series at a constant fundamental rate may be retuned!" };
+
+        // Each harmonic continues from its phase at the current sample count, as if it had been started
+        // at the new rate with a different starting phase.
+        const auto currentSample = pActiveEngine->getSampleCount();
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            startPhases[i] = PhaseArithmetic::retunedPhase( startPhases[i], double(i+1) * fundamentalRate,
+                                                            double(i+1) * newFundamentalRadiansPerSample,
+                                                            currentSample );
+        fundamentalRate = newFundamentalRadiansPerSample;
+        retuned = true;
+
+        // The tones culled at or beyond Nyquist change with the rate. While culling, the engine is reset for
+        // the tones remaining and moved to the current sample.
+        if ( nyquistCulling || numActiveHarmonics != numHarmonics )
+        {
+            resetActiveEngine();
+            pActiveEngine->seek( currentSample );
+        }
+        else
+            pActiveEngine->retune( fundamentalRate, startPhases.data() );
+    }
+
+    void skipSamples( size_t numSamples )
+    {
+        pActiveEngine->seek( pActiveEngine->getSampleCount() + numSamples );
+    }
+
+    void seekTo( size_t sampleIndex )
+    {
+        pActiveEngine->seek( sampleIndex );
     }
 
     void reset()
     {
-        // Reset all harmonic generators. We do not want them to contain garbage.
-        for (size_t i = 0; maxHarmonics != i; ++i )
-            harmonicGenerators[i].reset();
+        // Reset the engines. We do not want them to contain garbage.
+        for ( auto & pEngine : engines )
+            if ( pEngine ) pEngine->reset();
+        activate( defaultActiveEngineType() );
 
         // Reset other attributes as if just constructed
         numHarmonics = 0;
+        numActiveHarmonics = 0;
+        fundamentalRate = 0.0;
+        chirped = false;
+        chirp = CombGeneratorChirpType{};
+        toneBank = false;
         magVector = nullptr;
-        envelopeFunk = CombGeneratorEnvelopeFunkType{};
+        phaseVector = nullptr;
+        envelope = HarmonicEnvelope{};
+        maskedEnvelope = HarmonicEnvelope{};
+        commonEnvelopeFunk = nullptr;
+        discardParameterUpdates();
+        clearEvents();
+        displacedMagVector = nullptr;
+    }
+
+    void cloneInto( Imple & another ) const
+    {
+        // The clone was constructed for our active engine type. Reset it as we were and
+        // leave it pending our engine type.
+        // Once retuned, or once a harmonic is enabled, the starting phases are no longer those of the phase vector.
+        // The clone gets its own.
+        auto clonePhaseVector = phaseVector;
+        if ( retuned )
+        {
+            std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+            std::copy( startPhases.begin(), startPhases.begin() + std::ptrdiff_t( numHarmonics ), phases.get() );
+            clonePhaseVector = CombGeneratorScalarVectorType{ std::move( phases ) };
+        }
+        // Magnitudes of our own are written in place. The clone gets its own.
+        auto cloneMagVector = magVector;
+        if ( magVector == ownMagVector )
+        {
+            std::unique_ptr< double[] > mags{ new double[ numHarmonics ] };
+            std::copy( magVector.get(), magVector.get() + numHarmonics, mags.get() );
+            cloneMagVector = CombGeneratorScalarVectorType{ std::move( mags ) };
+        }
+        another.nyquistCulling = nyquistCulling;
+        another.gate = gate;
+        another.periodicGate = periodicGate;
+        another.toggledGate = toggledGate;
+        another.gateToggles = gateToggles;
+        if ( numHarmonics )
+            another.reset( numHarmonics, fundamentalRate, cloneMagVector, clonePhaseVector,
+                           envelope.envelopeFunk, envelope.batchEnvelopeFunk, chirped ? &chirp : nullptr,
+                           toneBank ? toneRates.data() : nullptr, envelope.segmentEnvelopeFunk, commonEnvelopeFunk );
+        another.seekTo( pActiveEngine->getSampleCount() );
+        another.setEngineType( engineType );
     }
 
     const size_t maxHarmonics;
-    std::vector< FlyingPhasorToneGenerator > harmonicGenerators;
+    CombGeneratorKernelVariant kernelVariant{};    // Set by kernel table selection during construction.
+    const FusedKernel::KernelTable & kernelTable;
+    std::unique_ptr< HarmonicEngine > engines[ size_t( CombGeneratorEngineType::Automatic ) ]{};
+    std::unique_ptr< WorkerPool > pWorkerPool{};
+    std::vector< FlyingPhasorElementType, AlignedAllocator< FlyingPhasorElementType > > partialBuffers{};
+    const size_t minToneSamplesPerThread;
+    HarmonicEngine * pActiveEngine{};
+    CombGeneratorEngineType engineType{};
+    CombGeneratorEngineType activeEngineType{};
     CombGeneratorScalarVectorType magVector{};
-    CombGeneratorEnvelopeFunkType envelopeFunk{};
+    CombGeneratorScalarVectorType phaseVector{};
+    HarmonicEnvelope envelope{};
+    HarmonicEnvelope maskedEnvelope{};          // The envelope applied, muting muted harmonics.
+    AlignedScalarVector envelopeMatrix{};
+    CombGeneratorCommonEnvelopeFunkType commonEnvelopeFunk{};
+    std::vector< FlyingPhasorElementType, AlignedAllocator< FlyingPhasorElementType > > commonBuffer{};
+    std::vector< CombGeneratorSingleElementType, AlignedAllocator< CombGeneratorSingleElementType > >
+        commonSingleBuffer{};
+    ParameterBlock parameterBlocks[ 3 ]{};
+    std::atomic< size_t > sharedBlock{ 1 };     // The block exchanged between threads, with the fresh flag.
+    size_t publisherBlock{ 0 };                 // The block owned by the publishing thread.
+    size_t adoptedBlock{ 2 };                   // The block owned by the generating thread.
+    HarmonicEnvelope crossfadeEnvelope{};
+    AlignedScalarVector crossfadeFrom{};
+    size_t crossfadeStartSample{};
+    size_t crossfadeSamples{};
+    AlignedScalarVector startPhases;
+    bool retuned{};
+    CombGeneratorChirpType chirp{};
+    bool chirped{};
+    AlignedScalarVector toneRates;
+    bool toneBank{};
+    double fundamentalRate{};
+    std::vector< size_t > activeHarmonics;
+    AlignedScalarVector activeRates;
+    AlignedScalarVector activeMagnitudes;
+    AlignedScalarVector activePhases;
+    bool nyquistCulling{};
+    CombGeneratorGateType gate{};
+    bool periodicGate{};
+    bool toggledGate{};
+    std::vector< size_t > gateToggles{};
+    std::vector< CombGeneratorEventType > events{};
+    size_t nextEvent{};                         // The first event pending.
+    std::shared_ptr< double[] > ownMagnitudes;
+    CombGeneratorScalarVectorType ownMagVector;         // Our own magnitudes, as a magnitude vector.
+    CombGeneratorScalarVectorType displacedMagVector{};
+    AlignedScalarVector nominalMagnitudes;
+    std::vector< bool > mutedHarmonics;
+    size_t numActiveHarmonics{};
+    bool zeroMagnitudesCulled{};                // Tones were culled for zero magnitude at the last engine reset.
+    bool compacted{};                           // The active tones are compacted into a tone bank.
     size_t numHarmonics{};
 };
 
 CombGenerator::CombGenerator( size_t maxHarmonics )
-  : pImple{ new Imple{ maxHarmonics } }
+  : pImple{ new Imple{ maxHarmonics, CombGeneratorEngineType::PhasorBank } }
+{
+}
+
+CombGenerator::CombGenerator( size_t maxHarmonics, CombGeneratorEngineType engineType )
+  : pImple{ new Imple{ maxHarmonics, engineType } }
+{
+}
+
+CombGenerator::CombGenerator( size_t maxHarmonics, CombGeneratorEngineType engineType,
+                              size_t numThreads, size_t minToneSamplesPerThread )
+  : pImple{ new Imple{ maxHarmonics, engineType, numThreads, minToneSamplesPerThread } }
 {
 }
 
@@ -204,22 +1203,173 @@ CombGenerator & CombGenerator::operator =( CombGenerator && another ) noexcept
     return *this;
 }
 
+CombGenerator CombGenerator::clone() const
+{
+    CombGenerator another{ pImple->maxHarmonics, pImple->activeEngineType };
+    pImple->cloneInto( *another.pImple );
+    return another;
+}
+
 void CombGenerator::reset(size_t numHarmonics, double fundamentalRadiansPerSample,
                           const CombGeneratorScalarVectorType & magVector, const CombGeneratorScalarVectorType & phaseVector,
                           const CombGeneratorEnvelopeFunkType & envelopeFunk )
 {
     pImple->reset( numHarmonics, fundamentalRadiansPerSample,
-                   magVector, phaseVector, envelopeFunk );
+                   magVector, phaseVector, envelopeFunk, CombGeneratorBatchEnvelopeFunkType{} );
+}
+
+void CombGenerator::reset( size_t numTones, const CombGeneratorScalarVectorType & rateVector,
+                           const CombGeneratorScalarVectorType & magVector,
+                           const CombGeneratorScalarVectorType & phaseVector,
+                           const CombGeneratorEnvelopeFunkType & envelopeFunk )
+{
+    if ( !rateVector )
+        throw std::invalid_argument{ "A tone bank requires a rate vector!" };
+
+    pImple->reset( numTones, 0.0, magVector, phaseVector, envelopeFunk, CombGeneratorBatchEnvelopeFunkType{},
+                   nullptr, rateVector.get() );
+}
+
+void CombGenerator::reset( size_t numTones, double offsetRadiansPerSample, double spacingRadiansPerSample,
+                           const CombGeneratorScalarVectorType & magVector,
+                           const CombGeneratorScalarVectorType & phaseVector,
+                           const CombGeneratorEnvelopeFunkType & envelopeFunk )
+{
+    pImple->resetOffsetComb( numTones, offsetRadiansPerSample, spacingRadiansPerSample,
+                             magVector, phaseVector, envelopeFunk );
+}
+
+void CombGenerator::resetWithBatchEnvelope( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                            const CombGeneratorScalarVectorType & magVector,
+                                            const CombGeneratorScalarVectorType & phaseVector,
+                                            const CombGeneratorBatchEnvelopeFunkType & batchEnvelopeFunk )
+{
+    pImple->reset( numHarmonics, fundamentalRadiansPerSample,
+                   magVector, phaseVector, CombGeneratorEnvelopeFunkType{}, batchEnvelopeFunk );
+}
+
+void CombGenerator::resetWithSegmentEnvelope( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                              const CombGeneratorScalarVectorType & magVector,
+                                              const CombGeneratorScalarVectorType & phaseVector,
+                                              const CombGeneratorSegmentEnvelopeFunkType & segmentEnvelopeFunk )
+{
+    pImple->reset( numHarmonics, fundamentalRadiansPerSample, magVector, phaseVector, CombGeneratorEnvelopeFunkType{},
+                   CombGeneratorBatchEnvelopeFunkType{}, nullptr, nullptr, segmentEnvelopeFunk );
+}
+
+void CombGenerator::resetWithCommonEnvelope( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                             const CombGeneratorScalarVectorType & magVector,
+                                             const CombGeneratorScalarVectorType & phaseVector,
+                                             const CombGeneratorCommonEnvelopeFunkType & commonEnvelopeFunk )
+{
+    pImple->reset( numHarmonics, fundamentalRadiansPerSample, magVector, phaseVector, CombGeneratorEnvelopeFunkType{},
+                   CombGeneratorBatchEnvelopeFunkType{}, nullptr, nullptr, CombGeneratorSegmentEnvelopeFunkType{},
+                   commonEnvelopeFunk );
+}
+
+void CombGenerator::resetWithChirp( size_t numHarmonics, const CombGeneratorChirpType & chirp,
+                                    const CombGeneratorScalarVectorType & magVector,
+                                    const CombGeneratorScalarVectorType & phaseVector,
+                                    const CombGeneratorBatchEnvelopeFunkType & batchEnvelopeFunk )
+{
+    pImple->reset( numHarmonics, chirp.startRadiansPerSample,
+                   magVector, phaseVector, CombGeneratorEnvelopeFunkType{}, batchEnvelopeFunk, &chirp );
+}
+
+void CombGenerator::publishParameters( const CombGeneratorScalarVectorType & magVector,
+                                       const CombGeneratorScalarVectorType & phaseVector, size_t crossfadeSamples )
+{
+    pImple->publishParameters( magVector, phaseVector, crossfadeSamples );
+}
+
+void CombGenerator::retune( double newFundamentalRadiansPerSample )
+{
+    pImple->retune( newFundamentalRadiansPerSample );
 }
 
 void CombGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
 {
-    pImple->getSamples( pElementBuffer, numSamples );
+    pImple->produceSamples( pElementBuffer, numSamples, false );
 }
 
 void CombGenerator::accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
 {
-    pImple->accumSamples( pElementBuffer, numSamples );
+    pImple->produceSamples( pElementBuffer, numSamples, true );
+}
+
+void CombGenerator::getSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->produceSamples( pElementBuffer, numSamples, false );
+}
+
+void CombGenerator::accumSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->produceSamples( pElementBuffer, numSamples, true );
+}
+
+void CombGenerator::setGate( const CombGeneratorGateType & gate )
+{
+    pImple->setGate( gate );
+}
+
+void CombGenerator::setGate( const size_t * pToggleSamples, size_t numToggles )
+{
+    pImple->setGate( pToggleSamples, numToggles );
+}
+
+void CombGenerator::clearGate()
+{
+    pImple->clearGate();
+}
+
+bool CombGenerator::isGated() const
+{
+    return pImple->periodicGate || pImple->toggledGate;
+}
+
+void CombGenerator::reserveEvents( size_t capacity )
+{
+    pImple->events.reserve( capacity );
+}
+
+void CombGenerator::scheduleEvent( const CombGeneratorEventType & event )
+{
+    pImple->scheduleEvent( event );
+}
+
+void CombGenerator::clearEvents()
+{
+    pImple->clearEvents();
+}
+
+size_t CombGenerator::getNumPendingEvents() const
+{
+    return pImple->events.size() - pImple->nextEvent;
+}
+
+void CombGenerator::enableHarmonic( size_t nHarmonic, double magnitude, double startPhase )
+{
+    pImple->enableHarmonic( nHarmonic, magnitude, startPhase );
+}
+
+void CombGenerator::disableHarmonic( size_t nHarmonic )
+{
+    pImple->disableHarmonic( nHarmonic );
+}
+
+void CombGenerator::skipSamples( size_t numSamples )
+{
+    pImple->skipSamples( numSamples );
+}
+
+void CombGenerator::seekTo( size_t sampleIndex )
+{
+    pImple->seekTo( sampleIndex );
+}
+
+size_t CombGenerator::getSampleCount() const
+{
+    return pImple->pActiveEngine->getSampleCount();
 }
 
 void CombGenerator::reset()
@@ -231,3 +1381,48 @@ size_t CombGenerator::getNumHarmonics() const
 {
     return pImple->numHarmonics;
 }
+
+size_t CombGenerator::getNumActiveHarmonics() const
+{
+    return pImple->numActiveHarmonics;
+}
+
+void CombGenerator::setNyquistCulling( bool enable )
+{
+    pImple->nyquistCulling = enable;
+}
+
+bool CombGenerator::getNyquistCulling() const
+{
+    return pImple->nyquistCulling;
+}
+
+CombGeneratorEngineType CombGenerator::getEngineType() const
+{
+    return pImple->engineType;
+}
+
+void CombGenerator::setEngineType( CombGeneratorEngineType engineType )
+{
+    pImple->setEngineType( engineType );
+}
+
+CombGeneratorEngineType CombGenerator::getActiveEngineType() const
+{
+    return pImple->activeEngineType;
+}
+
+size_t CombGenerator::getNumThreads() const
+{
+    return pImple->pWorkerPool ? pImple->pWorkerPool->getNumWorkers() : 1;
+}
+
+CombGeneratorKernelVariant CombGenerator::getKernelVariant() const
+{
+    return pImple->kernelVariant;
+}
+
+void CombGenerator::setKernelVariantOverride( CombGeneratorKernelVariant variant )
+{
+    FusedKernel::setKernelVariantOverride( variant );
+}
@@ -13,6 +13,15 @@
 
 #include "CombGeneratorScalarVectorTypeFwd.h"
 #include "CombGeneratorEnvelopeFunkType.h"
+#include "CombGeneratorBatchEnvelopeFunkType.h"
+#include "CombGeneratorSegmentEnvelopeFunkType.h"
+#include "CombGeneratorCommonEnvelopeFunkType.h"
+#include "CombGeneratorEngineType.h"
+#include "CombGeneratorKernelVariant.h"
+#include "CombGeneratorSingleElementType.h"
+#include "CombGeneratorChirpType.h"
+#include "CombGeneratorGateType.h"
+#include "CombGeneratorEventType.h"
 #include "FlyingPhasorToneGeneratorDataTypes.h"
 
 namespace ReiserRT
@@ -29,6 +38,9 @@ namespace ReiserRT
          *
          * The CombGenerator also provides support for individually modulating the tones produced through
          * an envelope functor interface, optionally specified at `reset` time.
+         *
+         * The synthesis engine is selected at construction time. By default, harmonics are accumulated
+         * one ReiserRT_FlyingPhasor at a time. Alternative engines are described by CombGeneratorEngineType.
          */
         class ReiserRT_CombGenerator_EXPORT CombGenerator
         {
@@ -58,6 +70,50 @@ namespace ReiserRT
              */
             explicit CombGenerator( size_t maxHarmonics = 0 );
 
+            /**
+             * @brief Qualified Constructor with Engine Selection
+             *
+             * This constructor instantiates the implementation utilizing the specified synthesis engine
+             * for a maximum number of harmonics required of the instance during its lifetime.
+             * This `maxHarmonics` is inclusive of any fundamental frequency.
+             *
+             * @param maxHarmonics The maximum number of harmonics that an instance will support (fundamental included)
+             * during its lifetime.
+             * @param engineType The synthesis engine to utilize.
+             * @see CombGeneratorEngineType for the engines available and how their results compare.
+             */
+            CombGenerator( size_t maxHarmonics, CombGeneratorEngineType engineType );
+
+            /**
+             * @brief The Default Minimum Work per Thread, in Harmonic Tone Samples
+             */
+            static constexpr size_t defaultMinToneSamplesPerThread = 262144;
+
+            /**
+             * @brief Qualified Constructor with Engine Selection and Worker Threads
+             *
+             * This constructor additionally creates `numThreads - 1` worker threads, the invoking thread being
+             * the remaining one, along with a pair of cache aligned partial buffers per thread. With more than one
+             * thread, double precision `getSamples` and `accumSamples` invocations divide the harmonics into
+             * contiguous ranges, one per thread. Each thread synthesizes its range into its own partial buffer, a tile
+             * of 2048 samples at a time. All threads then reduce a slice of each tile into the user buffer, summing
+             * the partials in harmonic range order. Results are deterministic and differ from single threaded
+             * results only by the order of summation.
+             *
+             * Harmonic partitioning applies to the PhasorBank and FusedKernel engines. Other engines, and single
+             * precision samples, are synthesized by the invoking thread alone.
+             *
+             * @param maxHarmonics The maximum number of harmonics that an instance will support (fundamental included)
+             * during its lifetime.
+             * @param engineType The synthesis engine to utilize.
+             * @param numThreads The number of threads, inclusive of the invoking thread.
+             * @param minToneSamplesPerThread The minimum work per thread, the number of harmonics times
+             * the number of samples. Invocations with less work utilize fewer threads.
+             * @see CombGeneratorEnvelopeFunkType for which threads invoke an envelope functor.
+             */
+            CombGenerator( size_t maxHarmonics, CombGeneratorEngineType engineType, size_t numThreads,
+                           size_t minToneSamplesPerThread = defaultMinToneSamplesPerThread );
+
             /**
              * @brief Destructor
              *
@@ -103,6 +159,22 @@ namespace ReiserRT
              */
             CombGenerator & operator =( CombGenerator && another ) noexcept;
 
+            /**
+             * @brief Clone Operation
+             *
+             * This operation instantiates another CombGenerator for the same maximum number of harmonics, resets it
+             * with the generation parameters of the last `reset` and seeks it to the current sample count.
+             * The clone utilizes the same engine as this instance and is pending the same engine type.
+             * The clone has no worker threads of its own.
+             * Magnitude and phase vectors are shared, not copied.
+             *
+             * @warning The envelope functor is copied. Clones of a functor wrapping a reference, by `std::ref` for
+             * example, refer to the same object. Such a functor must not be invoked by several clones concurrently.
+             *
+             * @return A new CombGenerator instance, positioned where this instance is.
+             */
+            [[nodiscard]] CombGenerator clone() const;
+
             /**
              * @brief The Reset Operation with Specific Generation Parameters
              *
@@ -123,12 +195,15 @@ namespace ReiserRT
              * this seemed wasteful. Also considered was just storing the data address and trusting the client
              * to maintain the storage but, this seemed unsafe. Reference counting seemed the best choice.
              * The phase vector does not have the same requirements but, we don't want
-             * to use different semantics for it. That would be confusing.
+             * to use different semantics for it. That would be confusing. A reference to it is retained
+             * for the `clone` operation.
              * @see CombGeneratorScalarVectorType
              *
              * @param numHarmonics The number of harmonics to generate. Must be less than or equal to
              * the maximum specified during construction.
              * @throw std::length_error If numHarmonics exceeds the maximum specified during construction.
+             * @throw std::invalid_argument If constructed for the `CombGeneratorEngineType::ClosedForm` engine
+             * and the generation parameters do not form a geometric series or an envelope functor is specified.
              * @note It is not recommended that you use this operation on default constructed CombGenerator instance
              * as a `numHarmonics` value of just 1 will throw.
              * @param pMagVector This argument provides a series of magnitude values, of minimum length `numHarmonics`.
@@ -150,12 +225,287 @@ namespace ReiserRT
              * @see CombGeneratorEnvelopeFunkType for callback interface details.
              * @warning Functor `envelopeFunk` will be copied for subsequent usage by `getSamples`
              * This copy must remain viable until subsequent `reset` of the CombGenerator.
+             * @note Should `envelopeFunk` throw, the exception propagates from `getSamples`, even when the
+             * harmonics are divided amongst threads. The samples delivered and the harmonic state are then
+             * unspecified until a subsequent `reset`.
              */
             void reset( size_t numHarmonics, double fundamentalRadiansPerSample,
                          const CombGeneratorScalarVectorType & magVector,
                          const CombGeneratorScalarVectorType & phaseVector,
                          const CombGeneratorEnvelopeFunkType & envelopeFunk = CombGeneratorEnvelopeFunkType{} );
 
+            /**
+             * @brief The Reset Operation for a Bank of Tones at Arbitrary Rates
+             *
+             * This operation is identical to the `reset` operation above except that each tone's rate is taken
+             * from `rateVector` rather than being a multiple of a fundamental. This serves inharmonic series, such
+             * as stretched partials, and arbitrary tone lists. Tones are synthesized by the same accumulation
+             * engines as harmonics. Envelope functors see tone indices where they would see harmonic indices.
+             *
+             * Only the PhasorBank and FusedKernel engines take arbitrary rates. The FusedKernel engine stands
+             * in for the InverseFft and Automatic engine types. A tone bank may not be retuned. Magnitudes and
+             * starting phases may be published as for a harmonic series.
+             *
+             * @param numTones The number of tones to generate. Must be less than or equal to
+             * the maximum specified during construction.
+             * @param rateVector A series of tone rates in radians per sample, of minimum length `numTones`.
+             * The rates are copied. The vector is not retained.
+             * @param magVector A series of magnitude values, of minimum length `numTones`, which may be empty.
+             * @param phaseVector A series of starting phase values, of minimum length `numTones`,
+             * which may be empty.
+             * @param envelopeFunk An optional envelope functor, as for the `reset` operation above.
+             * @throw std::length_error If numTones exceeds the maximum specified during construction.
+             * @throw std::invalid_argument If `rateVector` is empty or if constructed for the
+             * `CombGeneratorEngineType::ClosedForm` engine.
+             */
+            void reset( size_t numTones, const CombGeneratorScalarVectorType & rateVector,
+                        const CombGeneratorScalarVectorType & magVector,
+                        const CombGeneratorScalarVectorType & phaseVector,
+                        const CombGeneratorEnvelopeFunkType & envelopeFunk = CombGeneratorEnvelopeFunkType{} );
+
+            /**
+             * @brief The Reset Operation for an Offset Comb
+             *
+             * This operation is identical to the tone bank `reset` operation above with tone `i`, counting from zero,
+             * at `offsetRadiansPerSample + ( i + 1 ) * spacingRadiansPerSample`. A zero offset yields the harmonic
+             * series of a fundamental at the spacing, though as a tone bank. Rates are formed in place without
+             * allocation.
+             *
+             * @param numTones The number of tones to generate. Must be less than or equal to
+             * the maximum specified during construction.
+             * @param offsetRadiansPerSample The frequency offset of every tone in radians per sample.
+             * @param spacingRadiansPerSample The tone spacing in radians per sample.
+             * @param magVector A series of magnitude values, of minimum length `numTones`, which may be empty.
+             * @param phaseVector A series of starting phase values, of minimum length `numTones`,
+             * which may be empty.
+             * @param envelopeFunk An optional envelope functor, as for the `reset` operation above.
+             * @throw std::length_error If numTones exceeds the maximum specified during construction.
+             * @throw std::invalid_argument If constructed for the `CombGeneratorEngineType::ClosedForm` engine.
+             */
+            void reset( size_t numTones, double offsetRadiansPerSample, double spacingRadiansPerSample,
+                        const CombGeneratorScalarVectorType & magVector,
+                        const CombGeneratorScalarVectorType & phaseVector,
+                        const CombGeneratorEnvelopeFunkType & envelopeFunk = CombGeneratorEnvelopeFunkType{} );
+
+            /**
+             * @brief The Reset Operation with Specific Generation Parameters and a Batch Envelope Functor
+             *
+             * This operation is identical to the `reset` operation above except that envelopes are delivered
+             * by a batch envelope functor, for a whole range of harmonics per invocation, rather than by
+             * an envelope functor invoked once per harmonic. The PhasorBank and FusedKernel engines apply batch
+             * envelopes. Other engines defer to the FusedKernel engine as they do for an envelope functor.
+             * The first invocation allocates the envelope matrix.
+             *
+             * @param numHarmonics The number of harmonics to generate. Must be less than or equal to
+             * the maximum specified during construction.
+             * @param fundamentalRadiansPerSample The fundamental frequency in radians per sample.
+             * @param magVector A series of magnitude values, of minimum length `numHarmonics`, which may be empty.
+             * Magnitudes are not applied to batch envelopes. They are available to the `clone` operation.
+             * @param phaseVector A series of starting phase values, of minimum length `numHarmonics`,
+             * which may be empty.
+             * @param batchEnvelopeFunk Callback functor interface for delivering the magnitude envelopes of
+             * many harmonics at once. It is copied as `envelopeFunk` is by the `reset` operation above.
+             * @throw std::length_error If numHarmonics exceeds the maximum specified during construction.
+             * @throw std::invalid_argument If constructed for the `CombGeneratorEngineType::ClosedForm` engine
+             * and a non-empty `batchEnvelopeFunk` is specified.
+             * @see CombGeneratorBatchEnvelopeFunkType for callback interface details.
+             */
+            void resetWithBatchEnvelope( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                         const CombGeneratorScalarVectorType & magVector,
+                                         const CombGeneratorScalarVectorType & phaseVector,
+                                         const CombGeneratorBatchEnvelopeFunkType & batchEnvelopeFunk );
+
+            /**
+             * @brief The Reset Operation with Specific Generation Parameters and a Segment Envelope Functor
+             *
+             * This operation is identical to the `reset` operation above except that envelopes are delivered as
+             * piecewise linear segments, per harmonic, rather than as envelope buffers. The FusedKernel engine
+             * evaluates each segment's ramp as it synthesizes, so no envelope buffer is written or read. The PhasorBank
+             * engine expands segments into a small buffer of its own. Other engines defer to the FusedKernel engine
+             * as they do for an envelope functor.
+             *
+             * @param numHarmonics The number of harmonics to generate. Must be less than or equal to
+             * the maximum specified during construction.
+             * @param fundamentalRadiansPerSample The fundamental frequency in radians per sample.
+             * @param magVector A series of magnitude values, of minimum length `numHarmonics`, which may be empty.
+             * Magnitudes are passed to the functor as nominal magnitudes and are not otherwise applied.
+             * @param phaseVector A series of starting phase values, of minimum length `numHarmonics`,
+             * which may be empty.
+             * @param segmentEnvelopeFunk Callback functor interface for delivering the magnitude envelope segments
+             * of each harmonic. It is copied as `envelopeFunk` is by the `reset` operation above.
+             * @throw std::length_error If numHarmonics exceeds the maximum specified during construction.
+             * @throw std::invalid_argument If constructed for the `CombGeneratorEngineType::ClosedForm` engine
+             * and a non-empty `segmentEnvelopeFunk` is specified.
+             * @see CombGeneratorSegmentEnvelopeFunkType for callback interface details.
+             */
+            void resetWithSegmentEnvelope( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                           const CombGeneratorScalarVectorType & magVector,
+                                           const CombGeneratorScalarVectorType & phaseVector,
+                                           const CombGeneratorSegmentEnvelopeFunkType & segmentEnvelopeFunk );
+
+            /**
+             * @brief The Reset Operation with Specific Generation Parameters and a Common Envelope Functor
+             *
+             * This operation is identical to the `reset` operation above except that one envelope, common to every
+             * harmonic, is applied once per sample to the sum of the harmonics at their constant magnitudes.
+             * As harmonics remain at constant magnitudes, every engine applies a common envelope, and the engine
+             * in effect is selected as it is without an envelope. The first invocation allocates a buffer, of
+             * 2048 samples, into which sums are synthesized before being enveloped and accumulated.
+             *
+             * @param numHarmonics The number of harmonics to generate. Must be less than or equal to
+             * the maximum specified during construction.
+             * @param fundamentalRadiansPerSample The fundamental frequency in radians per sample.
+             * @param magVector A series of magnitude values, of minimum length `numHarmonics`, which may be empty.
+             * @param phaseVector A series of starting phase values, of minimum length `numHarmonics`,
+             * which may be empty.
+             * @param commonEnvelopeFunk Callback functor interface for delivering the envelope common to every
+             * harmonic. It is copied as `envelopeFunk` is by the `reset` operation above.
+             * @throw std::length_error If numHarmonics exceeds the maximum specified during construction.
+             * @see CombGeneratorCommonEnvelopeFunkType for callback interface details.
+             */
+            void resetWithCommonEnvelope( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                          const CombGeneratorScalarVectorType & magVector,
+                                          const CombGeneratorScalarVectorType & phaseVector,
+                                          const CombGeneratorCommonEnvelopeFunkType & commonEnvelopeFunk );
+
+            /**
+             * @brief The Reset Operation for a Chirped Harmonic Series
+             *
+             * This operation is identical to the `reset` operation above except that the fundamental frequency
+             * sweeps continuously, as described by `chirp`, and harmonic `k` sweeps at exactly `k` times its rate.
+             * Each harmonic's rotation is advanced every sample by a phasor recurrence within the fused kernel, of
+             * second order, or third order with a quadratic sweep. No trigonometry is evaluated per sample.
+             * Phase continuity holds across `getSamples` invocations. Phasors are re-anchored from the analytic chirp
+             * phase every 256 samples, and by `seekTo`, so recurrence error does not accumulate.
+             *
+             * Only the FusedKernel engine synthesizes chirps. It stands in for the InverseFft and Automatic engine
+             * types. Single precision samples are synthesized in double precision and converted. A chirped series
+             * may not be retuned. Magnitudes and starting phases may be published as for any other series.
+             *
+             * @param numHarmonics The number of harmonics to generate. Must be less than or equal to
+             * the maximum specified during construction.
+             * @param chirp The fundamental frequency sweep.
+             * @param magVector A series of magnitude values, of minimum length `numHarmonics`, which may be empty.
+             * @param phaseVector A series of starting phase values, of minimum length `numHarmonics`,
+             * which may be empty.
+             * @param batchEnvelopeFunk An optional batch envelope functor, as for `resetWithBatchEnvelope`.
+             * Per harmonic envelope functors are not supported for chirps.
+             * @throw std::length_error If numHarmonics exceeds the maximum specified during construction.
+             * @throw std::invalid_argument If constructed for the `CombGeneratorEngineType::PhasorBank` or
+             * `CombGeneratorEngineType::ClosedForm` engine.
+             */
+            void resetWithChirp( size_t numHarmonics, const CombGeneratorChirpType & chirp,
+                                 const CombGeneratorScalarVectorType & magVector,
+                                 const CombGeneratorScalarVectorType & phaseVector,
+                                 const CombGeneratorBatchEnvelopeFunkType & batchEnvelopeFunk =
+                                     CombGeneratorBatchEnvelopeFunkType{} );
+
+            /**
+             * @brief The Publish Parameters Operation
+             *
+             * This operation publishes new magnitudes, and optionally new starting phases, to be adopted at the
+             * start of the next `getSamples` or `accumSamples` invocation, without a `reset`. Harmonic phasors are
+             * not reset by new magnitudes, so phase continuity is retained, and a harmonic published at zero
+             * magnitude is not culled. A publication therefore takes effect alike whichever block adopts it, once
+             * any tones culled at `reset` are reinstated, as described for `getNumActiveHarmonics`. New starting
+             * phases apply from sample index zero, as they do for `reset`, and each harmonic moves to the phase it
+             * would have at the current sample count.
+             *
+             * Unlike any other operation, this one may be invoked while another thread is within `getSamples` or
+             * `accumSamples`. Parameters are exchanged through a triple buffer with atomic index swaps. The generating
+             * thread takes no locks, makes no allocations and releases no vectors. Those it is done with are released
+             * by the publishing thread on a later publication. Only the latest publication is adopted.
+             *
+             * An optional crossfade ramps each harmonic linearly from the magnitude in effect to the new one over
+             * `crossfadeSamples` samples, avoiding the click of an abrupt change. It is applied as a batch envelope,
+             * so it is ignored while an envelope functor is registered. The first publication with a crossfade
+             * allocates the envelope matrix.
+             *
+             * @note This operation must be invoked from one thread at a time and never concurrently with `reset`
+             * or any operation other than `getSamples` and `accumSamples`. A `reset` discards any publication
+             * not yet adopted, and any crossfade in progress.
+             *
+             * @param magVector A series of magnitude values, of minimum length `numHarmonics`, which may be empty.
+             * Passing an empty pointer results in a magnitude of 1.0 for all harmonic tones.
+             * @param phaseVector A series of starting phase values, of minimum length `numHarmonics`, which may be
+             * empty. Passing an empty pointer retains the starting phases in effect.
+             * @param crossfadeSamples The number of samples over which to crossfade the magnitudes, zero for none.
+             * @throw std::logic_error If the active engine is neither `CombGeneratorEngineType::PhasorBank` nor
+             * `CombGeneratorEngineType::FusedKernel`.
+             */
+            void publishParameters( const CombGeneratorScalarVectorType & magVector,
+                                    const CombGeneratorScalarVectorType & phaseVector, size_t crossfadeSamples = 0 );
+
+            /**
+             * @brief The Retune Operation
+             *
+             * This operation changes the fundamental frequency mid-stream, without a `reset`. Every harmonic keeps
+             * the phase it has at the current sample count and only its rate changes, so the sample series is
+             * phase continuous across the retune. Magnitudes, envelopes and the sample count are unaffected.
+             * The cost is proportional to the number of harmonics in use. Generators beyond those are not touched.
+             *
+             * Each harmonic's starting phase is recomputed as that which, at the new rate, yields its current phase
+             * at the current sample count. A subsequent `seekTo` therefore extrapolates at the new rate, in either
+             * direction. The FusedKernel engine retains its phasors and only replaces their rates. The PhasorBank
+             * and InverseFft engines restart their generators at the current phases. The ClosedForm engine retunes
+             * in constant time.
+             *
+             * @note This operation must not be invoked concurrently with `getSamples`, `accumSamples` or
+             * `publishParameters`. New starting phases published after a retune replace those it recomputed.
+             *
+             * @param fundamentalRadiansPerSample The new fundamental frequency in radians per sample.
+             * @throw std::logic_error If the harmonic series is chirped or is a tone bank.
+             */
+            void retune( double fundamentalRadiansPerSample );
+
+            /**
+             * @brief The Enable Harmonic Operation
+             *
+             * This operation sets the magnitude and starting phase of one harmonic, without a `reset`, and restarts
+             * it at the phase it has at the current sample count. Every other harmonic keeps its running phase, so the
+             * sample series is continuous. A harmonic beyond the number of harmonics extends the series. Any harmonics
+             * skipped over are added disabled. The starting phase applies from sample index zero, as it does for
+             * `reset`. For a tone bank, the tone keeps its rate and may not be beyond the number of tones.
+             *
+             * The cost is constant, with one exception. While tones are culled, the engine is reset for the tones
+             * remaining and moved to the current sample. The first change after a `reset`, or after magnitudes are
+             * published, takes over the magnitudes in effect, which costs as many harmonics as there are.
+             *
+             * An enabled harmonic is written into magnitudes of our own, as magnitude events are, and likewise replaced
+             * by magnitudes published by `publishParameters`.
+             *
+             * @note This operation must not be invoked concurrently with `getSamples`, `accumSamples` or
+             * `publishParameters`.
+             *
+             * @param nHarmonic The zero based harmonic to enable.
+             * @param magnitude The magnitude of the harmonic.
+             * @param startPhase The phase of the harmonic at sample index zero.
+             * @throw std::length_error If the harmonic is not less than the maximum number of harmonics
+             * constructed for.
+             * @throw std::logic_error If the active engine is neither `CombGeneratorEngineType::PhasorBank` nor
+             * `CombGeneratorEngineType::FusedKernel`, if the series is chirped, or if a tone bank would be extended.
+             */
+            void enableHarmonic( size_t nHarmonic, double magnitude, double startPhase );
+
+            /**
+             * @brief The Disable Harmonic Operation
+             *
+             * This operation silences one harmonic, without a `reset`. Its magnitude is retained as it would be for a
+             * mute event. Every other harmonic keeps its running phase. The cost is constant, as for `enableHarmonic`.
+             * Without an envelope functor, the harmonic is still synthesized, at zero magnitude, until tones are next
+             * culled. With one, the functor is not consulted for the harmonic, which is muted as if the functor had
+             * muted it, whatever the functor would make of its nominal magnitude.
+             *
+             * @note This operation must not be invoked concurrently with `getSamples`, `accumSamples` or
+             * `publishParameters`.
+             *
+             * @param nHarmonic The zero based harmonic to disable.
+             * @throw std::invalid_argument If the harmonic is not less than the number of harmonics.
+             * @throw std::logic_error If the active engine is neither `CombGeneratorEngineType::PhasorBank` nor
+             * `CombGeneratorEngineType::FusedKernel`.
+             */
+            void disableHarmonic( size_t nHarmonic );
+
             /**
              * @brief Get Samples Operation
              *
@@ -182,6 +532,172 @@ namespace ReiserRT
              */
             void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
 
+            /**
+             * @brief Get Samples Operation, Single Precision
+             *
+             * This operation delivers 'N' number of single precision samples from the CombGenerator into the
+             * user provided buffer overwriting the buffers content. It may be freely interleaved with the
+             * double precision form. The sample series continues uninterrupted across the two.
+             *
+             * The FusedKernel engine computes natively in single precision, at twice the vector width, when
+             * no envelope functor is registered. Single precision phasors are re-anchored from the double precision
+             * state every 32 samples, so phase error does not grow over time. Results are within 2e-6 of the sum of
+             * the harmonic magnitudes of the double precision results. All other cases synthesize in double precision
+             * and convert, a chunk at a time. A non-empty `envelopeFunk` is invoked once per harmonic per chunk.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation, Single Precision
+             *
+             * This operation accumulates 'N' number of single precision samples from the CombGenerator onto the
+             * user provided buffer. Otherwise, it behaves as the single precision `getSamples` does.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void accumSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Set a Periodic Gate
+             *
+             * This operation gates subsequently produced samples, as for a pulsed emission with a given duty cycle.
+             * While the gate is off, `getSamples` writes zeros and `accumSamples` leaves the buffer as it is.
+             * No harmonic is synthesized. Instead, each harmonic's phase jumps over the off interval, as `seekTo`
+             * does at a cost proportional to the number of harmonics, so each pulse is coherent with the last.
+             * Envelope functors are not invoked for samples while the gate is off. Their `currentSample` continues
+             * from the next sample on. The gate remains in effect across `reset` until cleared, and is carried over
+             * by `clone`.
+             *
+             * @note This operation must not be invoked concurrently with `getSamples` or `accumSamples`.
+             *
+             * @param gate The periodic gate.
+             * @throw std::invalid_argument If the pulse repetition interval is zero or less than the pulse width.
+             * @see CombGeneratorGateType
+             */
+            void setGate( const CombGeneratorGateType & gate );
+
+            /**
+             * @brief Set a Gate of Explicit Toggles
+             *
+             * As the periodic form above, except that the gate is off before the first toggle sample and toggles at
+             * each toggle sample, on then off. It remains as it is after the last toggle sample. An empty list
+             * leaves the gate off. The toggle samples are copied, which allocates.
+             *
+             * @param pToggleSamples Pointer to `numToggles` strictly ascending sample indices.
+             * @param numToggles The number of toggle samples.
+             * @throw std::invalid_argument If the toggle samples are not strictly ascending.
+             */
+            void setGate( const size_t * pToggleSamples, size_t numToggles );
+
+            /**
+             * @brief Clear the Gate
+             *
+             * This operation removes any gate. Samples are then produced continuously. This is the state after
+             * construction.
+             */
+            void clearGate();
+
+            /**
+             * @brief Query Whether a Gate is in Effect
+             *
+             * @return True if a periodic gate or a gate of explicit toggles is set.
+             */
+            [[nodiscard]] bool isGated() const;
+
+            /**
+             * @brief Reserve Event Queue Capacity
+             *
+             * This operation preallocates the event queue for `capacity` pending events, so that scheduling
+             * that many makes no allocation. The queue never allocates while samples are being produced.
+             *
+             * @param capacity The number of pending events to make room for.
+             */
+            void reserveEvents( size_t capacity );
+
+            /**
+             * @brief Schedule an Event
+             *
+             * This operation queues a parameter change to take effect at an exact sample index, which may fall in
+             * the middle of a `getSamples` or `accumSamples` buffer. Those operations split their work at event
+             * sample indices and apply each event between the pieces, without a `reset`. Events are kept in time
+             * order. Events scheduled for the same sample index are applied in the order scheduled. An event whose
+             * sample index has been passed, by seeking, is applied before the next sample is produced.
+             *
+             * A retune event is phase continuous, as `retune` is. Magnitude events update the magnitudes in place
+             * and do not disturb the phases. Each costs a constant, unless tones are culled, as for `disableHarmonic`.
+             * The first magnitude event applied after a `reset` copies the magnitudes in effect into magnitudes of
+             * our own, allocated at construction, which then replace the magnitude vector. While an envelope functor
+             * is registered, these are the nominal magnitudes passed to it, and a muted harmonic is muted as if the
+             * functor had muted it, without consulting the functor. Magnitudes published by `publishParameters`
+             * replace them and unmute every harmonic.
+             *
+             * A `reset` discards pending events, as well as any mutes. Events are not carried over by `clone`.
+             *
+             * @note This operation must not be invoked concurrently with `getSamples` or `accumSamples`.
+             * Unless reserved for, scheduling may allocate.
+             *
+             * @param event The event to schedule.
+             * @throw std::invalid_argument If the sample index has already been produced, or the harmonic acted upon
+             * is not less than the number of harmonics.
+             * @throw std::logic_error If a retune is scheduled for a chirped series or a tone bank, or a magnitude
+             * event is scheduled for an engine other than `CombGeneratorEngineType::PhasorBank` or
+             * `CombGeneratorEngineType::FusedKernel`.
+             * @see CombGeneratorEventType
+             */
+            void scheduleEvent( const CombGeneratorEventType & event );
+
+            /**
+             * @brief Clear the Event Queue
+             *
+             * This operation discards every pending event. Changes already applied remain in effect.
+             */
+            void clearEvents();
+
+            /**
+             * @brief Query the Number of Pending Events
+             *
+             * @return The number of events scheduled but not yet applied.
+             */
+            [[nodiscard]] size_t getNumPendingEvents() const;
+
+            /**
+             * @brief Skip Samples Operation
+             *
+             * This operation advances the CombGenerator by 'N' samples without producing them. It is equivalent
+             * to a `seekTo` the current sample count plus `numSamples`.
+             *
+             * @param numSamples The number of samples to skip over.
+             */
+            void skipSamples( size_t numSamples );
+
+            /**
+             * @brief Seek To Operation
+             *
+             * This operation moves every harmonic tone to the given sample index, relative to the last `reset`,
+             * without producing any samples. Each harmonic's phase is computed directly from its starting phase,
+             * its rate and the sample index, so the cost is proportional to the number of harmonics and independent
+             * of the distance moved. Seeking backwards is permitted. A registered envelope functor sees
+             * `currentSample` continue from the sample index on subsequent `getSamples` invocations.
+             *
+             * @note Samples produced after a seek are within the accuracy documented for the engine in effect of
+             * those that would have been produced by getting every sample in between. They are not bit identical.
+             *
+             * @param sampleIndex The sample index of the next sample to be produced.
+             */
+            void seekTo( size_t sampleIndex );
+
+            /**
+             * @brief Query the Current Sample Count
+             *
+             * @return The sample index of the next sample to be produced. That is the number of samples
+             * produced, or skipped over, since the last `reset`.
+             */
+            [[nodiscard]] size_t getSampleCount() const;
+
             /**
              * @brief The Reset Operation No Generation Parameters (Pure Reset)
              *
@@ -205,6 +721,110 @@ namespace ReiserRT
              */
             [[nodiscard]] size_t getNumHarmonics() const;
 
+            /**
+             * @brief Query the Number of Active Harmonics
+             *
+             * At `reset`, harmonic tones contributing nothing are culled from synthesis. The engine in effect then
+             * visits only the active tones in its inner loop. Tones of zero magnitude are culled by the PhasorBank
+             * and FusedKernel engines when no envelope functor is registered, as an envelope replaces the magnitude.
+             * Tones at or beyond Nyquist, pi radians per sample either side of zero, are culled when Nyquist culling
+             * is enabled. Tones are never culled from a chirp. Where tones cannot be compacted, because an envelope
+             * functor, a crossfade or an engine addresses them by index, only those following the last active tone
+             * are culled.
+             *
+             * Tones are culled anew by a `retune`. Magnitudes published, or changed by events or `disableHarmonic`,
+             * are applied in place: a tone whose magnitude becomes zero stays active at zero magnitude, so the other
+             * tones keep their phasors. The first such change after a `reset` reinstates any tones culled for zero
+             * magnitude, as does a crossfade for compacted tones, by resetting the engine at the current sample.
+             *
+             * @return The number of harmonic tones synthesized, never more than `getNumHarmonics`.
+             */
+            [[nodiscard]] size_t getNumActiveHarmonics() const;
+
+            /**
+             * @brief Enable or Disable Nyquist Culling
+             *
+             * When enabled, harmonic tones at or beyond Nyquist, which would only alias, are culled. It takes effect
+             * at the next `reset` with generation parameters, or `retune`. It is disabled at construction and
+             * carried over by `clone`.
+             *
+             * @param enable True to cull tones at or beyond Nyquist.
+             */
+            void setNyquistCulling( bool enable );
+
+            /**
+             * @brief Query Whether Nyquist Culling is Enabled
+             *
+             * @return True if tones at or beyond Nyquist are culled.
+             */
+            [[nodiscard]] bool getNyquistCulling() const;
+
+            /**
+             * @brief Query the Number of Threads
+             *
+             * @return The number of threads specified at construction, inclusive of the invoking thread, or one.
+             */
+            [[nodiscard]] size_t getNumThreads() const;
+
+            /**
+             * @brief Set the Synthesis Engine Type
+             *
+             * This operation changes the synthesis engine type. It takes effect at the next `reset` with
+             * generation parameters. Until then, samples continue to be produced by the engine in effect.
+             * Any memory the engine type requires is allocated here, not during `reset`.
+             *
+             * @param engineType The synthesis engine to utilize.
+             * @see CombGeneratorEngineType for the engines available and how their results compare.
+             */
+            void setEngineType( CombGeneratorEngineType engineType );
+
+            /**
+             * @brief Query the Synthesis Engine Type
+             *
+             * This operation returns the synthesis engine type specified during construction
+             * or by the most recent `setEngineType` invocation.
+             *
+             * @return The synthesis engine type.
+             */
+            [[nodiscard]] CombGeneratorEngineType getEngineType() const;
+
+            /**
+             * @brief Query the Synthesis Engine Type in Effect
+             *
+             * This operation returns the synthesis engine type currently producing samples. It differs from
+             * `getEngineType` for `CombGeneratorEngineType::Automatic` where it reports the engine selected
+             * by the most recent `reset`, and for engines that defer to another under some `reset` parameters.
+             * Prior to any `reset` with generation parameters, it reports `CombGeneratorEngineType::FusedKernel`
+             * for automatic selection.
+             *
+             * @return The synthesis engine type in effect. This is never `CombGeneratorEngineType::Automatic`.
+             */
+            [[nodiscard]] CombGeneratorEngineType getActiveEngineType() const;
+
+            /**
+             * @brief Query the Kernel Variant
+             *
+             * This operation returns the kernel variant selected during construction. Kernel variants are
+             * selected for every instance but, only utilized by kernel based engines.
+             *
+             * @return The kernel variant selected. This is never `CombGeneratorKernelVariant::Automatic`.
+             */
+            [[nodiscard]] CombGeneratorKernelVariant getKernelVariant() const;
+
+            /**
+             * @brief Set the Process Wide Kernel Variant Override
+             *
+             * This operation forces the kernel variant selected by subsequently constructed instances.
+             * It takes precedence over the `REISER_RT_COMBGENERATOR_KERNEL` environment variable.
+             * Existing instances are unaffected. A variant not supported by the running processor
+             * falls back to the fastest supported variant below it.
+             *
+             * @param variant The kernel variant to force or `CombGeneratorKernelVariant::Automatic`
+             * to remove the override.
+             * @see CombGeneratorKernelVariant
+             */
+            static void setKernelVariantOverride( CombGeneratorKernelVariant variant );
+
         private:
             Imple * pImple{};    //!< Pointer to hidden implementation.
         };
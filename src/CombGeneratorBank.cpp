@@ -0,0 +1,323 @@
+/**
+ * @file CombGeneratorBank.cpp
+ * @brief The implementation file for the Comb Generator Bank
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorBank.h"
+#include "WorkerPool.h"
+#include "AlignedAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class CombGeneratorBank::Imple
+{
+// Deleted Operations Should be `public`
+public:
+    Imple() = delete;
+
+// Everything else is private but accessible by our nested class.
+private:
+    friend class CombGeneratorBank;
+
+    using PartialBufferType = std::vector< FlyingPhasorElementType, AlignedAllocator< FlyingPhasorElementType > >;
+    using ClockType = std::chrono::steady_clock;
+
+    /**
+     * @brief A Contiguous Range of an Output's Generators, Summed into One Partial Buffer
+     */
+    struct Task
+    {
+        size_t begin;       // Range within `orderedGenerators`.
+        size_t end;
+        size_t home;        // The home thread.
+        size_t slot;        // The partial buffer of the home thread.
+    };
+
+    /**
+     * @brief The Tasks of a Home Thread, Claimed by Atomic Increment from the Front
+     *
+     * A home thread's tasks are those with task index `home + j * numWorkers` for `j` less than `count`.
+     * Each queue is on its own cache line.
+     */
+    struct alignas( kernelBufferAlignment ) TaskQueue
+    {
+        std::atomic< size_t > next{};
+        size_t count{};
+    };
+
+    Imple( size_t numThreads, size_t theNumOutputs, size_t theMaxBatchSamples, bool pinThreads )
+      : workerPool{ resolveNumThreads( numThreads ), pinThreads }
+      , numWorkers{ workerPool.getNumWorkers() }
+      , numOutputs{ std::max( theNumOutputs, size_t( 1 ) ) }
+      , maxBatchSamples{ std::max( theMaxBatchSamples, size_t( 1 ) ) }
+      , slotsPerThread{ tasksPerThread + ( numOutputs + numWorkers - 1 ) / numWorkers }
+      , partialBuffers( numWorkers )
+      , queues{ new TaskQueue[ numWorkers ] }
+    {
+        tasks.reserve( numWorkers * slotsPerThread );
+        outputTaskBegin.resize( numOutputs + 1 );
+
+        // Each thread allocates, and so first touches, its own partial buffers.
+        auto allocate = [ this ]( size_t k ) { partialBuffers[ k ].resize( slotsPerThread * maxBatchSamples ); };
+        workerPool.run( std::ref( allocate ) );
+    }
+
+    ~Imple() = default;
+
+    static size_t resolveNumThreads( size_t numThreads )
+    {
+        if ( numThreads ) return numThreads;
+        const auto hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads ? hardwareThreads : 1;
+    }
+
+    size_t addGenerator( CombGenerator && generator, size_t outputIndex )
+    {
+        if ( numOutputs <= outputIndex )
+            throw std::out_of_range{ "The output index exceeds the number of outputs of the CombGeneratorBank!" };
+
+        generators.emplace_back( std::move( generator ) );
+        generatorOutputs.push_back( outputIndex );
+        orderedGenerators.reserve( generators.size() );
+        layoutRequired = true;
+        return generators.size() - 1;
+    }
+
+    void layoutTasks()
+    {
+        // Order generators by output, retaining the order added within each output.
+        orderedGenerators.clear();
+        for ( size_t o = 0; numOutputs != o; ++o )
+        {
+            outputTaskBegin[ o ] = orderedGenerators.size();    // Temporarily, the first generator of the output.
+            for ( size_t g = 0; generators.size() != g; ++g )
+                if ( o == generatorOutputs[ g ] ) orderedGenerators.push_back( g );
+        }
+        outputTaskBegin[ numOutputs ] = orderedGenerators.size();
+
+        // Divide each output's generators into tasks, in proportion to its share of all generators.
+        // Rounding up bounds the number of tasks by the target plus the number of outputs.
+        tasks.clear();
+        const auto targetTasks = numWorkers * tasksPerThread;
+        const auto numGenerators = orderedGenerators.size();
+        size_t generatorBegin = 0;
+        for ( size_t o = 0; numOutputs != o; ++o )
+        {
+            const auto generatorEnd = outputTaskBegin[ o + 1 ];
+            const auto outputGenerators = generatorEnd - generatorBegin;
+            outputTaskBegin[ o ] = tasks.size();
+            if ( outputGenerators )
+            {
+                const auto numTasks = std::min( ( targetTasks * outputGenerators + numGenerators - 1 ) / numGenerators,
+                                                outputGenerators );
+                for ( size_t t = 0; numTasks != t; ++t )
+                {
+                    const auto taskIndex = tasks.size();
+                    tasks.push_back( Task{ generatorBegin + outputGenerators * t / numTasks,
+                                           generatorBegin + outputGenerators * ( t + 1 ) / numTasks,
+                                           taskIndex % numWorkers, taskIndex / numWorkers } );
+                }
+            }
+            generatorBegin = generatorEnd;
+        }
+        outputTaskBegin[ numOutputs ] = tasks.size();
+
+        for ( size_t k = 0; numWorkers != k; ++k )
+            queues[ k ].count = ( tasks.size() + numWorkers - 1 - k ) / numWorkers;
+
+        layoutRequired = false;
+    }
+
+    FlyingPhasorElementBufferTypePtr partialBuffer( const Task & task )
+    {
+        return partialBuffers[ task.home ].data() + task.slot * maxBatchSamples;
+    }
+
+    void runTask( const Task & task, size_t numSamples )
+    {
+        auto pPartial = partialBuffer( task );
+        try
+        {
+            for ( size_t i = task.begin; task.end != i; ++i )
+            {
+                auto & generator = generators[ orderedGenerators[ i ] ];
+                if ( task.begin == i )
+                    generator.getSamples( pPartial, numSamples );
+                else
+                    generator.accumSamples( pPartial, numSamples );
+            }
+        }
+        catch ( ... )
+        {
+            // We must still arrive at the barrier. The exception is rethrown after the batch.
+            std::lock_guard< std::mutex > lock{ exceptionMutex };
+            if ( !firstException )
+                firstException = std::current_exception();
+        }
+    }
+
+    void runTasks( size_t k, size_t numSamples )
+    {
+        // Our own tasks first, then those of the others, starting with our neighbor.
+        for ( size_t v = 0; numWorkers != v; ++v )
+        {
+            const auto home = ( k + v ) % numWorkers;
+            auto & queue = queues[ home ];
+            for ( auto j = queue.next.fetch_add( 1, std::memory_order_relaxed ); queue.count > j;
+                  j = queue.next.fetch_add( 1, std::memory_order_relaxed ) )
+            {
+                runTask( tasks[ home + j * numWorkers ], numSamples );
+                if ( v ) numSteals.fetch_add( 1, std::memory_order_relaxed );
+            }
+        }
+    }
+
+    void reduce( size_t k, const FlyingPhasorElementBufferTypePtr * pOutputBuffers, size_t sampleOffset,
+                 size_t numSamples )
+    {
+        // Our slice of the samples, for every output, summing partial buffers in task order.
+        const auto sliceBegin = numSamples * k / numWorkers;
+        const auto sliceEnd = numSamples * ( k + 1 ) / numWorkers;
+        for ( size_t o = 0; numOutputs != o; ++o )
+        {
+            auto pOut = pOutputBuffers[ o ] + sampleOffset;
+            for ( size_t t = outputTaskBegin[ o ]; outputTaskBegin[ o + 1 ] != t; ++t )
+            {
+                const auto pPartial = partialBuffer( tasks[ t ] );
+                for ( size_t n = sliceBegin; sliceEnd != n; ++n )
+                    pOut[ n ] += pPartial[ n ];
+            }
+        }
+    }
+
+    void accumSamples( const FlyingPhasorElementBufferTypePtr * pOutputBuffers, size_t numSamples )
+    {
+        const auto startTime = ClockType::now();
+        if ( layoutRequired )
+            layoutTasks();
+
+        numSteals = 0;
+        double synthesisSeconds = 0.0;
+        double reductionSeconds = 0.0;
+        for ( size_t offset = 0; numSamples > offset; offset += maxBatchSamples )
+        {
+            const auto batchSamples = std::min( maxBatchSamples, numSamples - offset );
+            for ( size_t k = 0; numWorkers != k; ++k )
+                queues[ k ].next.store( 0, std::memory_order_relaxed );
+
+            // The pool publishes the reset queues to the workers and the barrier publishes the partial buffers.
+            const auto batchStart = ClockType::now();
+            ClockType::time_point synthesisEnd{};
+            auto job = [ &, this ]( size_t k )
+            {
+                runTasks( k, batchSamples );
+                workerPool.arriveAndWait();
+                if ( !k ) synthesisEnd = ClockType::now();
+
+                // Tasks only record exceptions before the barrier. Partial buffers of a failed batch are not reduced.
+                if ( !firstException )
+                    reduce( k, pOutputBuffers, offset, batchSamples );
+            };
+            workerPool.run( std::ref( job ) );
+            const auto batchEnd = ClockType::now();
+
+            synthesisSeconds += std::chrono::duration< double >( synthesisEnd - batchStart ).count();
+            reductionSeconds += std::chrono::duration< double >( batchEnd - synthesisEnd ).count();
+
+            if ( firstException )
+            {
+                auto exception = firstException;
+                firstException = nullptr;
+                std::rethrow_exception( exception );
+            }
+        }
+
+        lastBatchTiming = BatchTiming{ std::chrono::duration< double >( ClockType::now() - startTime ).count(),
+                                       synthesisSeconds, reductionSeconds, tasks.size(),
+                                       numSteals.load( std::memory_order_relaxed ) };
+    }
+
+    WorkerPool workerPool;
+    const size_t numWorkers;
+    const size_t numOutputs;
+    const size_t maxBatchSamples;
+    const size_t slotsPerThread;
+    std::vector< PartialBufferType > partialBuffers;
+    std::unique_ptr< TaskQueue[] > queues;
+    std::vector< CombGenerator > generators{};
+    std::vector< size_t > generatorOutputs{};
+    std::vector< size_t > orderedGenerators{};
+    std::vector< Task > tasks{};
+    std::vector< size_t > outputTaskBegin{};
+    std::atomic< size_t > numSteals{};
+    std::mutex exceptionMutex{};
+    std::exception_ptr firstException{};
+    BatchTiming lastBatchTiming{};
+    bool layoutRequired{ true };
+};
+
+CombGeneratorBank::CombGeneratorBank( size_t numThreads, size_t numOutputs, size_t maxBatchSamples, bool pinThreads )
+  : pImple{ new Imple{ numThreads, numOutputs, maxBatchSamples, pinThreads } }
+{
+}
+
+CombGeneratorBank::~CombGeneratorBank()
+{
+    delete pImple;
+}
+
+size_t CombGeneratorBank::addGenerator( CombGenerator && generator, size_t outputIndex )
+{
+    return pImple->addGenerator( std::move( generator ), outputIndex );
+}
+
+CombGenerator & CombGeneratorBank::getGenerator( size_t index )
+{
+    return pImple->generators[ index ];
+}
+
+void CombGeneratorBank::accumSamples( const FlyingPhasorElementBufferTypePtr * pOutputBuffers, size_t numSamples )
+{
+    pImple->accumSamples( pOutputBuffers, numSamples );
+}
+
+void CombGeneratorBank::accumSamples( FlyingPhasorElementBufferTypePtr pOutputBuffer, size_t numSamples )
+{
+    if ( 1 != pImple->numOutputs )
+        throw std::invalid_argument{ "The CombGeneratorBank has more than one output!" };
+
+    pImple->accumSamples( &pOutputBuffer, numSamples );
+}
+
+CombGeneratorBank::BatchTiming CombGeneratorBank::getLastBatchTiming() const
+{
+    return pImple->lastBatchTiming;
+}
+
+size_t CombGeneratorBank::getNumGenerators() const
+{
+    return pImple->generators.size();
+}
+
+size_t CombGeneratorBank::getNumOutputs() const
+{
+    return pImple->numOutputs;
+}
+
+size_t CombGeneratorBank::getNumThreads() const
+{
+    return pImple->numWorkers;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file CombGeneratorBank.h
+ * @brief The specification file for the Comb Generator Bank
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORBANK_H
+#define REISER_RT_COMBGENERATORBANK_H
+
+// Include Export Specification File
+#include "ReiserRT_CombGeneratorExport.h"
+
+#include "CombGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Comb Generator Bank
+         *
+         * The CombGeneratorBank owns many CombGenerator instances, each assigned to one of a number of outputs,
+         * and accumulates all of them onto the output buffers in batches, on a pool of worker threads.
+         *
+         * The generators of each output are divided, in the order added, into contiguous ranges called tasks.
+         * There are a few tasks per thread, each with its own partial buffer, and each task has a home thread.
+         * During a batch, a thread runs the tasks of its home first, then steals tasks from other threads until
+         * none remain. A task sums its generators, in order, into its partial buffer. Once all tasks are done,
+         * every thread reduces a slice of the samples, summing each output's partial buffers in task order onto
+         * the output buffer. Results therefore do not depend on which thread ran which task, only on the generators,
+         * their order and the number of threads.
+         *
+         * Partial buffers are allocated, and first touched, by their home thread at construction. On a system
+         * with a first touch memory policy, as Linux has by default, they reside on the NUMA node of their home
+         * thread. Optionally pinning the worker threads to cores keeps them there.
+         *
+         * @note Each generator is used by one thread at a time, although not always the same one.
+         * An envelope functor shared between generators must be safe to invoke concurrently.
+         */
+        class ReiserRT_CombGenerator_EXPORT CombGeneratorBank
+        {
+        private:
+            /**
+             * @brief Forward Reference to Hidden Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief Timing of the Last Batch
+             */
+            struct BatchTiming
+            {
+                double totalSeconds;        //!< Wall clock time of the `accumSamples` invocation.
+                double synthesisSeconds;    //!< Wall clock time until every task was done.
+                double reductionSeconds;    //!< Wall clock time reducing partial buffers onto the outputs.
+                size_t numTasks;            //!< The number of tasks the generators were divided into.
+                size_t numSteals;           //!< The number of tasks run by a thread other than their home thread.
+            };
+
+            /**
+             * @brief The Default Maximum Number of Samples per Batch
+             *
+             * Larger `accumSamples` requests are processed as several batches.
+             */
+            static constexpr size_t defaultMaxBatchSamples = 4096;
+
+            /**
+             * @brief The Number of Tasks per Thread
+             *
+             * Several tasks per thread leave something to steal when generators vary in cost.
+             */
+            static constexpr size_t tasksPerThread = 4;
+
+            /**
+             * @brief Qualified Constructor
+             *
+             * This constructor creates the worker threads and their partial buffers.
+             *
+             * @param numThreads The number of threads, inclusive of the invoking thread. If zero,
+             * the number of hardware threads is used.
+             * @param numOutputs The number of output buffers generators are accumulated onto.
+             * @param maxBatchSamples The maximum number of samples per batch. Partial buffers are this long.
+             * @param pinThreads If true, worker threads are pinned to cores (Linux only). The invoking thread is not.
+             */
+            explicit CombGeneratorBank( size_t numThreads, size_t numOutputs = 1,
+                                        size_t maxBatchSamples = defaultMaxBatchSamples, bool pinThreads = false );
+
+            /**
+             * @brief Destructor
+             *
+             * Joins the worker threads and deletes the Implementation, along with the generators owned.
+             */
+            ~CombGeneratorBank();
+
+            /**
+             * @brief Copy Construction is Disallowed
+             */
+            CombGeneratorBank( const CombGeneratorBank & another ) = delete;
+
+            /**
+             * @brief Copy Assignment is Disallowed
+             */
+            CombGeneratorBank & operator =( const CombGeneratorBank & another ) = delete;
+
+            /**
+             * @brief Add a Generator to the Bank
+             *
+             * The bank takes ownership of the generator. Tasks are laid out anew at the next batch.
+             *
+             * @param generator The generator, moved into the bank.
+             * @param outputIndex The output the generator is accumulated onto.
+             * @return The index of the generator within the bank.
+             * @throw std::out_of_range If the output index is not less than the number of outputs.
+             */
+            size_t addGenerator( CombGenerator && generator, size_t outputIndex = 0 );
+
+            /**
+             * @brief Access a Generator of the Bank
+             *
+             * Generators may be `reset`, or otherwise manipulated, between batches.
+             *
+             * @param index The index returned by `addGenerator`.
+             * @return A reference to the generator.
+             */
+            CombGenerator & getGenerator( size_t index );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number of samples from every generator onto the output buffer it is
+             * assigned to. Outputs with no generators are left untouched.
+             *
+             * @param pOutputBuffers An array of `numOutputs` pointers to user provided buffers, each large enough
+             * to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @throw Rethrows the first exception thrown by any generator, such as from its envelope functor, once
+             * every thread is done with the batch. Output buffer contents and generator sample counts are then
+             * unspecified. Generators should be `reset` before further use.
+             */
+            void accumSamples( const FlyingPhasorElementBufferTypePtr * pOutputBuffers, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation for a Bank with a Single Output
+             *
+             * @param pOutputBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             * @throw std::invalid_argument If the bank has more than one output.
+             */
+            void accumSamples( FlyingPhasorElementBufferTypePtr pOutputBuffer, size_t numSamples );
+
+            /**
+             * @brief Query the Timing of the Last `accumSamples` Invocation
+             *
+             * Times are totals over every batch of the invocation.
+             *
+             * @return The timing of the last invocation, or zeros if there was none.
+             */
+            [[nodiscard]] BatchTiming getLastBatchTiming() const;
+
+            /**
+             * @brief Query the Number of Generators
+             *
+             * @return The number of generators owned by the bank.
+             */
+            [[nodiscard]] size_t getNumGenerators() const;
+
+            /**
+             * @brief Query the Number of Outputs
+             *
+             * @return The number of outputs specified at construction.
+             */
+            [[nodiscard]] size_t getNumOutputs() const;
+
+            /**
+             * @brief Query the Number of Threads
+             *
+             * @return The number of threads, inclusive of the invoking thread.
+             */
+            [[nodiscard]] size_t getNumThreads() const;
+
+        private:
+            Imple * pImple{};    //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORBANK_H
@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorBatchEnvelopeFunkType.cpp
+ * @brief The implementation file for the Comb Generator Batch Envelope Functor Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorBatchEnvelopeFunkType.h"
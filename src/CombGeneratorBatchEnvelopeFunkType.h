@@ -0,0 +1,60 @@
+/**
+ * @file CombGeneratorBatchEnvelopeFunkType.h
+ * @brief The specification file for the Comb Generator Batch Envelope Functor Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORBATCHENVELOPEFUNKTYPE_H
+#define REISER_RT_COMBGENERATORBATCHENVELOPEFUNKTYPE_H
+
+#include <cstddef>
+#include <functional>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Maximum Number of Samples Requested of a Batch Envelope Functor per Invocation
+         *
+         * The envelope matrix holds this many rows of samples.
+         */
+        constexpr size_t combGeneratorBatchEnvelopeBlockSamples = 256;
+
+        /**
+         * @brief The Comb Generator Batch Envelope Functor Type
+         *
+         * This is an alternative to CombGeneratorEnvelopeFunkType which delivers the envelopes of a whole range
+         * of harmonics in one invocation, rather than one invocation per harmonic. Envelopes are written into
+         * an aligned envelope matrix provided by the CombGenerator, sample major. That is, each row holds one
+         * sample of every harmonic of the range, and rows are `stride` elements apart. The FusedKernel engine
+         * applies the matrix within its fused kernel, a lane group of harmonics at a time, so the user buffer
+         * is still written once per sample rather than once per harmonic.
+         *
+         * The functor is invoked once per `combGeneratorBatchEnvelopeBlockSamples` block of a `getSamples`
+         * invocation, so a `getSamples` invocation of no more than that many samples invokes it exactly once.
+         * The envelope matrix is allocated by the first `CombGenerator::resetWithBatchEnvelope` invocation.
+         * It is `combGeneratorBatchEnvelopeBlockSamples` rows of the maximum number of harmonics, padded.
+         *
+         * A CombGenerator constructed with more than one thread invokes the functor from its worker threads,
+         * concurrently, each for its own harmonic range, as described for CombGeneratorEnvelopeFunkType.
+         * Concurrent invocations write disjoint columns of the matrix.
+         *
+         * @param currentSample The sample count of the first sample of the block.
+         * @param numSamples The number of samples of envelope to generate, the number of rows.
+         * @param firstHarmonic The zeroth based harmonic (0 being the fundamental) of the first column.
+         * @param numHarmonics The number of harmonics of the range, the number of columns.
+         * @param pEnvelopeMatrix The envelope matrix, positioned at `firstHarmonic`. The envelope of harmonic
+         * `firstHarmonic + h` at sample `currentSample + n` is to be written to `pEnvelopeMatrix[ n * stride + h ]`.
+         * Envelopes are applied in place of the nominal magnitudes specified at reset time.
+         * @param stride The distance, in elements, between rows of the matrix.
+         * @warning Failure to populate every element of the range results in undefined behaviour.
+         * Elements outside of the range must not be written.
+         */
+        using CombGeneratorBatchEnvelopeFunkType =
+                std::function< void( size_t currentSample, size_t numSamples, size_t firstHarmonic,
+                                     size_t numHarmonics, double * pEnvelopeMatrix, size_t stride ) >;
+    }
+}
+#endif //REISER_RT_COMBGENERATORBATCHENVELOPEFUNKTYPE_H
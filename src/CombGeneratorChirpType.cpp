@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorChirpType.cpp
+ * @brief Test Compilation of the Comb Generator Chirp Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorChirpType.h"
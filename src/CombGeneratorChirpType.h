@@ -0,0 +1,34 @@
+/**
+ * @file CombGeneratorChirpType.h
+ * @brief The specification file for the Comb Generator Chirp Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORCHIRPTYPE_H
+#define REISER_RT_COMBGENERATORCHIRPTYPE_H
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Chirp Type
+         *
+         * This describes a fundamental frequency sweeping continuously over time. The fundamental frequency
+         * in effect from sample index `n` to `n + 1` is `startRadiansPerSample + linearSweep * n +
+         * quadraticSweep * n * n` radians per sample. Harmonic `k` sweeps at exactly `k` times this,
+         * so the harmonic series remains coherent throughout.
+         *
+         * The frequency of every harmonic should remain within the Nyquist range over the samples produced.
+         */
+        struct CombGeneratorChirpType
+        {
+            double startRadiansPerSample{};     //!< The fundamental frequency at sample index zero.
+            double linearSweep{};               //!< The fundamental frequency change per sample.
+            double quadraticSweep{};            //!< The fundamental frequency change per sample squared.
+        };
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORCHIRPTYPE_H
@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorCommonEnvelopeFunkType.cpp
+ * @brief The implementation file for the Comb Generator Common Envelope Functor Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorCommonEnvelopeFunkType.h"
@@ -0,0 +1,48 @@
+/**
+ * @file CombGeneratorCommonEnvelopeFunkType.h
+ * @brief The specification file for the Comb Generator Common Envelope Functor Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORCOMMONENVELOPEFUNKTYPE_H
+#define REISER_RT_COMBGENERATORCOMMONENVELOPEFUNKTYPE_H
+
+#include <cstddef>
+#include <functional>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Common Envelope Functor Type
+         *
+         * This is an alternative to CombGeneratorEnvelopeFunkType for an envelope shared by every harmonic,
+         * amplitude modulation, a burst shape or a fade for instance. Rather than being invoked once per harmonic,
+         * and applied to each harmonic, the functor is invoked once and its envelope is applied once per sample,
+         * to the sum of the harmonics at their constant magnitudes. When accumulating, it is applied before
+         * the sum is accumulated into the caller's buffer.
+         *
+         * The functor is invoked by the thread invoking `CombGenerator::getSamples`, once per invocation, or once
+         * per run of samples between gate transitions and scheduled events. It is not invoked while gated off.
+         *
+         * @param currentSample The current running sample counter.
+         * @param numSamples The number of samples of envelope to generate.
+         * @note The client is expected to provide the necessary buffering for the generation of envelopes
+         * up to some predetermined maximum length.
+         *
+         * @return Returns a pointer to a buffer of minimum length, `numSamples`, populated with the envelope
+         * to apply. Envelope data shall be utilized immediately after functor return so the implementation buffer
+         * can be reused for subsequent functor invocations. Alternatively, returns nullptr to mute the comb
+         * for these `numSamples` samples, as a gate does while off.
+         * @note A lambda returning nullptr on some paths must declare its return type, `-> const double *`.
+         * @warning Failure to provide envelope data of minimum length `numSamples` results in
+         * undefined behaviour.
+         */
+        using CombGeneratorCommonEnvelopeFunkType =
+                std::function< const double *( size_t currentSample, size_t numSamples ) >;
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORCOMMONENVELOPEFUNKTYPE_H
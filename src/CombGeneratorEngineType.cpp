@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorEngineType.cpp
+ * @brief Test Compilation of the Comb Generator Engine Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorEngineType.h"
@@ -0,0 +1,93 @@
+/**
+ * @file CombGeneratorEngineType.h
+ * @brief The specification file for the Comb Generator Engine Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORENGINETYPE_H
+#define REISER_RT_COMBGENERATORENGINETYPE_H
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Engine Type
+         *
+         * This enumeration selects the synthesis engine a CombGenerator instance uses to produce
+         * its harmonic series. The engine is selected at construction time and may be changed
+         * with `CombGenerator::setEngineType`, effective at the next `reset` with generation parameters.
+         */
+        enum class CombGeneratorEngineType : unsigned char
+        {
+            /**
+             * @brief ReiserRT_FlyingPhasor Bank
+             *
+             * One ReiserRT_FlyingPhasor instance per harmonic. Each harmonic makes a full pass over the
+             * user buffer during `getSamples`. This is the original engine and the default. It produces
+             * results bit identical to a series of ReiserRT_FlyingPhasor instances accumulated in harmonic order.
+             */
+            PhasorBank = 0,
+
+            /**
+             * @brief Fused Sample Major Kernel
+             *
+             * All harmonic phasors are held in a structure of arrays layout and advanced together over
+             * small, cache resident, sample tiles. Each output sample is written exactly once per `getSamples`
+             * invocation regardless of the number of harmonics.
+             * Results agree with the PhasorBank engine to within 4e-12 of the sum of the harmonic
+             * magnitudes over 2^20 samples. The difference stems only from summation order, phasor
+             * normalization schedule and, for kernel variants with FMA, fused rounding.
+             */
+            FusedKernel,
+
+            /**
+             * @brief Closed Form Geometric Series
+             *
+             * A comb whose magnitudes are all equal and whose starting phases are linear in harmonic number
+             * is a truncated geometric series. It is evaluated in closed form, at a cost per sample that does
+             * not depend on the number of harmonics. Envelope functors are not supported.
+             * A `reset` with magnitudes or phases that do not form such a series, or with a non-empty envelope
+             * functor, throws `std::invalid_argument`.
+             * Results agree with the PhasorBank engine to within 1e-10 of the sum of the harmonic magnitudes
+             * over 2^20 samples. Closed form evaluation is ill conditioned near the peaks of the comb response
+             * which dominates the difference.
+             */
+            ClosedForm,
+
+            /**
+             * @brief Inverse FFT Block Synthesis
+             *
+             * Samples are synthesized in blocks. Each harmonic is placed at its nearest inverse FFT bin and its
+             * remaining fractional bin offset, a slow complex exponential about the block center, is expanded in
+             * Chebyshev polynomials of time (the Jacobi-Anger expansion) with Bessel function coefficients. Its phase
+             * excursion over a block never exceeds pi / 4 radians, so at most sixteen terms are summed and the
+             * remainder of the series is below 1e-20 of the harmonic magnitude. The cost per sample grows with
+             * the logarithm of the block size, not the number of harmonics, which pays off for combs of many hundreds
+             * to thousands of harmonics. Phases at each block boundary are computed from the sample count, so they
+             * do not drift. Envelope functors are not supported.
+             * A `reset` with a non-empty envelope functor utilizes the FusedKernel engine instead.
+             * Results are within 1e-14 of the sum of the harmonic magnitudes of exact synthesis and, unlike the
+             * recursive engines, this does not grow with the sample count. Over 4096 samples, results agree with
+             * the PhasorBank engine to within 2e-13 of the sum of the harmonic magnitudes, a spur free dynamic
+             * range better than 250 dB.
+             */
+            InverseFft,
+
+            /**
+             * @brief Automatic Selection at Reset
+             *
+             * The ClosedForm engine is utilized when the `reset` parameters allow for it.
+             * Otherwise, the InverseFft engine is utilized for harmonic counts where it outperforms the FusedKernel
+             * engine, provided the instance was constructed for that many. This depends on the kernel variant:
+             * 512 harmonics for Baseline, 2048 for Avx2 and 4096 for Avx512. The FusedKernel engine is utilized in
+             * all other cases, including whenever an envelope functor is specified. The engine in effect can be
+             * queried through `CombGenerator::getActiveEngineType`.
+             */
+            Automatic
+        };
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORENGINETYPE_H
@@ -24,6 +24,13 @@ namespace ReiserRT
          * Instances are to be registered with `CombGenerator::reset` operation and will be
          * notified during subsequent `CombGenerator::getSamples` invocations.
          *
+         * By default, the functor is invoked by the thread invoking `CombGenerator::getSamples`, once per harmonic
+         * in harmonic order. A CombGenerator constructed with more than one thread instead invokes it from its
+         * worker threads, concurrently, for each harmonic of each thread's harmonic range, once per 2048 sample tile.
+         * Concurrent invocations are always for different harmonics, and each thread is done with a returned
+         * envelope before it invokes the functor again. Such a functor must therefore be safe to invoke concurrently
+         * and return a buffer that is not shared with other harmonics, a buffer per harmonic for instance.
+         *
          * The parameters provided to the client during callback are all hints
          * that the client may use of in its generation of envelopes.
          *
@@ -39,6 +46,11 @@ namespace ReiserRT
          * envelope to apply for the Nth harmonic tone.
          * Envelope data shall be utilized or copied immediately after functor return
          * so the implementation buffer can be reused for subsequent functor invocations.
+         * Alternatively, returns nullptr to mute the Nth harmonic tone for these `numSamples` samples, as if the
+         * envelope were all zeros. A muted harmonic is not accumulated. Its phase is advanced directly to the sample
+         * following the block, so it resumes with the phase it would otherwise have had.
+         * @note A lambda returning nullptr on some paths must declare its return type, `-> const double *`, as
+         * the return type deduced for `nullptr` differs from that for a buffer.
          * @warning Failure to provide envelope data of minimum length `numSamples` results in
          * undefined behaviour.
          */
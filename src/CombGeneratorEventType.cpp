@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorEventType.cpp
+ * @brief Test Compilation of the Comb Generator Event Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorEventType.h"
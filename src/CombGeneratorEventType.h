@@ -0,0 +1,73 @@
+/**
+ * @file CombGeneratorEventType.h
+ * @brief The specification file for the Comb Generator Event Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATOREVENTTYPE_H
+#define REISER_RT_COMBGENERATOREVENTTYPE_H
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Event Action
+         *
+         * This enumeration identifies what a scheduled event does when its sample index is reached.
+         */
+        enum class CombGeneratorEventAction : unsigned char
+        {
+            /**
+             * @brief Retune the Fundamental
+             *
+             * The fundamental frequency hops to `value` radians per sample, phase continuously,
+             * as `CombGenerator::retune` does. `nHarmonic` is unused.
+             */
+            Retune = 0,
+
+            /**
+             * @brief Set the Magnitude of a Harmonic
+             *
+             * Harmonic `nHarmonic`, zero based, steps to a magnitude of `value`. A muted harmonic takes
+             * the magnitude when unmuted.
+             */
+            SetMagnitude,
+
+            /**
+             * @brief Mute a Harmonic
+             *
+             * Harmonic `nHarmonic`, zero based, is silenced. Its magnitude is retained. `value` is unused.
+             * Any envelope functor registered is not consulted for the harmonic while it is muted.
+             */
+            MuteHarmonic,
+
+            /**
+             * @brief Unmute a Harmonic
+             *
+             * Harmonic `nHarmonic`, zero based, resumes at its retained magnitude. `value` is unused.
+             */
+            UnmuteHarmonic
+        };
+
+        /**
+         * @brief The Comb Generator Event Type
+         *
+         * This describes a parameter change scheduled to take effect at an exact sample index. The sample
+         * index is that reported by `CombGenerator::getSampleCount`, relative to the last `reset`. The sample
+         * at `sampleIndex` is the first produced with the change in effect.
+         */
+        struct CombGeneratorEventType
+        {
+            size_t sampleIndex{};                   //!< The sample index at which the event takes effect.
+            CombGeneratorEventAction action{};      //!< What the event does.
+            size_t nHarmonic{};                     //!< The zero based harmonic acted upon, where applicable.
+            double value{};                         //!< The new fundamental rate or magnitude, where applicable.
+        };
+    }
+}
+
+#endif //REISER_RT_COMBGENERATOREVENTTYPE_H
@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorGateType.cpp
+ * @brief Test Compilation of the Comb Generator Gate Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorGateType.h"
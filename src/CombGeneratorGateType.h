@@ -0,0 +1,36 @@
+/**
+ * @file CombGeneratorGateType.h
+ * @brief The specification file for the Comb Generator Gate Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORGATETYPE_H
+#define REISER_RT_COMBGENERATORGATETYPE_H
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Gate Type
+         *
+         * This describes a periodic gate, as for a pulsed emission. The gate is off before `startOffsetSamples`.
+         * From there, each pulse repetition interval of `pulseRepetitionSamples` begins with the gate on for
+         * `pulseWidthSamples` and is off for the remainder. Sample indices are those reported by
+         * `CombGenerator::getSampleCount`, relative to the last `reset`.
+         *
+         * The pulse width must not exceed the pulse repetition interval, which must not be zero.
+         */
+        struct CombGeneratorGateType
+        {
+            size_t pulseRepetitionSamples{};    //!< The pulse repetition interval in samples.
+            size_t pulseWidthSamples{};         //!< The number of samples the gate is on per interval.
+            size_t startOffsetSamples{};        //!< The sample index of the first pulse.
+        };
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORGATETYPE_H
@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorKernelVariant.cpp
+ * @brief Test Compilation of the Comb Generator Kernel Variant
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorKernelVariant.h"
@@ -0,0 +1,42 @@
+/**
+ * @file CombGeneratorKernelVariant.h
+ * @brief The specification file for the Comb Generator Kernel Variant
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORKERNELVARIANT_H
+#define REISER_RT_COMBGENERATORKERNELVARIANT_H
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Kernel Variant
+         *
+         * The sample generation kernels used by kernel based engines (see CombGeneratorEngineType) are
+         * built several times, once per instruction set. The fastest variant supported by the running
+         * processor is selected when a CombGenerator is constructed.
+         *
+         * The selection may be forced, for benchmarking and reproducibility purposes, through
+         * `CombGenerator::setKernelVariantOverride` or through the `REISER_RT_COMBGENERATOR_KERNEL`
+         * environment variable which accepts `baseline`, `avx2` or `avx512`. The API override takes
+         * precedence. A forced variant that the processor, or the build, does not support falls back
+         * to the fastest supported variant below it. Use `CombGenerator::getKernelVariant` to
+         * determine what was actually selected.
+         *
+         * @note The `PhasorBank` engine delegates sample generation to ReiserRT_FlyingPhasor and is not
+         * affected by kernel variant selection.
+         */
+        enum class CombGeneratorKernelVariant : unsigned char
+        {
+            Automatic = 0,  //!< Select the fastest variant the processor supports.
+            Baseline,       //!< Default target instruction set (SSE2 on x86-64).
+            Avx2,           //!< AVX2 with FMA.
+            Avx512          //!< AVX-512 (F, DQ and VL).
+        };
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORKERNELVARIANT_H
@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorSegmentEnvelopeFunkType.cpp
+ * @brief The implementation file for the Comb Generator Segment Envelope Functor Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorSegmentEnvelopeFunkType.h"
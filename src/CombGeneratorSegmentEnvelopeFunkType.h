@@ -0,0 +1,73 @@
+/**
+ * @file CombGeneratorSegmentEnvelopeFunkType.h
+ * @brief The specification file for the Comb Generator Segment Envelope Functor Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORSEGMENTENVELOPEFUNKTYPE_H
+#define REISER_RT_COMBGENERATORSEGMENTENVELOPEFUNKTYPE_H
+
+#include <cstddef>
+#include <functional>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Envelope Segment Type
+         *
+         * One linear segment of a piecewise linear envelope. The segment runs from its sample offset up to that of
+         * the next segment, or to the end of the block for the last. The envelope at `sampleOffset + n` within it
+         * is `value + slope * n`.
+         */
+        struct CombGeneratorEnvelopeSegmentType
+        {
+            size_t sampleOffset{};      //!< The offset of the first sample of the segment within the block.
+            double value{};             //!< The envelope at the first sample of the segment.
+            double slope{};             //!< The envelope change per sample.
+        };
+
+        /**
+         * @brief The List of Envelope Segments Returned by a Segment Envelope Functor
+         */
+        struct CombGeneratorEnvelopeSegmentsType
+        {
+            const CombGeneratorEnvelopeSegmentType * pSegments{};   //!< The segments, in sample offset order.
+            size_t numSegments{};                                   //!< The number of segments.
+        };
+
+        /**
+         * @brief The Comb Generator Segment Envelope Functor Type
+         *
+         * This is an alternative to CombGeneratorEnvelopeFunkType for envelopes that are piecewise linear,
+         * as scintillation ramps are. Rather than writing an envelope buffer of `numSamples` per harmonic,
+         * which the CombGenerator then streams back in, the functor describes the envelope as a short list of
+         * linear segments. The FusedKernel engine evaluates each segment's ramp as it synthesizes the harmonic,
+         * so there is no envelope buffer at all. The PhasorBank engine expands segments into a small buffer
+         * of its own.
+         *
+         * The functor is invoked as CombGeneratorEnvelopeFunkType is, once per harmonic per `getSamples`
+         * invocation, or per tile for harmonic partitioned synthesis, with the same parameters and the same
+         * concurrency requirements.
+         *
+         * @param currentSample The current running sample counter for the Nth harmonic tone.
+         * @param numSamples The number of samples of envelope to describe.
+         * @param nHarmonic The zeroth based harmonic (0 being the fundamental).
+         * @param nominalMag The default magnitude for the Nth harmonic, specified at reset time.
+         *
+         * @return Returns the segments of the envelope to apply for the Nth harmonic tone. The first segment must
+         * have a sample offset of zero and sample offsets must be strictly ascending and less than `numSamples`.
+         * The segments shall be utilized immediately after functor return, so their storage can be reused
+         * for subsequent functor invocations. Alternatively, returns no segments to mute the Nth harmonic tone
+         * for these `numSamples` samples, as CombGeneratorEnvelopeFunkType does by returning nullptr.
+         * @warning Failure to describe all `numSamples` samples, as above, results in undefined behaviour.
+         */
+        using CombGeneratorSegmentEnvelopeFunkType =
+                std::function< CombGeneratorEnvelopeSegmentsType( size_t currentSample, size_t numSamples,
+                                                                  size_t nHarmonic, double nominalMag ) >;
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORSEGMENTENVELOPEFUNKTYPE_H
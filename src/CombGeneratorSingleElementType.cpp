@@ -0,0 +1,8 @@
+/**
+ * @file CombGeneratorSingleElementType.cpp
+ * @brief Test Compilation of the Comb Generator Single Precision Element Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorSingleElementType.h"
@@ -0,0 +1,33 @@
+/**
+ * @file CombGeneratorSingleElementType.h
+ * @brief The specification file for the Comb Generator Single Precision Element Type
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_COMBGENERATORSINGLEELEMENTTYPE_H
+#define REISER_RT_COMBGENERATORSINGLEELEMENTTYPE_H
+
+#include <complex>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Comb Generator Single Precision Element Type
+         *
+         * The CombGenerator natively produces `FlyingPhasorElementType` (double precision complex) samples.
+         * Clients which ultimately require single precision may have samples produced in this type directly,
+         * sparing them a conversion pass and, for some engines, computing in single precision throughout.
+         */
+        using CombGeneratorSingleElementType = std::complex< float >;
+
+        /**
+         * @brief The Comb Generator Single Precision Element Buffer Pointer Type
+         */
+        using CombGeneratorSingleElementBufferTypePtr = CombGeneratorSingleElementType *;
+    }
+}
+
+#endif //REISER_RT_COMBGENERATORSINGLEELEMENTTYPE_H
@@ -0,0 +1,8 @@
+/**
+ * @file FixedCombGenerator.cpp
+ * @brief The implementation file for the Compile Time Specialized Comb Generator
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "FixedCombGenerator.h"
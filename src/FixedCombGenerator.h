@@ -0,0 +1,325 @@
+/**
+ * @file FixedCombGenerator.h
+ * @brief The specification file for the Compile Time Specialized Comb Generator
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_FIXEDCOMBGENERATOR_H
+#define REISER_RT_FIXEDCOMBGENERATOR_H
+
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Nominal Envelope Policy
+         *
+         * Each harmonic is produced at the constant, nominal magnitude specified at `reset` time.
+         * This is the FixedCombGenerator analogue of resetting a CombGenerator without an envelope functor.
+         */
+        struct FixedCombGeneratorNominalEnvelope
+        {
+            /**
+             * @brief Function Operator
+             *
+             * @param sampleCount The sample count of the sample of interest.
+             * @param nHarmonic The zeroth based harmonic (0 being the fundamental).
+             * @param nominalMagnitude The nominal magnitude of the harmonic.
+             * @return The magnitude of the harmonic at the sample of interest.
+             */
+            double operator()( size_t sampleCount, size_t nHarmonic, double nominalMagnitude ) const
+            {
+                (void)sampleCount;
+                (void)nHarmonic;
+                return nominalMagnitude;
+            }
+        };
+
+        /**
+         * @brief Compile Time Specialized Comb Generator
+         *
+         * A header only alternative to CombGenerator for applications whose harmonic count and envelope policy are
+         * known at compile time. Tone state is held in `std::array` members, so an instance makes no heap
+         * allocations. The harmonic loop is unrolled at compile time, a lane group of harmonics at a time,
+         * and the envelope policy is invoked directly, where the compiler may inline it, rather than through
+         * a `std::function`.
+         *
+         * Samples are produced with the same arithmetic as the FusedKernel engine, lane for lane and tile for tile,
+         * so they match those of a CombGenerator constructed with that engine and reset with the same parameters,
+         * to within the rounding of any instructions the compiler fuses differently.
+         *
+         * An envelope policy is a copyable function object with the signature of
+         * `FixedCombGeneratorNominalEnvelope::operator()`. It is invoked once per harmonic per sample, in no
+         * particular order, and returns the magnitude of the harmonic at that sample. Unlike
+         * CombGeneratorEnvelopeFunkType, a policy returns magnitudes one at a time, leaving it to the compiler
+         * to vectorize the policy along with the tones.
+         *
+         * @tparam maxHarmonics The number of harmonics (fundamental included).
+         * @tparam EnvelopePolicy The envelope policy type.
+         */
+        template < size_t maxHarmonics, typename EnvelopePolicy = FixedCombGeneratorNominalEnvelope >
+        class FixedCombGenerator
+        {
+            static_assert( 0 != maxHarmonics, "A FixedCombGenerator requires at least one harmonic." );
+
+        public:
+            /**
+             * @brief The Number of Tones Advanced Together
+             *
+             * This matches the FusedKernel engine lane width.
+             */
+            static constexpr size_t laneWidth = 8;
+
+            /**
+             * @brief The Number of Samples per Tile
+             *
+             * This matches the FusedKernel engine tile length. Phasors are renormalized at the end of each tile.
+             */
+            static constexpr size_t tileSamples = 64;
+
+            /**
+             * @brief The Number of Harmonics Rounded up to a Multiple of the Lane Width
+             */
+            static constexpr size_t paddedHarmonics = ( maxHarmonics + laneWidth - 1 ) / laneWidth * laneWidth;
+
+            /**
+             * @brief Qualified Constructor
+             *
+             * @note A newly constructed instance will produce a series of zeros should the `getSamples`
+             * operation be invoked prior to a `reset` invocation.
+             *
+             * @param theEnvelopePolicy The envelope policy instance.
+             */
+            explicit FixedCombGenerator( EnvelopePolicy theEnvelopePolicy = EnvelopePolicy{} )
+              : envelopePolicy{ std::move( theEnvelopePolicy ) }
+            {
+                phasorReal.fill( 1.0 );
+                phasorImag.fill( 0.0 );
+                rateReal.fill( 1.0 );
+                rateImag.fill( 0.0 );
+                magnitudes.fill( 0.0 );
+            }
+
+            /**
+             * @brief Reset Operation
+             *
+             * Resets every harmonic, as `CombGenerator::reset` does for `maxHarmonics` harmonics. Magnitudes and
+             * phases are copied, so the storage need not outlive the invocation.
+             *
+             * @param fundamentalRadiansPerSample The fundamental frequency in radians per sample.
+             * @param pMag Pointer to `maxHarmonics` magnitudes. A value of `nullptr` results in unity magnitudes.
+             * @param pPhase Pointer to `maxHarmonics` starting phases in radians. A value of `nullptr` results
+             * in zero starting phases.
+             */
+            void reset( double fundamentalRadiansPerSample, const double * pMag = nullptr,
+                        const double * pPhase = nullptr )
+            {
+                for ( size_t i = 0; maxHarmonics != i; ++i )
+                {
+                    const auto radiansPerSample = double(i+1) * fundamentalRadiansPerSample;
+                    const auto phase = pPhase ? *pPhase++ : 0.0;
+                    phasorReal[i] = std::cos( phase );
+                    phasorImag[i] = std::sin( phase );
+                    rateReal[i] = std::cos( radiansPerSample );
+                    rateImag[i] = std::sin( radiansPerSample );
+                    magnitudes[i] = pMag ? *pMag++ : 1.0;
+                }
+
+                sampleCount = 0;
+            }
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * Produces the sum of all harmonics into the user buffer.
+             *
+             * @param pElementBuffer The user buffer to receive the samples.
+             * @param numSamples The number of samples to produce.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+            {
+                synthesize< false >( pElementBuffer, numSamples );
+            }
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * Accumulates the sum of all harmonics onto the user buffer.
+             *
+             * @param pElementBuffer The user buffer to accumulate the samples onto.
+             * @param numSamples The number of samples to produce.
+             */
+            void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+            {
+                synthesize< true >( pElementBuffer, numSamples );
+            }
+
+            /**
+             * @brief Get Sample Count
+             *
+             * @return The number of samples produced since the last `reset`.
+             */
+            size_t getSampleCount() const { return sampleCount; }
+
+            /**
+             * @brief Get the Envelope Policy
+             *
+             * @return A reference to the envelope policy instance, through which its state may be managed.
+             */
+            EnvelopePolicy & getEnvelopePolicy() { return envelopePolicy; }
+
+        private:
+            static constexpr size_t numGroups = paddedHarmonics / laneWidth;
+            static constexpr size_t groupsPerPass = 1;
+            static constexpr size_t numPasses = ( numGroups + groupsPerPass - 1 ) / groupsPerPass;
+
+            template < bool accumulate >
+            void synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+            {
+                alignas( 64 ) double accReal[ tileSamples * laneWidth ];
+                alignas( 64 ) double accImag[ tileSamples * laneWidth ];
+
+                // Complex values are layout compatible with an array of two scalars.
+                auto pOut = reinterpret_cast< double * >( pElementBuffer );
+
+                for ( size_t tileStart = 0; numSamples != tileStart; )
+                {
+                    const auto tileLen = numSamples - tileStart < tileSamples ? numSamples - tileStart : tileSamples;
+                    for ( size_t i = 0; tileLen * laneWidth != i; ++i )
+                        accReal[i] = accImag[i] = 0.0;
+
+                    accumulateGroups( sampleCount + tileStart, tileLen, accReal, accImag,
+                                      std::make_index_sequence< numPasses >{} );
+
+                    // Reduce the lane accumulators and write each output sample once.
+                    auto pTileOut = pOut + 2 * tileStart;
+                    for ( size_t n = 0; tileLen != n; ++n )
+                    {
+                        double sumReal = 0.0;
+                        double sumImag = 0.0;
+                        for ( size_t l = 0; laneWidth != l; ++l )
+                        {
+                            sumReal += accReal[ n * laneWidth + l ];
+                            sumImag += accImag[ n * laneWidth + l ];
+                        }
+                        if ( accumulate )
+                        {
+                            pTileOut[ 2 * n ] += sumReal;
+                            pTileOut[ 2 * n + 1 ] += sumImag;
+                        }
+                        else
+                        {
+                            pTileOut[ 2 * n ] = sumReal;
+                            pTileOut[ 2 * n + 1 ] = sumImag;
+                        }
+                    }
+
+                    tileStart += tileLen;
+                }
+
+                sampleCount += numSamples;
+            }
+
+            template < size_t... passes >
+            void accumulateGroups( size_t tileSampleCount, size_t tileLen, double * accReal, double * accImag,
+                                   std::index_sequence< passes... > )
+            {
+                ( accumulatePass< passes >( tileSampleCount, tileLen, accReal, accImag ), ... );
+            }
+
+            /**
+             * @brief Advance a Pass of Lane Groups of Harmonics Across a Tile
+             *
+             * Unlike the FusedKernel engine, which advances four lane groups together, a pass is one lane group.
+             * Without explicit vector types, wider passes spill registers on baseline targets. Phasors, rates and
+             * magnitudes are held in locals for the tile so that the compiler need not reload them around stores
+             * to the lane accumulators.
+             *
+             * @tparam pass The pass. Harmonics of the padding lanes are known at compile time
+             * and the envelope policy is not invoked for them.
+             */
+            template < size_t pass >
+            void accumulatePass( size_t tileSampleCount, size_t tileLen, double * accReal, double * accImag )
+            {
+                constexpr size_t firstGroup = pass * groupsPerPass;
+                constexpr size_t passGroups = numGroups - firstGroup < groupsPerPass ?
+                                              numGroups - firstGroup : groupsPerPass;
+                constexpr size_t h = firstGroup * laneWidth;
+                constexpr size_t passTones = passGroups * laneWidth;
+
+                double re[ passTones ];
+                double im[ passTones ];
+                double rateRe[ passTones ];
+                double rateIm[ passTones ];
+                double mags[ passTones ];
+                for ( size_t t = 0; passTones != t; ++t )
+                {
+                    re[t] = phasorReal[ h + t ];
+                    im[t] = phasorImag[ h + t ];
+                    rateRe[t] = rateReal[ h + t ];
+                    rateIm[t] = rateImag[ h + t ];
+                    mags[t] = magnitudes[ h + t ];
+                }
+
+                for ( size_t n = 0; tileLen != n; ++n )
+                {
+                    auto pAccReal = accReal + n * laneWidth;
+                    auto pAccImag = accImag + n * laneWidth;
+                    double sumReal[ laneWidth ];
+                    double sumImag[ laneWidth ];
+                    for ( size_t l = 0; laneWidth != l; ++l )
+                    {
+                        sumReal[l] = pAccReal[l];
+                        sumImag[l] = pAccImag[l];
+                    }
+                    for ( size_t g = 0; passGroups != g; ++g )
+                    {
+                        for ( size_t l = 0; laneWidth != l; ++l )
+                        {
+                            const auto t = g * laneWidth + l;
+                            const auto mag = h + t < maxHarmonics ?
+                                    envelopePolicy( tileSampleCount + n, h + t, mags[t] ) : 0.0;
+                            sumReal[l] += mag * re[t];
+                            sumImag[l] += mag * im[t];
+
+                            const auto newRe = re[t] * rateRe[t] - im[t] * rateIm[t];
+                            im[t] = re[t] * rateIm[t] + im[t] * rateRe[t];
+                            re[t] = newRe;
+                        }
+                    }
+                    for ( size_t l = 0; laneWidth != l; ++l )
+                    {
+                        pAccReal[l] = sumReal[l];
+                        pAccImag[l] = sumImag[l];
+                    }
+                }
+
+                // First order magnitude correction, as the FusedKernel engine applies at the end of each tile.
+                for ( size_t t = 0; passTones != t; ++t )
+                {
+                    const auto g = ( 3.0 - ( re[t] * re[t] + im[t] * im[t] ) ) * 0.5;
+                    phasorReal[ h + t ] = re[t] * g;
+                    phasorImag[ h + t ] = im[t] * g;
+                }
+            }
+
+            alignas( 64 ) std::array< double, paddedHarmonics > phasorReal{};
+            alignas( 64 ) std::array< double, paddedHarmonics > phasorImag{};
+            alignas( 64 ) std::array< double, paddedHarmonics > rateReal{};
+            alignas( 64 ) std::array< double, paddedHarmonics > rateImag{};
+            alignas( 64 ) std::array< double, paddedHarmonics > magnitudes{};
+            EnvelopePolicy envelopePolicy;
+            size_t sampleCount{};
+        };
+    }
+}
+
+#endif //REISER_RT_FIXEDCOMBGENERATOR_H
@@ -0,0 +1,842 @@
+/**
+ * @file FusedKernel.cpp
+ * @brief The implementation file for the Fused Sample Major Kernels
+ *
+ * Tones are processed in lane groups through a small eight lane vector type which maps onto whatever
+ * vector unit the variant is compiled for (AVX-512, AVX2 with FMA, SSE2 or plain scalars).
+ * Single precision kernels use a sixteen lane counterpart filling the same registers.
+ * This file is compiled once per kernel variant with `REISER_RT_FUSED_KERNEL_VARIANT` naming the nested
+ * namespace the resulting kernel table lands in.
+ *
+ * @warning Everything here other than the kernel table must have internal linkage and no standard
+ * library templates may be instantiated. Otherwise, the linker is free to share an out of line copy
+ * compiled for a wider instruction set with the baseline variant.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "FusedKernel.h"
+
+#if defined( __AVX512F__ ) || defined( __AVX2__ ) || defined( __SSE2__ ) || defined( _M_X64 )
+#include <immintrin.h>
+#endif
+
+#ifndef REISER_RT_FUSED_KERNEL_VARIANT
+#define REISER_RT_FUSED_KERNEL_VARIANT Baseline
+#endif
+
+using namespace ReiserRT::Signal;
+using namespace ReiserRT::Signal::FusedKernel;
+
+namespace
+{
+    static_assert( 8 == laneWidth, "LaneVector implementations assume eight lanes." );
+    static_assert( 16 == singleLaneWidth, "SingleLaneVector implementations assume sixteen lanes." );
+
+#if defined( __AVX512F__ )
+    /**
+     * @brief Eight Lanes of Doubles, One AVX-512 Register
+     */
+    struct LaneVector
+    {
+        __m512d v;
+
+        static LaneVector load( const double * p ) { return { _mm512_load_pd( p ) }; }
+        static LaneVector broadcast( double d ) { return { _mm512_set1_pd( d ) }; }
+        void store( double * p ) const { _mm512_store_pd( p, v ); }
+
+        friend LaneVector operator +( LaneVector a, LaneVector b ) { return { _mm512_add_pd( a.v, b.v ) }; }
+        friend LaneVector operator -( LaneVector a, LaneVector b ) { return { _mm512_sub_pd( a.v, b.v ) }; }
+        friend LaneVector operator *( LaneVector a, LaneVector b ) { return { _mm512_mul_pd( a.v, b.v ) }; }
+
+        // a * b + c and a * b - c
+        friend LaneVector multiplyAdd( LaneVector a, LaneVector b, LaneVector c ) { return { _mm512_fmadd_pd( a.v, b.v, c.v ) }; }
+        friend LaneVector multiplySub( LaneVector a, LaneVector b, LaneVector c ) { return { _mm512_fmsub_pd( a.v, b.v, c.v ) }; }
+    };
+#elif defined( __AVX2__ )
+    /**
+     * @brief Eight Lanes of Doubles, Two AVX2 Registers
+     */
+    struct LaneVector
+    {
+        __m256d lo, hi;
+
+        static LaneVector load( const double * p ) { return { _mm256_load_pd( p ), _mm256_load_pd( p + 4 ) }; }
+        static LaneVector broadcast( double d ) { return { _mm256_set1_pd( d ), _mm256_set1_pd( d ) }; }
+        void store( double * p ) const { _mm256_store_pd( p, lo ); _mm256_store_pd( p + 4, hi ); }
+
+        friend LaneVector operator +( LaneVector a, LaneVector b )
+            { return { _mm256_add_pd( a.lo, b.lo ), _mm256_add_pd( a.hi, b.hi ) }; }
+        friend LaneVector operator -( LaneVector a, LaneVector b )
+            { return { _mm256_sub_pd( a.lo, b.lo ), _mm256_sub_pd( a.hi, b.hi ) }; }
+        friend LaneVector operator *( LaneVector a, LaneVector b )
+            { return { _mm256_mul_pd( a.lo, b.lo ), _mm256_mul_pd( a.hi, b.hi ) }; }
+
+        // a * b + c and a * b - c
+        friend LaneVector multiplyAdd( LaneVector a, LaneVector b, LaneVector c )
+            { return { _mm256_fmadd_pd( a.lo, b.lo, c.lo ), _mm256_fmadd_pd( a.hi, b.hi, c.hi ) }; }
+        friend LaneVector multiplySub( LaneVector a, LaneVector b, LaneVector c )
+            { return { _mm256_fmsub_pd( a.lo, b.lo, c.lo ), _mm256_fmsub_pd( a.hi, b.hi, c.hi ) }; }
+    };
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+    /**
+     * @brief Eight Lanes of Doubles, Four SSE2 Registers
+     */
+    struct LaneVector
+    {
+        __m128d v[4];
+
+        static LaneVector load( const double * p )
+            { return { { _mm_load_pd( p ), _mm_load_pd( p + 2 ), _mm_load_pd( p + 4 ), _mm_load_pd( p + 6 ) } }; }
+        static LaneVector broadcast( double d )
+            { const auto b = _mm_set1_pd( d ); return { { b, b, b, b } }; }
+        void store( double * p ) const
+            { _mm_store_pd( p, v[0] ); _mm_store_pd( p + 2, v[1] ); _mm_store_pd( p + 4, v[2] ); _mm_store_pd( p + 6, v[3] ); }
+
+        friend LaneVector operator +( LaneVector a, LaneVector b )
+            { return { { _mm_add_pd( a.v[0], b.v[0] ), _mm_add_pd( a.v[1], b.v[1] ),
+                         _mm_add_pd( a.v[2], b.v[2] ), _mm_add_pd( a.v[3], b.v[3] ) } }; }
+        friend LaneVector operator -( LaneVector a, LaneVector b )
+            { return { { _mm_sub_pd( a.v[0], b.v[0] ), _mm_sub_pd( a.v[1], b.v[1] ),
+                         _mm_sub_pd( a.v[2], b.v[2] ), _mm_sub_pd( a.v[3], b.v[3] ) } }; }
+        friend LaneVector operator *( LaneVector a, LaneVector b )
+            { return { { _mm_mul_pd( a.v[0], b.v[0] ), _mm_mul_pd( a.v[1], b.v[1] ),
+                         _mm_mul_pd( a.v[2], b.v[2] ), _mm_mul_pd( a.v[3], b.v[3] ) } }; }
+
+        // a * b + c and a * b - c, without fusing.
+        friend LaneVector multiplyAdd( LaneVector a, LaneVector b, LaneVector c ) { return a * b + c; }
+        friend LaneVector multiplySub( LaneVector a, LaneVector b, LaneVector c ) { return a * b - c; }
+    };
+#else
+    /**
+     * @brief Eight Lanes of Doubles, Plain Scalars
+     */
+    struct LaneVector
+    {
+        double v[ laneWidth ];
+
+        static LaneVector load( const double * p )
+            { LaneVector r; for ( size_t l = 0; laneWidth != l; ++l ) r.v[l] = p[l]; return r; }
+        static LaneVector broadcast( double d )
+            { LaneVector r; for ( size_t l = 0; laneWidth != l; ++l ) r.v[l] = d; return r; }
+        void store( double * p ) const
+            { for ( size_t l = 0; laneWidth != l; ++l ) p[l] = v[l]; }
+
+        friend LaneVector operator +( LaneVector a, LaneVector b )
+            { for ( size_t l = 0; laneWidth != l; ++l ) a.v[l] += b.v[l]; return a; }
+        friend LaneVector operator -( LaneVector a, LaneVector b )
+            { for ( size_t l = 0; laneWidth != l; ++l ) a.v[l] -= b.v[l]; return a; }
+        friend LaneVector operator *( LaneVector a, LaneVector b )
+            { for ( size_t l = 0; laneWidth != l; ++l ) a.v[l] *= b.v[l]; return a; }
+
+        // a * b + c and a * b - c, without fusing.
+        friend LaneVector multiplyAdd( LaneVector a, LaneVector b, LaneVector c ) { return a * b + c; }
+        friend LaneVector multiplySub( LaneVector a, LaneVector b, LaneVector c ) { return a * b - c; }
+    };
+#endif
+
+#if defined( __AVX512F__ )
+    /**
+     * @brief Sixteen Lanes of Floats, One AVX-512 Register
+     */
+    struct SingleLaneVector
+    {
+        __m512 v;
+
+        static SingleLaneVector load( const float * p ) { return { _mm512_load_ps( p ) }; }
+        void store( float * p ) const { _mm512_store_ps( p, v ); }
+
+        friend SingleLaneVector operator +( SingleLaneVector a, SingleLaneVector b ) { return { _mm512_add_ps( a.v, b.v ) }; }
+        friend SingleLaneVector operator *( SingleLaneVector a, SingleLaneVector b ) { return { _mm512_mul_ps( a.v, b.v ) }; }
+
+        // a * b + c and a * b - c
+        friend SingleLaneVector multiplyAdd( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c )
+            { return { _mm512_fmadd_ps( a.v, b.v, c.v ) }; }
+        friend SingleLaneVector multiplySub( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c )
+            { return { _mm512_fmsub_ps( a.v, b.v, c.v ) }; }
+    };
+#elif defined( __AVX2__ )
+    /**
+     * @brief Sixteen Lanes of Floats, Two AVX2 Registers
+     */
+    struct SingleLaneVector
+    {
+        __m256 lo, hi;
+
+        static SingleLaneVector load( const float * p ) { return { _mm256_load_ps( p ), _mm256_load_ps( p + 8 ) }; }
+        void store( float * p ) const { _mm256_store_ps( p, lo ); _mm256_store_ps( p + 8, hi ); }
+
+        friend SingleLaneVector operator +( SingleLaneVector a, SingleLaneVector b )
+            { return { _mm256_add_ps( a.lo, b.lo ), _mm256_add_ps( a.hi, b.hi ) }; }
+        friend SingleLaneVector operator *( SingleLaneVector a, SingleLaneVector b )
+            { return { _mm256_mul_ps( a.lo, b.lo ), _mm256_mul_ps( a.hi, b.hi ) }; }
+
+        // a * b + c and a * b - c
+        friend SingleLaneVector multiplyAdd( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c )
+            { return { _mm256_fmadd_ps( a.lo, b.lo, c.lo ), _mm256_fmadd_ps( a.hi, b.hi, c.hi ) }; }
+        friend SingleLaneVector multiplySub( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c )
+            { return { _mm256_fmsub_ps( a.lo, b.lo, c.lo ), _mm256_fmsub_ps( a.hi, b.hi, c.hi ) }; }
+    };
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+    /**
+     * @brief Sixteen Lanes of Floats, Four SSE2 Registers
+     */
+    struct SingleLaneVector
+    {
+        __m128 v[4];
+
+        static SingleLaneVector load( const float * p )
+            { return { { _mm_load_ps( p ), _mm_load_ps( p + 4 ), _mm_load_ps( p + 8 ), _mm_load_ps( p + 12 ) } }; }
+        void store( float * p ) const
+            { _mm_store_ps( p, v[0] ); _mm_store_ps( p + 4, v[1] ); _mm_store_ps( p + 8, v[2] ); _mm_store_ps( p + 12, v[3] ); }
+
+        friend SingleLaneVector operator +( SingleLaneVector a, SingleLaneVector b )
+            { return { { _mm_add_ps( a.v[0], b.v[0] ), _mm_add_ps( a.v[1], b.v[1] ),
+                         _mm_add_ps( a.v[2], b.v[2] ), _mm_add_ps( a.v[3], b.v[3] ) } }; }
+        friend SingleLaneVector operator *( SingleLaneVector a, SingleLaneVector b )
+            { return { { _mm_mul_ps( a.v[0], b.v[0] ), _mm_mul_ps( a.v[1], b.v[1] ),
+                         _mm_mul_ps( a.v[2], b.v[2] ), _mm_mul_ps( a.v[3], b.v[3] ) } }; }
+
+        // a * b + c and a * b - c, without fusing.
+        friend SingleLaneVector multiplyAdd( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c ) { return a * b + c; }
+        friend SingleLaneVector multiplySub( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c )
+            { return { { _mm_sub_ps( _mm_mul_ps( a.v[0], b.v[0] ), c.v[0] ), _mm_sub_ps( _mm_mul_ps( a.v[1], b.v[1] ), c.v[1] ),
+                         _mm_sub_ps( _mm_mul_ps( a.v[2], b.v[2] ), c.v[2] ), _mm_sub_ps( _mm_mul_ps( a.v[3], b.v[3] ), c.v[3] ) } }; }
+    };
+#else
+    /**
+     * @brief Sixteen Lanes of Floats, Plain Scalars
+     */
+    struct SingleLaneVector
+    {
+        float v[ singleLaneWidth ];
+
+        static SingleLaneVector load( const float * p )
+            { SingleLaneVector r; for ( size_t l = 0; singleLaneWidth != l; ++l ) r.v[l] = p[l]; return r; }
+        void store( float * p ) const
+            { for ( size_t l = 0; singleLaneWidth != l; ++l ) p[l] = v[l]; }
+
+        friend SingleLaneVector operator +( SingleLaneVector a, SingleLaneVector b )
+            { for ( size_t l = 0; singleLaneWidth != l; ++l ) a.v[l] += b.v[l]; return a; }
+        friend SingleLaneVector operator *( SingleLaneVector a, SingleLaneVector b )
+            { for ( size_t l = 0; singleLaneWidth != l; ++l ) a.v[l] *= b.v[l]; return a; }
+
+        // a * b + c and a * b - c, without fusing.
+        friend SingleLaneVector multiplyAdd( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c ) { return a * b + c; }
+        friend SingleLaneVector multiplySub( SingleLaneVector a, SingleLaneVector b, SingleLaneVector c )
+            { for ( size_t l = 0; singleLaneWidth != l; ++l ) a.v[l] = a.v[l] * b.v[l] - c.v[l]; return a; }
+    };
+#endif
+
+    /**
+     * @brief Complex Phasor Lanes
+     */
+    struct PhasorLanes
+    {
+        LaneVector re, im;
+
+        /**
+         * @brief Rotate by Another Set of Phasor Lanes
+         */
+        void rotate( const PhasorLanes & rate )
+        {
+            const auto newRe = multiplySub( re, rate.re, im * rate.im );
+            im = multiplyAdd( re, rate.im, im * rate.re );
+            re = newRe;
+        }
+
+        /**
+         * @brief First Order Phasor Magnitude Correction
+         *
+         * Pulls phasors that have drifted slightly from the unit circle back onto it. This is a single
+         * Newton step for the reciprocal square root of the squared magnitude near one.
+         */
+        void normalize()
+        {
+            const auto g = ( LaneVector::broadcast( 3.0 ) - multiplyAdd( re, re, im * im ) ) * LaneVector::broadcast( 0.5 );
+            re = re * g;
+            im = im * g;
+        }
+    };
+
+    /**
+     * @brief Complex Phasor Lanes in Single Precision
+     */
+    struct SinglePhasorLanes
+    {
+        SingleLaneVector re, im;
+
+        /**
+         * @brief Rotate by Another Set of Phasor Lanes
+         */
+        void rotate( const SinglePhasorLanes & rate )
+        {
+            const auto newRe = multiplySub( re, rate.re, im * rate.im );
+            im = multiplyAdd( re, rate.im, im * rate.re );
+            re = newRe;
+        }
+    };
+
+    /**
+     * @brief First Order Phasor Magnitude Correction, Scalar Form
+     */
+    inline double normalizationGain( double re, double im )
+    {
+        return ( 3.0 - ( re * re + im * im ) ) * 0.5;
+    }
+
+    inline size_t tileLength( size_t numSamples, size_t tileStart )
+    {
+        return numSamples - tileStart < tileSamples ? numSamples - tileStart : tileSamples;
+    }
+
+    inline void zeroFill( double * p, size_t n )
+    {
+        for ( size_t i = 0; n != i; ++i )
+            p[i] = 0.0;
+    }
+
+    /**
+     * @brief Advance Lane Groups of Tones Across a Tile
+     *
+     * Several lane groups are advanced together so that their independent phasor recurrences
+     * hide one another's multiply latency.
+     *
+     * @tparam numGroups The number of lane groups advanced together.
+     */
+    template < size_t numGroups >
+    inline void accumulateGroups( const ToneBankView & bank, size_t h, size_t tileLen,
+                                  double * accReal, double * accImag )
+    {
+        PhasorLanes phasors[ numGroups ];
+        PhasorLanes rates[ numGroups ];
+        LaneVector mags[ numGroups ];
+        for ( size_t g = 0; numGroups != g; ++g )
+        {
+            const auto offset = h + g * laneWidth;
+            phasors[g] = { LaneVector::load( bank.pPhasorReal + offset ), LaneVector::load( bank.pPhasorImag + offset ) };
+            rates[g] = { LaneVector::load( bank.pRateReal + offset ), LaneVector::load( bank.pRateImag + offset ) };
+            mags[g] = LaneVector::load( bank.pMag + offset );
+        }
+
+        for ( size_t n = 0; tileLen != n; ++n )
+        {
+            auto pAccReal = accReal + n * laneWidth;
+            auto pAccImag = accImag + n * laneWidth;
+            auto sumReal = LaneVector::load( pAccReal );
+            auto sumImag = LaneVector::load( pAccImag );
+            for ( size_t g = 0; numGroups != g; ++g )
+            {
+                sumReal = multiplyAdd( mags[g], phasors[g].re, sumReal );
+                sumImag = multiplyAdd( mags[g], phasors[g].im, sumImag );
+                phasors[g].rotate( rates[g] );
+            }
+            sumReal.store( pAccReal );
+            sumImag.store( pAccImag );
+        }
+
+        for ( size_t g = 0; numGroups != g; ++g )
+        {
+            const auto offset = h + g * laneWidth;
+            phasors[g].normalize();
+            phasors[g].re.store( bank.pPhasorReal + offset );
+            phasors[g].im.store( bank.pPhasorImag + offset );
+        }
+    }
+
+    /**
+     * @brief Advance Lane Groups of Enveloped Tones Across a Tile
+     *
+     * As `accumulateGroups` except that each tone's magnitude is taken, per sample, from a sample major
+     * envelope matrix rather than from the tone bank.
+     *
+     * @tparam numGroups The number of lane groups advanced together.
+     */
+    template < size_t numGroups >
+    inline void accumulateEnvelopedGroups( const ToneBankView & bank, const double * pEnvelope, size_t envelopeStride,
+                                           size_t h, size_t tileLen, double * accReal, double * accImag )
+    {
+        PhasorLanes phasors[ numGroups ];
+        PhasorLanes rates[ numGroups ];
+        for ( size_t g = 0; numGroups != g; ++g )
+        {
+            const auto offset = h + g * laneWidth;
+            phasors[g] = { LaneVector::load( bank.pPhasorReal + offset ), LaneVector::load( bank.pPhasorImag + offset ) };
+            rates[g] = { LaneVector::load( bank.pRateReal + offset ), LaneVector::load( bank.pRateImag + offset ) };
+        }
+
+        for ( size_t n = 0; tileLen != n; ++n )
+        {
+            auto pAccReal = accReal + n * laneWidth;
+            auto pAccImag = accImag + n * laneWidth;
+            auto pEnvelopeRow = pEnvelope + n * envelopeStride + h;
+            auto sumReal = LaneVector::load( pAccReal );
+            auto sumImag = LaneVector::load( pAccImag );
+            for ( size_t g = 0; numGroups != g; ++g )
+            {
+                const auto envelope = LaneVector::load( pEnvelopeRow + g * laneWidth );
+                sumReal = multiplyAdd( envelope, phasors[g].re, sumReal );
+                sumImag = multiplyAdd( envelope, phasors[g].im, sumImag );
+                phasors[g].rotate( rates[g] );
+            }
+            sumReal.store( pAccReal );
+            sumImag.store( pAccImag );
+        }
+
+        for ( size_t g = 0; numGroups != g; ++g )
+        {
+            const auto offset = h + g * laneWidth;
+            phasors[g].normalize();
+            phasors[g].re.store( bank.pPhasorReal + offset );
+            phasors[g].im.store( bank.pPhasorImag + offset );
+        }
+    }
+
+    /**
+     * @brief Reduce the Lane Accumulators of a Tile onto the Output
+     */
+    inline void reduceTile( const double * accReal, const double * accImag, double * pTileOut, size_t tileLen,
+                            bool accumulate )
+    {
+        for ( size_t n = 0; tileLen != n; ++n )
+        {
+            double sumReal = 0.0;
+            double sumImag = 0.0;
+            for ( size_t l = 0; laneWidth != l; ++l )
+            {
+                sumReal += accReal[ n * laneWidth + l ];
+                sumImag += accImag[ n * laneWidth + l ];
+            }
+            if ( accumulate )
+            {
+                pTileOut[ 2 * n ] += sumReal;
+                pTileOut[ 2 * n + 1 ] += sumImag;
+            }
+            else
+            {
+                pTileOut[ 2 * n ] = sumReal;
+                pTileOut[ 2 * n + 1 ] = sumImag;
+            }
+        }
+    }
+
+    /**
+     * @brief Synthesize Tiles, with Constant Magnitudes or from an Envelope Matrix if Provided
+     */
+    void synthesizeTiles( const ToneBankView & bank, const double * pEnvelope, size_t envelopeStride,
+                          FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        alignas( 64 ) double accReal[ tileSamples * laneWidth ];
+        alignas( 64 ) double accImag[ tileSamples * laneWidth ];
+
+        // Complex values are layout compatible with an array of two scalars.
+        auto pOut = reinterpret_cast< double * >( pElementBuffer );
+
+        // Lane groups are advanced four at a time with any remainder advanced individually.
+        constexpr size_t groupsPerPass = 4;
+        const auto passTones = bank.numTones / ( groupsPerPass * laneWidth ) * ( groupsPerPass * laneWidth );
+
+        size_t tileStart = 0;
+        while ( numSamples != tileStart )
+        {
+            const auto tileLen = tileLength( numSamples, tileStart );
+            zeroFill( accReal, tileLen * laneWidth );
+            zeroFill( accImag, tileLen * laneWidth );
+
+            size_t h = 0;
+            if ( pEnvelope )
+            {
+                const auto pTileEnvelope = pEnvelope + tileStart * envelopeStride;
+                for ( ; passTones != h; h += groupsPerPass * laneWidth )
+                    accumulateEnvelopedGroups< groupsPerPass >( bank, pTileEnvelope, envelopeStride, h, tileLen,
+                                                                accReal, accImag );
+                for ( ; bank.numTones != h; h += laneWidth )
+                    accumulateEnvelopedGroups< 1 >( bank, pTileEnvelope, envelopeStride, h, tileLen, accReal, accImag );
+            }
+            else
+            {
+                for ( ; passTones != h; h += groupsPerPass * laneWidth )
+                    accumulateGroups< groupsPerPass >( bank, h, tileLen, accReal, accImag );
+                for ( ; bank.numTones != h; h += laneWidth )
+                    accumulateGroups< 1 >( bank, h, tileLen, accReal, accImag );
+            }
+
+            // Reduce the lane accumulators and write each output sample once.
+            reduceTile( accReal, accImag, pOut + 2 * tileStart, tileLen, accumulate );
+
+            tileStart += tileLen;
+        }
+    }
+
+    void synthesize( const ToneBankView & bank, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                     size_t numSamples, bool accumulate )
+    {
+        synthesizeTiles( bank, nullptr, 0, pElementBuffer, numSamples, accumulate );
+    }
+
+    void synthesizeBatchEnveloped( const ToneBankView & bank, const double * pEnvelope, size_t envelopeStride,
+                                   FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        synthesizeTiles( bank, pEnvelope, envelopeStride, pElementBuffer, numSamples, accumulate );
+    }
+
+    /**
+     * @brief Advance Lane Groups of Chirped Tones Across a Tile
+     *
+     * Each sample, phasors rotate by their rotations, rotations by their sweeps and, if accelerating, sweeps by
+     * their sweep rates. Fewer lane groups are advanced together than for constant rate tones, as each carries
+     * more state.
+     *
+     * @tparam numGroups The number of lane groups advanced together.
+     * @tparam enveloped If true, magnitudes are taken from the envelope matrix rather than from the tone bank.
+     * @tparam accelerating If true, sweeps are advanced by the sweep rates.
+     */
+    template < size_t numGroups, bool enveloped, bool accelerating >
+    inline void accumulateChirpGroups( const ChirpToneBankView & bank, const double * pEnvelope, size_t envelopeStride,
+                                       size_t h, size_t tileLen, double * accReal, double * accImag )
+    {
+        PhasorLanes phasors[ numGroups ];
+        PhasorLanes rates[ numGroups ];
+        PhasorLanes sweeps[ numGroups ];
+        PhasorLanes sweepRates[ numGroups ];
+        LaneVector mags[ numGroups ];
+        for ( size_t g = 0; numGroups != g; ++g )
+        {
+            const auto offset = h + g * laneWidth;
+            phasors[g] = { LaneVector::load( bank.pPhasorReal + offset ), LaneVector::load( bank.pPhasorImag + offset ) };
+            rates[g] = { LaneVector::load( bank.pRateReal + offset ), LaneVector::load( bank.pRateImag + offset ) };
+            sweeps[g] = { LaneVector::load( bank.pSweepReal + offset ), LaneVector::load( bank.pSweepImag + offset ) };
+            if ( accelerating )
+                sweepRates[g] = { LaneVector::load( bank.pSweepRateReal + offset ),
+                                  LaneVector::load( bank.pSweepRateImag + offset ) };
+            if ( !enveloped )
+                mags[g] = LaneVector::load( bank.pMag + offset );
+        }
+
+        for ( size_t n = 0; tileLen != n; ++n )
+        {
+            auto pAccReal = accReal + n * laneWidth;
+            auto pAccImag = accImag + n * laneWidth;
+            auto pEnvelopeRow = enveloped ? pEnvelope + n * envelopeStride + h : nullptr;
+            auto sumReal = LaneVector::load( pAccReal );
+            auto sumImag = LaneVector::load( pAccImag );
+            for ( size_t g = 0; numGroups != g; ++g )
+            {
+                const auto mag = enveloped ? LaneVector::load( pEnvelopeRow + g * laneWidth ) : mags[g];
+                sumReal = multiplyAdd( mag, phasors[g].re, sumReal );
+                sumImag = multiplyAdd( mag, phasors[g].im, sumImag );
+                phasors[g].rotate( rates[g] );
+                rates[g].rotate( sweeps[g] );
+                if ( accelerating )
+                    sweeps[g].rotate( sweepRates[g] );
+            }
+            sumReal.store( pAccReal );
+            sumImag.store( pAccImag );
+        }
+
+        for ( size_t g = 0; numGroups != g; ++g )
+        {
+            const auto offset = h + g * laneWidth;
+            phasors[g].normalize();
+            phasors[g].re.store( bank.pPhasorReal + offset );
+            phasors[g].im.store( bank.pPhasorImag + offset );
+            rates[g].normalize();
+            rates[g].re.store( bank.pRateReal + offset );
+            rates[g].im.store( bank.pRateImag + offset );
+            if ( accelerating )
+            {
+                sweeps[g].normalize();
+                sweeps[g].re.store( bank.pSweepReal + offset );
+                sweeps[g].im.store( bank.pSweepImag + offset );
+            }
+        }
+    }
+
+    /**
+     * @brief Synthesize Chirped Tiles
+     *
+     * @tparam enveloped If true, magnitudes are taken from the envelope matrix rather than from the tone bank.
+     * @tparam accelerating If true, sweeps are advanced by the sweep rates.
+     */
+    template < bool enveloped, bool accelerating >
+    void synthesizeChirpTiles( const ChirpToneBankView & bank, const double * pEnvelope, size_t envelopeStride,
+                               FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        alignas( 64 ) double accReal[ tileSamples * laneWidth ];
+        alignas( 64 ) double accImag[ tileSamples * laneWidth ];
+
+        // Complex values are layout compatible with an array of two scalars.
+        auto pOut = reinterpret_cast< double * >( pElementBuffer );
+
+        // Lane groups are advanced two at a time with any remainder advanced individually.
+        constexpr size_t groupsPerPass = 2;
+        const auto passTones = bank.numTones / ( groupsPerPass * laneWidth ) * ( groupsPerPass * laneWidth );
+
+        size_t tileStart = 0;
+        while ( numSamples != tileStart )
+        {
+            const auto tileLen = tileLength( numSamples, tileStart );
+            const auto pTileEnvelope = enveloped ? pEnvelope + tileStart * envelopeStride : nullptr;
+            zeroFill( accReal, tileLen * laneWidth );
+            zeroFill( accImag, tileLen * laneWidth );
+
+            size_t h = 0;
+            for ( ; passTones != h; h += groupsPerPass * laneWidth )
+                accumulateChirpGroups< groupsPerPass, enveloped, accelerating >( bank, pTileEnvelope, envelopeStride,
+                                                                                 h, tileLen, accReal, accImag );
+            for ( ; bank.numTones != h; h += laneWidth )
+                accumulateChirpGroups< 1, enveloped, accelerating >( bank, pTileEnvelope, envelopeStride,
+                                                                     h, tileLen, accReal, accImag );
+
+            reduceTile( accReal, accImag, pOut + 2 * tileStart, tileLen, accumulate );
+
+            tileStart += tileLen;
+        }
+    }
+
+    void synthesizeChirp( const ChirpToneBankView & bank, const double * pEnvelope, size_t envelopeStride,
+                          FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        const auto accelerating = nullptr != bank.pSweepRateReal;
+        if ( pEnvelope )
+        {
+            if ( accelerating )
+                synthesizeChirpTiles< true, true >( bank, pEnvelope, envelopeStride, pElementBuffer, numSamples, accumulate );
+            else
+                synthesizeChirpTiles< true, false >( bank, pEnvelope, envelopeStride, pElementBuffer, numSamples, accumulate );
+        }
+        else
+        {
+            if ( accelerating )
+                synthesizeChirpTiles< false, true >( bank, nullptr, 0, pElementBuffer, numSamples, accumulate );
+            else
+                synthesizeChirpTiles< false, false >( bank, nullptr, 0, pElementBuffer, numSamples, accumulate );
+        }
+    }
+
+    /**
+     * @brief Advance Single Precision Lane Groups of Tones Across a Tile
+     *
+     * The anchored phasors carry their magnitudes and are discarded at the end of the tile.
+     *
+     * @tparam numGroups The number of lane groups advanced together.
+     */
+    template < size_t numGroups >
+    inline void accumulateSingleGroups( const SingleToneBankView & singleBank, size_t h, size_t tileLen,
+                                        float * accReal, float * accImag )
+    {
+        SinglePhasorLanes phasors[ numGroups ];
+        SinglePhasorLanes rates[ numGroups ];
+        for ( size_t g = 0; numGroups != g; ++g )
+        {
+            const auto offset = h + g * singleLaneWidth;
+            phasors[g] = { SingleLaneVector::load( singleBank.pAnchorReal + offset ),
+                           SingleLaneVector::load( singleBank.pAnchorImag + offset ) };
+            rates[g] = { SingleLaneVector::load( singleBank.pRateReal + offset ),
+                         SingleLaneVector::load( singleBank.pRateImag + offset ) };
+        }
+
+        for ( size_t n = 0; tileLen != n; ++n )
+        {
+            auto pAccReal = accReal + n * singleLaneWidth;
+            auto pAccImag = accImag + n * singleLaneWidth;
+            auto sumReal = SingleLaneVector::load( pAccReal );
+            auto sumImag = SingleLaneVector::load( pAccImag );
+            for ( size_t g = 0; numGroups != g; ++g )
+            {
+                sumReal = sumReal + phasors[g].re;
+                sumImag = sumImag + phasors[g].im;
+                phasors[g].rotate( rates[g] );
+            }
+            sumReal.store( pAccReal );
+            sumImag.store( pAccImag );
+        }
+    }
+
+    void synthesizeSingle( const ToneBankView & bank, const SingleToneBankView & singleBank,
+                           CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        alignas( 64 ) float accReal[ singleTileSamples * singleLaneWidth ];
+        alignas( 64 ) float accImag[ singleTileSamples * singleLaneWidth ];
+
+        // Complex values are layout compatible with an array of two scalars.
+        auto pOut = reinterpret_cast< float * >( pElementBuffer );
+
+        constexpr size_t groupsPerPass = 4;
+        const auto passTones = bank.numTones / ( groupsPerPass * singleLaneWidth ) * ( groupsPerPass * singleLaneWidth );
+
+        size_t tileStart = 0;
+        while ( numSamples != tileStart )
+        {
+            const auto tileLen = numSamples - tileStart < singleTileSamples ? numSamples - tileStart : singleTileSamples;
+
+            // Anchor single precision phasors, magnitudes applied, from the double precision state.
+            for ( size_t i = 0; bank.numTones != i; ++i )
+            {
+                singleBank.pAnchorReal[i] = float( bank.pMag[i] * bank.pPhasorReal[i] );
+                singleBank.pAnchorImag[i] = float( bank.pMag[i] * bank.pPhasorImag[i] );
+            }
+
+            for ( size_t i = 0; tileLen * singleLaneWidth != i; ++i )
+            {
+                accReal[i] = 0.0F;
+                accImag[i] = 0.0F;
+            }
+
+            size_t h = 0;
+            for ( ; passTones != h; h += groupsPerPass * singleLaneWidth )
+                accumulateSingleGroups< groupsPerPass >( singleBank, h, tileLen, accReal, accImag );
+            for ( ; bank.numTones != h; h += singleLaneWidth )
+                accumulateSingleGroups< 1 >( singleBank, h, tileLen, accReal, accImag );
+
+            // Reduce the lane accumulators and write each output sample once.
+            auto pTileOut = pOut + 2 * tileStart;
+            for ( size_t n = 0; tileLen != n; ++n )
+            {
+                float sumReal = 0.0F;
+                float sumImag = 0.0F;
+                for ( size_t l = 0; singleLaneWidth != l; ++l )
+                {
+                    sumReal += accReal[ n * singleLaneWidth + l ];
+                    sumImag += accImag[ n * singleLaneWidth + l ];
+                }
+                if ( accumulate )
+                {
+                    pTileOut[ 2 * n ] += sumReal;
+                    pTileOut[ 2 * n + 1 ] += sumImag;
+                }
+                else
+                {
+                    pTileOut[ 2 * n ] = sumReal;
+                    pTileOut[ 2 * n + 1 ] = sumImag;
+                }
+            }
+
+            // Advance the double precision state across the tile, in one rotation for a whole tile.
+            if ( singleTileSamples == tileLen )
+            {
+                for ( size_t i = 0; bank.numTones != i; ++i )
+                {
+                    const auto re = bank.pPhasorReal[i] * singleBank.pTileRateReal[i] -
+                                    bank.pPhasorImag[i] * singleBank.pTileRateImag[i];
+                    const auto im = bank.pPhasorReal[i] * singleBank.pTileRateImag[i] +
+                                    bank.pPhasorImag[i] * singleBank.pTileRateReal[i];
+                    const auto g = normalizationGain( re, im );
+                    bank.pPhasorReal[i] = re * g;
+                    bank.pPhasorImag[i] = im * g;
+                }
+            }
+            else
+            {
+                for ( size_t n = 0; tileLen != n; ++n )
+                {
+                    for ( size_t i = 0; bank.numTones != i; ++i )
+                    {
+                        const auto re = bank.pPhasorReal[i] * bank.pRateReal[i] - bank.pPhasorImag[i] * bank.pRateImag[i];
+                        bank.pPhasorImag[i] = bank.pPhasorReal[i] * bank.pRateImag[i] + bank.pPhasorImag[i] * bank.pRateReal[i];
+                        bank.pPhasorReal[i] = re;
+                    }
+                }
+                for ( size_t i = 0; bank.numTones != i; ++i )
+                {
+                    const auto g = normalizationGain( bank.pPhasorReal[i], bank.pPhasorImag[i] );
+                    bank.pPhasorReal[i] *= g;
+                    bank.pPhasorImag[i] *= g;
+                }
+            }
+
+            tileStart += tileLen;
+        }
+    }
+
+    void synthesizeEnveloped( double & phasorReal, double & phasorImag, double rateReal, double rateImag,
+                              const double * pEnvelope, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                              size_t numSamples, bool accumulate )
+    {
+        auto pOut = reinterpret_cast< double * >( pElementBuffer );
+        auto pr = phasorReal;
+        auto pi = phasorImag;
+
+        size_t tileStart = 0;
+        while ( numSamples != tileStart )
+        {
+            const auto tileLen = tileLength( numSamples, tileStart );
+            auto pTileOut = pOut + 2 * tileStart;
+            auto pTileEnv = pEnvelope + tileStart;
+            for ( size_t n = 0; tileLen != n; ++n )
+            {
+                const auto env = pTileEnv[n];
+                if ( accumulate )
+                {
+                    pTileOut[ 2 * n ] += env * pr;
+                    pTileOut[ 2 * n + 1 ] += env * pi;
+                }
+                else
+                {
+                    pTileOut[ 2 * n ] = env * pr;
+                    pTileOut[ 2 * n + 1 ] = env * pi;
+                }
+                const auto re = pr * rateReal - pi * rateImag;
+                pi = pr * rateImag + pi * rateReal;
+                pr = re;
+            }
+
+            const auto g = normalizationGain( pr, pi );
+            pr *= g;
+            pi *= g;
+            tileStart += tileLen;
+        }
+
+        phasorReal = pr;
+        phasorImag = pi;
+    }
+
+    void synthesizeRamped( double & phasorReal, double & phasorImag, double rateReal, double rateImag,
+                           double value, double slope, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                           size_t numSamples, bool accumulate )
+    {
+        // As `synthesizeEnveloped`, with the envelope evaluated from the sample index rather than loaded.
+        // It is computed directly, not accumulated, so it does not drift over a long ramp.
+        auto pOut = reinterpret_cast< double * >( pElementBuffer );
+        auto pr = phasorReal;
+        auto pi = phasorImag;
+
+        size_t tileStart = 0;
+        while ( numSamples != tileStart )
+        {
+            const auto tileLen = tileLength( numSamples, tileStart );
+            auto pTileOut = pOut + 2 * tileStart;
+            for ( size_t n = 0; tileLen != n; ++n )
+            {
+                const auto env = value + slope * double( tileStart + n );
+                if ( accumulate )
+                {
+                    pTileOut[ 2 * n ] += env * pr;
+                    pTileOut[ 2 * n + 1 ] += env * pi;
+                }
+                else
+                {
+                    pTileOut[ 2 * n ] = env * pr;
+                    pTileOut[ 2 * n + 1 ] = env * pi;
+                }
+                const auto re = pr * rateReal - pi * rateImag;
+                pi = pr * rateImag + pi * rateReal;
+                pr = re;
+            }
+
+            const auto g = normalizationGain( pr, pi );
+            pr *= g;
+            pi *= g;
+            tileStart += tileLen;
+        }
+
+        phasorReal = pr;
+        phasorImag = pi;
+    }
+}
+
+const KernelTable FusedKernel::REISER_RT_FUSED_KERNEL_VARIANT::kernelTable{ synthesize, synthesizeEnveloped,
+                                                                             synthesizeBatchEnveloped,
+                                                                             synthesizeSingle, synthesizeChirp,
+                                                                             synthesizeRamped };
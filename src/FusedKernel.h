@@ -0,0 +1,277 @@
+/**
+ * @file FusedKernel.h
+ * @brief The specification file for the Fused Sample Major Kernels (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_FUSEDKERNEL_H
+#define REISER_RT_FUSEDKERNEL_H
+
+#include "CombGeneratorKernelVariant.h"
+#include "CombGeneratorSingleElementType.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        namespace FusedKernel
+        {
+            /**
+             * @brief The Number of Tones Advanced Together
+             *
+             * Tone state arrays are padded to a multiple of this. Eight doubles fill one AVX-512 register,
+             * two AVX2 registers or four SSE2 registers. Inner loops are written over this width
+             * so that the compiler can map them onto whatever vector unit it is targeting.
+             */
+            constexpr size_t laneWidth = 8;
+
+            /**
+             * @brief The Number of Tones Advanced Together in Single Precision
+             *
+             * Twice the double precision lane width, so that single precision kernels fill the same registers.
+             */
+            constexpr size_t singleLaneWidth = 2 * laneWidth;
+
+            /**
+             * @brief The Number of Samples per Tile
+             *
+             * The lane accumulators for a tile, `tileSamples * laneWidth` complex values, stay resident in L1.
+             * Phasors are renormalized at the end of each tile.
+             */
+            constexpr size_t tileSamples = 64;
+
+            /**
+             * @brief The Number of Samples per Single Precision Tile
+             *
+             * Single precision phasors are anchored from the double precision tone bank state at the start
+             * of each tile and the double precision state is advanced by a whole tile at its end. Single precision
+             * rounding therefore accumulates over no more than this many samples.
+             */
+            constexpr size_t singleTileSamples = 32;
+
+            /**
+             * @brief Round a Tone Count up to a Multiple of the Single Precision Lane Width
+             *
+             * This is also a multiple of the double precision lane width.
+             */
+            constexpr size_t paddedToneCount( size_t numTones )
+            {
+                return ( numTones + singleLaneWidth - 1 ) / singleLaneWidth * singleLaneWidth;
+            }
+
+            /**
+             * @brief Structure of Arrays View of a Tone Bank
+             *
+             * All arrays are `numTones` long, aligned, with `numTones` a multiple of `laneWidth`, or of
+             * `singleLaneWidth` when used with single precision kernels.
+             * Padding tones must carry a zero magnitude and unit phasors so they contribute nothing.
+             */
+            struct ToneBankView
+            {
+                double * pPhasorReal;           //!< Current phasor, real part. Advanced in place.
+                double * pPhasorImag;           //!< Current phasor, imaginary part. Advanced in place.
+                const double * pRateReal;       //!< Per sample rotation, real part.
+                const double * pRateImag;       //!< Per sample rotation, imaginary part.
+                const double * pMag;            //!< Constant magnitude per tone.
+                size_t numTones;                //!< Padded number of tones.
+            };
+
+            /**
+             * @brief Single Precision Companion to a Tone Bank View
+             *
+             * All arrays are as long as the tone bank they accompany. Padding tones must carry unit rates.
+             */
+            struct SingleToneBankView
+            {
+                float * pAnchorReal;            //!< Scratch for scaled single precision phasors, real part.
+                float * pAnchorImag;            //!< Scratch for scaled single precision phasors, imaginary part.
+                const float * pRateReal;        //!< Per sample rotation in single precision, real part.
+                const float * pRateImag;        //!< Per sample rotation in single precision, imaginary part.
+                const double * pTileRateReal;   //!< Rotation over `singleTileSamples`, real part.
+                const double * pTileRateImag;   //!< Rotation over `singleTileSamples`, imaginary part.
+            };
+
+            /**
+             * @brief Structure of Arrays View of a Chirped Tone Bank
+             *
+             * As a tone bank, except that each tone's rotation advances every sample by its sweep, which itself
+             * advances by its sweep rate. All arrays are `numTones` long, aligned, with `numTones` a multiple of
+             * `laneWidth`. Padding tones must carry a zero magnitude and unit phasors, rotations and sweeps.
+             */
+            struct ChirpToneBankView
+            {
+                double * pPhasorReal;           //!< Current phasor, real part. Advanced in place.
+                double * pPhasorImag;           //!< Current phasor, imaginary part. Advanced in place.
+                double * pRateReal;             //!< Current per sample rotation, real part. Advanced in place.
+                double * pRateImag;             //!< Current per sample rotation, imaginary part. Advanced in place.
+                double * pSweepReal;            //!< Current per sample change of rotation, real part. Advanced in place.
+                double * pSweepImag;            //!< Current per sample change of rotation, imaginary part. Advanced in place.
+                const double * pSweepRateReal;  //!< Per sample change of sweep, real part. Null for a linear chirp.
+                const double * pSweepRateImag;  //!< Per sample change of sweep, imaginary part. Null for a linear chirp.
+                const double * pMag;            //!< Constant magnitude per tone.
+                size_t numTones;                //!< Padded number of tones.
+            };
+
+            /**
+             * @brief Fused Kernel Table
+             *
+             * The kernels are compiled once per instruction set, each into its own nested namespace,
+             * and are reached through one of these tables.
+             */
+            struct KernelTable
+            {
+                /**
+                 * @brief Synthesize the Sum of All Tones, Sample Major
+                 *
+                 * For each tile of samples, every lane group of tones is advanced across the tile while its
+                 * scaled phasors are summed into lane accumulators. The lane accumulators are then reduced
+                 * and each output sample is written once.
+                 *
+                 * @param bank The tone bank. Phasors are advanced by `numSamples`.
+                 * @param pElementBuffer The user buffer.
+                 * @param numSamples The number of samples to produce.
+                 * @param accumulate If true, accumulate onto the buffer. Otherwise, overwrite it.
+                 */
+                void ( * synthesize )( const ToneBankView & bank, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                       size_t numSamples, bool accumulate );
+
+                /**
+                 * @brief Synthesize a Single Enveloped Tone
+                 *
+                 * This is used when an envelope functor delivers a per sample magnitude for one tone.
+                 *
+                 * @param phasorReal The tone phasor, real part. Advanced in place.
+                 * @param phasorImag The tone phasor, imaginary part. Advanced in place.
+                 * @param rateReal The tone rotation, real part.
+                 * @param rateImag The tone rotation, imaginary part.
+                 * @param pEnvelope The per sample magnitude, `numSamples` long.
+                 * @param pElementBuffer The user buffer.
+                 * @param numSamples The number of samples to produce.
+                 * @param accumulate If true, accumulate onto the buffer. Otherwise, overwrite it.
+                 */
+                void ( * synthesizeEnveloped )( double & phasorReal, double & phasorImag,
+                                                double rateReal, double rateImag, const double * pEnvelope,
+                                                FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                size_t numSamples, bool accumulate );
+
+                /**
+                 * @brief Synthesize the Sum of All Tones, Sample Major, with an Envelope Matrix
+                 *
+                 * Like `synthesize` except that each tone's magnitude is taken, per sample, from a sample major
+                 * envelope matrix in place of the tone bank magnitudes.
+                 *
+                 * @param bank The tone bank. Phasors are advanced by `numSamples`.
+                 * @param pEnvelope The envelope matrix, `numSamples` rows. Rows, and so the stride, must be aligned
+                 * as the tone bank arrays are. Columns of padding tones must be zero.
+                 * @param envelopeStride The distance, in elements, between rows of the envelope matrix.
+                 * @param pElementBuffer The user buffer.
+                 * @param numSamples The number of samples to produce.
+                 * @param accumulate If true, accumulate onto the buffer. Otherwise, overwrite it.
+                 */
+                void ( * synthesizeBatchEnveloped )( const ToneBankView & bank, const double * pEnvelope,
+                                                     size_t envelopeStride,
+                                                     FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                     size_t numSamples, bool accumulate );
+
+                /**
+                 * @brief Synthesize the Sum of All Tones, Sample Major, in Single Precision
+                 *
+                 * Like `synthesize` except that the lane accumulators and phasor recurrences are single precision,
+                 * at twice the lane width. At the start of each single precision tile, scaled single precision phasors
+                 * are anchored from the double precision tone bank state, which is then advanced by the tile.
+                 *
+                 * @param bank The tone bank. Phasors are advanced by `numSamples`.
+                 * @param singleBank The single precision companion to the tone bank.
+                 * @param pElementBuffer The user buffer.
+                 * @param numSamples The number of samples to produce.
+                 * @param accumulate If true, accumulate onto the buffer. Otherwise, overwrite it.
+                 */
+                void ( * synthesizeSingle )( const ToneBankView & bank, const SingleToneBankView & singleBank,
+                                             CombGeneratorSingleElementBufferTypePtr pElementBuffer,
+                                             size_t numSamples, bool accumulate );
+
+                /**
+                 * @brief Synthesize the Sum of All Chirped Tones, Sample Major
+                 *
+                 * Like `synthesize` except that every tone's rotation is itself advanced every sample by a second
+                 * order phasor recurrence, and by a third order one when sweep rates are present. Phasors, rotations
+                 * and sweeps are renormalized at the end of each tile. Magnitudes are taken from an envelope matrix
+                 * when one is provided.
+                 *
+                 * @param bank The chirped tone bank. Phasors, rotations and sweeps are advanced by `numSamples`.
+                 * @param pEnvelope The envelope matrix, `numSamples` rows, as for `synthesizeBatchEnveloped`,
+                 * or nullptr to use the tone bank magnitudes.
+                 * @param envelopeStride The distance, in elements, between rows of the envelope matrix.
+                 * @param pElementBuffer The user buffer.
+                 * @param numSamples The number of samples to produce.
+                 * @param accumulate If true, accumulate onto the buffer. Otherwise, overwrite it.
+                 */
+                void ( * synthesizeChirp )( const ChirpToneBankView & bank, const double * pEnvelope,
+                                            size_t envelopeStride, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                            size_t numSamples, bool accumulate );
+
+                /**
+                 * @brief Synthesize a Single Tone Under a Linear Ramp
+                 *
+                 * Like `synthesizeEnveloped` except that the per sample magnitude is `value + slope * n` for
+                 * sample `n`, evaluated as the tone is synthesized rather than read from an envelope buffer.
+                 * This is used for one segment of a piecewise linear envelope.
+                 *
+                 * @param phasorReal The tone phasor, real part. Advanced in place.
+                 * @param phasorImag The tone phasor, imaginary part. Advanced in place.
+                 * @param rateReal The tone rotation, real part.
+                 * @param rateImag The tone rotation, imaginary part.
+                 * @param value The magnitude at the first sample.
+                 * @param slope The magnitude change per sample.
+                 * @param pElementBuffer The user buffer.
+                 * @param numSamples The number of samples to produce.
+                 * @param accumulate If true, accumulate onto the buffer. Otherwise, overwrite it.
+                 */
+                void ( * synthesizeRamped )( double & phasorReal, double & phasorImag,
+                                             double rateReal, double rateImag, double value, double slope,
+                                             FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                             size_t numSamples, bool accumulate );
+            };
+
+            /**
+             * @brief Default Target Kernels, Always Built
+             */
+            namespace Baseline { extern const KernelTable kernelTable; }
+
+            /**
+             * @brief AVX2 and FMA Kernels, Built for x86 Targets
+             */
+            namespace Avx2 { extern const KernelTable kernelTable; }
+
+            /**
+             * @brief AVX-512 Kernels, Built for x86 Targets
+             */
+            namespace Avx512 { extern const KernelTable kernelTable; }
+
+            /**
+             * @brief Select a Kernel Table
+             *
+             * Resolves the API override, the environment variable override and processor support
+             * into a kernel table, as described by CombGeneratorKernelVariant.
+             *
+             * @param selected Receives the variant selected. Never `Automatic`.
+             * @return The kernel table for the variant selected.
+             */
+            const KernelTable & selectKernelTable( CombGeneratorKernelVariant & selected );
+
+            /**
+             * @brief Set the Process Wide Kernel Variant Override
+             *
+             * @param variant The variant to force for subsequently constructed instances,
+             * or `Automatic` to remove the override.
+             */
+            void setKernelVariantOverride( CombGeneratorKernelVariant variant );
+        }
+    }
+}
+
+#endif //REISER_RT_FUSEDKERNEL_H
@@ -0,0 +1,117 @@
+/**
+ * @file FusedKernelDispatch.cpp
+ * @brief The implementation file for Fused Kernel Variant Selection
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "FusedKernel.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined( REISER_RT_FUSED_KERNEL_HAVE_X86_VARIANTS ) && defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+using namespace ReiserRT::Signal;
+using namespace ReiserRT::Signal::FusedKernel;
+
+namespace
+{
+    /**
+     * @brief The Process Wide API Override
+     */
+    std::atomic< CombGeneratorKernelVariant > kernelVariantOverride{ CombGeneratorKernelVariant::Automatic };
+
+    /**
+     * @brief Read the Environment Variable Override
+     *
+     * @return The variant named by `REISER_RT_COMBGENERATOR_KERNEL` or `Automatic` if unset or unrecognized.
+     */
+    CombGeneratorKernelVariant environmentOverride()
+    {
+#ifdef _MSC_VER
+#pragma warning( suppress : 4996 )
+#endif
+        const char * pValue = std::getenv( "REISER_RT_COMBGENERATOR_KERNEL" );
+        if ( !pValue )
+            return CombGeneratorKernelVariant::Automatic;
+        if ( 0 == std::strcmp( pValue, "baseline" ) || 0 == std::strcmp( pValue, "sse2" ) )
+            return CombGeneratorKernelVariant::Baseline;
+        if ( 0 == std::strcmp( pValue, "avx2" ) )
+            return CombGeneratorKernelVariant::Avx2;
+        if ( 0 == std::strcmp( pValue, "avx512" ) )
+            return CombGeneratorKernelVariant::Avx512;
+        return CombGeneratorKernelVariant::Automatic;
+    }
+
+    /**
+     * @brief Determine the Fastest Variant Built and Supported by the Running Processor
+     */
+    CombGeneratorKernelVariant fastestSupported()
+    {
+#if defined( REISER_RT_FUSED_KERNEL_HAVE_X86_VARIANTS ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports( "avx512f" ) && __builtin_cpu_supports( "avx512dq" ) &&
+             __builtin_cpu_supports( "avx512vl" ) )
+            return CombGeneratorKernelVariant::Avx512;
+        if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+            return CombGeneratorKernelVariant::Avx2;
+#elif defined( REISER_RT_FUSED_KERNEL_HAVE_X86_VARIANTS ) && defined( _MSC_VER )
+        // Leaf 1 for FMA and operating system XSAVE support, leaf 7 for AVX2 and AVX-512 (F, DQ and VL).
+        int info[4];
+        __cpuid( info, 0 );
+        const auto maxLeaf = info[0];
+        __cpuid( info, 1 );
+        const bool osXSave = 0 != ( info[2] & ( 1 << 27 ) );
+        const bool fma = 0 != ( info[2] & ( 1 << 12 ) );
+        if ( osXSave && 7 <= maxLeaf )
+        {
+            // The operating system must preserve the YMM (and for AVX-512, the opmask and ZMM) state.
+            const auto xcr0 = _xgetbv( 0 );
+            __cpuidex( info, 7, 0 );
+            const auto ebx = unsigned( info[1] );
+            const bool avx2 = 0 != ( ebx & ( 1u << 5 ) );
+            const bool avx512 = 0 != ( ebx & ( 1u << 16 ) ) && 0 != ( ebx & ( 1u << 17 ) ) &&
+                                0 != ( ebx & ( 1u << 31 ) );
+            if ( avx512 && 0xE6 == ( xcr0 & 0xE6 ) )
+                return CombGeneratorKernelVariant::Avx512;
+            if ( avx2 && fma && 0x6 == ( xcr0 & 0x6 ) )
+                return CombGeneratorKernelVariant::Avx2;
+        }
+#endif
+        return CombGeneratorKernelVariant::Baseline;
+    }
+}
+
+const KernelTable & FusedKernel::selectKernelTable( CombGeneratorKernelVariant & selected )
+{
+    // The API override takes precedence over the environment.
+    auto requested = kernelVariantOverride.load();
+    if ( CombGeneratorKernelVariant::Automatic == requested )
+        requested = environmentOverride();
+
+    // Never exceed what is supported. Enumerators are ordered by capability.
+    const auto supported = fastestSupported();
+    selected = ( CombGeneratorKernelVariant::Automatic == requested || supported < requested ) ? supported : requested;
+
+    switch ( selected )
+    {
+#ifdef REISER_RT_FUSED_KERNEL_HAVE_X86_VARIANTS
+        case CombGeneratorKernelVariant::Avx512:
+            return Avx512::kernelTable;
+        case CombGeneratorKernelVariant::Avx2:
+            return Avx2::kernelTable;
+#endif
+        default:
+            selected = CombGeneratorKernelVariant::Baseline;
+            return Baseline::kernelTable;
+    }
+}
+
+void FusedKernel::setKernelVariantOverride( CombGeneratorKernelVariant variant )
+{
+    kernelVariantOverride.store( variant );
+}
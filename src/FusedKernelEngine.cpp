@@ -0,0 +1,483 @@
+/**
+ * @file FusedKernelEngine.cpp
+ * @brief The implementation file for the Fused Sample Major Kernel Engine
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "FusedKernelEngine.h"
+#include "PhaseArithmetic.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+FusedKernelEngine::FusedKernelEngine( size_t maxHarmonics, const FusedKernel::KernelTable & kernelTable )
+  : kernels{ kernelTable }
+  , phasorReal( FusedKernel::paddedToneCount( maxHarmonics ), 1.0 )
+  , phasorImag( FusedKernel::paddedToneCount( maxHarmonics ), 0.0 )
+  , rateReal( FusedKernel::paddedToneCount( maxHarmonics ), 1.0 )
+  , rateImag( FusedKernel::paddedToneCount( maxHarmonics ), 0.0 )
+  , magnitudes( FusedKernel::paddedToneCount( maxHarmonics ), 0.0 )
+  , tileRateReal( FusedKernel::paddedToneCount( maxHarmonics ), 1.0 )
+  , tileRateImag( FusedKernel::paddedToneCount( maxHarmonics ), 0.0 )
+  , singleRateReal( FusedKernel::paddedToneCount( maxHarmonics ), 1.0F )
+  , singleRateImag( FusedKernel::paddedToneCount( maxHarmonics ), 0.0F )
+  , singleAnchorReal( FusedKernel::paddedToneCount( maxHarmonics ), 0.0F )
+  , singleAnchorImag( FusedKernel::paddedToneCount( maxHarmonics ), 0.0F )
+  , startPhases( maxHarmonics, 0.0 )
+  , toneRates( maxHarmonics, 0.0 )
+  , startPhasorReal( maxHarmonics, 1.0 )
+  , startPhasorImag( maxHarmonics, 0.0 )
+  , sweepReal( FusedKernel::paddedToneCount( maxHarmonics ), 1.0 )
+  , sweepImag( FusedKernel::paddedToneCount( maxHarmonics ), 0.0 )
+  , sweepRateReal( FusedKernel::paddedToneCount( maxHarmonics ), 1.0 )
+  , sweepRateImag( FusedKernel::paddedToneCount( maxHarmonics ), 0.0 )
+{
+}
+
+void FusedKernelEngine::reset( size_t theNumHarmonics, double fundamentalRadiansPerSample,
+                               const double * pMag, const double * pPhase )
+{
+    // A harmonic series is a tone bank at multiples of the fundamental.
+    for ( size_t i = 0; theNumHarmonics != i; ++i )
+        toneRates[i] = double(i+1) * fundamentalRadiansPerSample;
+    resetToneBank( theNumHarmonics, toneRates.data(), pMag, pPhase );
+}
+
+void FusedKernelEngine::resetToneBank( size_t numTones, const double * pRate,
+                                       const double * pMag, const double * pPhase )
+{
+    numHarmonics = numTones;
+    sampleCount = 0;
+    chirped = false;
+
+    for ( size_t i = 0; numHarmonics != i; ++i )
+    {
+        const auto radiansPerSample = pRate[i];
+        toneRates[i] = radiansPerSample;
+        const auto phase = pPhase ? *pPhase++ : 0.0;
+        startPhases[i] = phase;
+        phasorReal[i] = std::cos( phase );
+        phasorImag[i] = std::sin( phase );
+        rateReal[i] = std::cos( radiansPerSample );
+        rateImag[i] = std::sin( radiansPerSample );
+        magnitudes[i] = pMag ? *pMag++ : 1.0;
+
+        // Rotation over a single precision tile, computed directly rather than by repeated rotation.
+        const auto tileRadians = radiansPerSample * double( FusedKernel::singleTileSamples );
+        tileRateReal[i] = std::cos( tileRadians );
+        tileRateImag[i] = std::sin( tileRadians );
+        singleRateReal[i] = float( rateReal[i] );
+        singleRateImag[i] = float( rateImag[i] );
+    }
+
+    // Padding and excess tones contribute nothing.
+    std::fill( phasorReal.begin() + std::ptrdiff_t( numHarmonics ), phasorReal.end(), 1.0 );
+    std::fill( phasorImag.begin() + std::ptrdiff_t( numHarmonics ), phasorImag.end(), 0.0 );
+    std::fill( rateReal.begin() + std::ptrdiff_t( numHarmonics ), rateReal.end(), 1.0 );
+    std::fill( rateImag.begin() + std::ptrdiff_t( numHarmonics ), rateImag.end(), 0.0 );
+    std::fill( magnitudes.begin() + std::ptrdiff_t( numHarmonics ), magnitudes.end(), 0.0 );
+    std::fill( tileRateReal.begin() + std::ptrdiff_t( numHarmonics ), tileRateReal.end(), 1.0 );
+    std::fill( tileRateImag.begin() + std::ptrdiff_t( numHarmonics ), tileRateImag.end(), 0.0 );
+    std::fill( singleRateReal.begin() + std::ptrdiff_t( numHarmonics ), singleRateReal.end(), 1.0F );
+    std::fill( singleRateImag.begin() + std::ptrdiff_t( numHarmonics ), singleRateImag.end(), 0.0F );
+}
+
+void FusedKernelEngine::resetChirp( size_t theNumHarmonics, const CombGeneratorChirpType & theChirp,
+                                    const double * pMag, const double * pPhase )
+{
+    // Magnitudes, starting phases and padding tones are as for a constant rate at the start frequency.
+    reset( theNumHarmonics, theChirp.startRadiansPerSample, pMag, pPhase );
+    chirp = theChirp;
+    chirped = true;
+
+    for ( size_t i = 0; numHarmonics != i; ++i )
+    {
+        startPhasorReal[i] = phasorReal[i];
+        startPhasorImag[i] = phasorImag[i];
+        const auto sweepRateRadians = double(i+1) * 2.0 * chirp.quadraticSweep;
+        sweepRateReal[i] = std::cos( sweepRateRadians );
+        sweepRateImag[i] = std::sin( sweepRateRadians );
+    }
+    std::fill( sweepReal.begin() + std::ptrdiff_t( numHarmonics ), sweepReal.end(), 1.0 );
+    std::fill( sweepImag.begin() + std::ptrdiff_t( numHarmonics ), sweepImag.end(), 0.0 );
+    std::fill( sweepRateReal.begin() + std::ptrdiff_t( numHarmonics ), sweepRateReal.end(), 1.0 );
+    std::fill( sweepRateImag.begin() + std::ptrdiff_t( numHarmonics ), sweepRateImag.end(), 0.0 );
+
+    anchorChirp( 0, numHarmonics, 0 );
+}
+
+void FusedKernelEngine::reset()
+{
+    reset( 0, 0.0, nullptr, nullptr );
+}
+
+void FusedKernelEngine::synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                    const HarmonicEnvelope & envelope, bool accumulate )
+{
+    const FusedKernel::ToneBankView bank{ phasorReal.data(), phasorImag.data(),
+                                          rateReal.data(), rateImag.data(), magnitudes.data(),
+                                          FusedKernel::paddedToneCount( numHarmonics ) };
+
+    // Chirped harmonics are fused into a single pass over the buffer, with or without a batch envelope.
+    if ( chirped )
+    {
+        synthesizeChirp( 0, bank.numTones, sampleCount, pElementBuffer, numSamples, envelope, accumulate );
+    }
+    // Else if no envelope functor, all harmonics are fused into a single pass over the buffer.
+    else if ( !envelope )
+    {
+        kernels.synthesize( bank, pElementBuffer, numSamples, accumulate );
+    }
+    // Else if we have a batch envelope functor, its envelope matrix is applied within the fused pass.
+    else if ( envelope.batchEnvelopeFunk )
+    {
+        synthesizeBatchEnveloped( bank, 0, sampleCount, pElementBuffer, numSamples, envelope, accumulate );
+    }
+    // Else if we have a segment envelope functor, each harmonic's ramps are evaluated as it is synthesized.
+    else if ( envelope.segmentEnvelopeFunk )
+    {
+        synthesizeSegmented( 0, numHarmonics, sampleCount, pElementBuffer, numSamples, envelope, accumulate );
+    }
+    // Else, we have an envelope functor. Each harmonic has its own envelope, delivered one at a time.
+    else
+    {
+        synthesizeEnveloped( 0, numHarmonics, sampleCount, pElementBuffer, numSamples, envelope, accumulate );
+    }
+
+    sampleCount += numSamples;
+}
+
+void FusedKernelEngine::synthesizeSingle( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                          const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // Envelopes are delivered in double precision. We synthesize those, and chirps, in double precision and convert.
+    if ( envelope || chirped )
+    {
+        HarmonicEngine::synthesizeSingle( pElementBuffer, numSamples, envelope, accumulate );
+        return;
+    }
+
+    const FusedKernel::ToneBankView bank{ phasorReal.data(), phasorImag.data(),
+                                          rateReal.data(), rateImag.data(), magnitudes.data(),
+                                          FusedKernel::paddedToneCount( numHarmonics ) };
+    const FusedKernel::SingleToneBankView singleBank{ singleAnchorReal.data(), singleAnchorImag.data(),
+                                                      singleRateReal.data(), singleRateImag.data(),
+                                                      tileRateReal.data(), tileRateImag.data() };
+    kernels.synthesizeSingle( bank, singleBank, pElementBuffer, numSamples, accumulate );
+
+    sampleCount += numSamples;
+}
+
+size_t FusedKernelEngine::getPartitionGranularity() const
+{
+    return FusedKernel::laneWidth;
+}
+
+void FusedKernelEngine::synthesizePartition( size_t firstHarmonic, size_t numPartitionHarmonics, size_t currentSample,
+                                             FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                             const HarmonicEnvelope & envelope )
+{
+    // The range starts on a lane group boundary. A range ending at the number of harmonics is extended
+    // over padding tones, which contribute nothing.
+    const auto numTones = ( numPartitionHarmonics + FusedKernel::laneWidth - 1 ) / FusedKernel::laneWidth *
+                          FusedKernel::laneWidth;
+    const FusedKernel::ToneBankView bank{ phasorReal.data() + firstHarmonic, phasorImag.data() + firstHarmonic,
+                                          rateReal.data() + firstHarmonic, rateImag.data() + firstHarmonic,
+                                          magnitudes.data() + firstHarmonic, numTones };
+    if ( chirped )
+    {
+        synthesizeChirp( firstHarmonic, numTones, currentSample, pElementBuffer, numSamples, envelope, false );
+    }
+    else if ( !envelope )
+    {
+        kernels.synthesize( bank, pElementBuffer, numSamples, false );
+    }
+    else if ( envelope.batchEnvelopeFunk )
+    {
+        synthesizeBatchEnveloped( bank, firstHarmonic, currentSample, pElementBuffer, numSamples, envelope, false );
+    }
+    else if ( envelope.segmentEnvelopeFunk )
+    {
+        synthesizeSegmented( firstHarmonic, numPartitionHarmonics, currentSample,
+                             pElementBuffer, numSamples, envelope, false );
+    }
+    else
+    {
+        synthesizeEnveloped( firstHarmonic, numPartitionHarmonics, currentSample,
+                             pElementBuffer, numSamples, envelope, false );
+    }
+}
+
+void FusedKernelEngine::synthesizeEnveloped( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                             FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                             const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // The first harmonic not muted overwrites the buffer, unless accumulating.
+    auto & envelopeFunk = envelope.envelopeFunk;
+    auto written = accumulate;
+    for ( size_t i = firstHarmonic; firstHarmonic + numRangeHarmonics != i; ++i )
+    {
+        auto pEnvelope = envelopeFunk( currentSample, numSamples, i, magnitudes[i] );
+
+        // A muted harmonic is not synthesized. Its phasor is moved to where it would be after the block.
+        if ( !pEnvelope )
+        {
+            const auto phase = PhaseArithmetic::phaseAt( startPhases[i], toneRates[i], currentSample + numSamples );
+            phasorReal[i] = std::cos( phase );
+            phasorImag[i] = std::sin( phase );
+            continue;
+        }
+
+        kernels.synthesizeEnveloped( phasorReal[i], phasorImag[i], rateReal[i], rateImag[i],
+                                     pEnvelope, pElementBuffer, numSamples, written );
+        written = true;
+    }
+
+    // Every harmonic muted. Getting samples, we must still write zeros.
+    if ( !written )
+        std::fill( pElementBuffer, pElementBuffer + numSamples, FlyingPhasorElementType{} );
+}
+
+void FusedKernelEngine::synthesizeSegmented( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                             FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                             const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // As `synthesizeEnveloped`, a segment of a harmonic at a time. A harmonic's segments cover the block,
+    // so the first harmonic not muted overwrites all of it, unless accumulating.
+    auto & segmentEnvelopeFunk = envelope.segmentEnvelopeFunk;
+    auto written = accumulate;
+    for ( size_t i = firstHarmonic; firstHarmonic + numRangeHarmonics != i; ++i )
+    {
+        const auto segments = segmentEnvelopeFunk( currentSample, numSamples, i, magnitudes[i] );
+
+        // A muted harmonic is not synthesized. Its phasor is moved to where it would be after the block.
+        if ( !segments.numSegments )
+        {
+            const auto phase = PhaseArithmetic::phaseAt( startPhases[i], toneRates[i], currentSample + numSamples );
+            phasorReal[i] = std::cos( phase );
+            phasorImag[i] = std::sin( phase );
+            continue;
+        }
+
+        for ( size_t k = 0; segments.numSegments != k; ++k )
+        {
+            const auto & segment = segments.pSegments[k];
+            const auto segmentEnd =
+                k + 1 != segments.numSegments ? segments.pSegments[ k + 1 ].sampleOffset : numSamples;
+            kernels.synthesizeRamped( phasorReal[i], phasorImag[i], rateReal[i], rateImag[i],
+                                      segment.value, segment.slope, pElementBuffer + segment.sampleOffset,
+                                      segmentEnd - segment.sampleOffset, written );
+        }
+        written = true;
+    }
+
+    // Every harmonic muted. Getting samples, we must still write zeros.
+    if ( !written )
+        std::fill( pElementBuffer, pElementBuffer + numSamples, FlyingPhasorElementType{} );
+}
+
+void FusedKernelEngine::synthesizeChirp( size_t firstHarmonic, size_t numTones, size_t currentSample,
+                                         FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                         const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // Sweep rates are only applied when the sweep itself changes.
+    const auto accelerating = 0.0 != chirp.quadraticSweep;
+    const FusedKernel::ChirpToneBankView bank{ phasorReal.data() + firstHarmonic, phasorImag.data() + firstHarmonic,
+                                               rateReal.data() + firstHarmonic, rateImag.data() + firstHarmonic,
+                                               sweepReal.data() + firstHarmonic, sweepImag.data() + firstHarmonic,
+                                               accelerating ? sweepRateReal.data() + firstHarmonic : nullptr,
+                                               accelerating ? sweepRateImag.data() + firstHarmonic : nullptr,
+                                               magnitudes.data() + firstHarmonic, numTones };
+
+    // Runs end at anchor points and are no longer than an envelope matrix block. The envelope functor fills only
+    // the harmonics of the range.
+    const auto pMatrix = envelope.batchEnvelopeFunk ? envelope.pEnvelopeMatrix + firstHarmonic : nullptr;
+    const auto numRangeHarmonics = std::min( numTones, numHarmonics - firstHarmonic );
+    for ( size_t offset = 0; numSamples != offset; )
+    {
+        const auto sampleIndex = currentSample + offset;
+        const auto toAnchor = chirpAnchorSamples - sampleIndex % chirpAnchorSamples;
+        auto runLen = std::min( numSamples - offset, toAnchor );
+        if ( pMatrix )
+        {
+            runLen = std::min( runLen, combGeneratorBatchEnvelopeBlockSamples );
+            envelope.batchEnvelopeFunk( sampleIndex, runLen, firstHarmonic, numRangeHarmonics,
+                                        pMatrix, envelope.envelopeMatrixStride );
+        }
+        kernels.synthesizeChirp( bank, pMatrix, envelope.envelopeMatrixStride, pElementBuffer + offset,
+                                 runLen, accumulate );
+        offset += runLen;
+        if ( toAnchor == runLen )
+            anchorChirp( firstHarmonic, numRangeHarmonics, sampleIndex + runLen );
+    }
+}
+
+void FusedKernelEngine::anchorChirp( size_t firstHarmonic, size_t numRangeHarmonics, size_t sampleIndex )
+{
+    // The fundamental's phase, rotation and sweep at the sample index. Those of harmonic k are their k-th powers,
+    // formed by successive multiplication from powers computed directly for the first harmonic of the range.
+    const auto n = double( sampleIndex );
+    const auto theta = PhaseArithmetic::chirpPhaseAt( 0.0, chirp.startRadiansPerSample, chirp.linearSweep,
+                                                      chirp.quadraticSweep, sampleIndex );
+    const auto omega = chirp.startRadiansPerSample + ( chirp.linearSweep + chirp.quadraticSweep * n ) * n;
+    const auto delta = chirp.linearSweep + chirp.quadraticSweep * ( 2.0 * n + 1.0 );
+    const auto k = double( firstHarmonic + 1 );
+
+    const auto thetaStepReal = std::cos( theta );
+    const auto thetaStepImag = std::sin( theta );
+    const auto omegaStepReal = std::cos( omega );
+    const auto omegaStepImag = std::sin( omega );
+    const auto deltaStepReal = std::cos( delta );
+    const auto deltaStepImag = std::sin( delta );
+    auto thetaReal = std::cos( PhaseArithmetic::wrap( k * theta ) );
+    auto thetaImag = std::sin( PhaseArithmetic::wrap( k * theta ) );
+    auto omegaReal = std::cos( k * omega );
+    auto omegaImag = std::sin( k * omega );
+    auto deltaReal = std::cos( k * delta );
+    auto deltaImag = std::sin( k * delta );
+
+    for ( size_t i = firstHarmonic; firstHarmonic + numRangeHarmonics != i; ++i )
+    {
+        phasorReal[i] = startPhasorReal[i] * thetaReal - startPhasorImag[i] * thetaImag;
+        phasorImag[i] = startPhasorReal[i] * thetaImag + startPhasorImag[i] * thetaReal;
+        rateReal[i] = omegaReal;
+        rateImag[i] = omegaImag;
+        sweepReal[i] = deltaReal;
+        sweepImag[i] = deltaImag;
+
+        const auto nextThetaReal = thetaReal * thetaStepReal - thetaImag * thetaStepImag;
+        thetaImag = thetaReal * thetaStepImag + thetaImag * thetaStepReal;
+        thetaReal = nextThetaReal;
+        const auto nextOmegaReal = omegaReal * omegaStepReal - omegaImag * omegaStepImag;
+        omegaImag = omegaReal * omegaStepImag + omegaImag * omegaStepReal;
+        omegaReal = nextOmegaReal;
+        const auto nextDeltaReal = deltaReal * deltaStepReal - deltaImag * deltaStepImag;
+        deltaImag = deltaReal * deltaStepImag + deltaImag * deltaStepReal;
+        deltaReal = nextDeltaReal;
+    }
+}
+
+void FusedKernelEngine::synthesizeBatchEnveloped( const FusedKernel::ToneBankView & bank, size_t firstHarmonic,
+                                                  size_t currentSample, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                                  size_t numSamples, const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // The functor fills only the harmonics of the range. The columns of padding tones stay zero.
+    const auto pMatrix = envelope.pEnvelopeMatrix + firstHarmonic;
+    const auto numRangeHarmonics = std::min( bank.numTones, numHarmonics - firstHarmonic );
+    for ( size_t offset = 0; numSamples != offset; )
+    {
+        const auto blockLen = std::min( numSamples - offset, combGeneratorBatchEnvelopeBlockSamples );
+        envelope.batchEnvelopeFunk( currentSample + offset, blockLen, firstHarmonic, numRangeHarmonics,
+                                    pMatrix, envelope.envelopeMatrixStride );
+        kernels.synthesizeBatchEnveloped( bank, pMatrix, envelope.envelopeMatrixStride, pElementBuffer + offset,
+                                          blockLen, accumulate );
+        offset += blockLen;
+    }
+}
+
+void FusedKernelEngine::completePartitions( size_t numSamples )
+{
+    sampleCount += numSamples;
+}
+
+void FusedKernelEngine::retune( double fundamentalRadiansPerSample, const double * pPhase )
+{
+    // Phasors are left as they are. Only the rates change. Starting phases are retained for seeking.
+    for ( size_t i = 0; numHarmonics != i; ++i )
+    {
+        const auto radiansPerSample = double(i+1) * fundamentalRadiansPerSample;
+        toneRates[i] = radiansPerSample;
+        startPhases[i] = pPhase[i];
+        rateReal[i] = std::cos( radiansPerSample );
+        rateImag[i] = std::sin( radiansPerSample );
+
+        const auto tileRadians = radiansPerSample * double( FusedKernel::singleTileSamples );
+        tileRateReal[i] = std::cos( tileRadians );
+        tileRateImag[i] = std::sin( tileRadians );
+        singleRateReal[i] = float( rateReal[i] );
+        singleRateImag[i] = float( rateImag[i] );
+    }
+}
+
+bool FusedKernelEngine::acceptsParameterUpdates() const
+{
+    return true;
+}
+
+void FusedKernelEngine::updateParameters( const double * pMag, const double * pPhase )
+{
+    // Magnitudes are copied into the tone bank. Phasors are left as they are.
+    for ( size_t i = 0; numHarmonics != i; ++i )
+        magnitudes[i] = pMag ? pMag[i] : 1.0;
+
+    // New starting phases move each phasor to where it would be had it been reset with them.
+    if ( pPhase )
+    {
+        std::copy( pPhase, pPhase + numHarmonics, startPhases.begin() );
+        if ( chirped )
+        {
+            for ( size_t i = 0; numHarmonics != i; ++i )
+            {
+                startPhasorReal[i] = std::cos( startPhases[i] );
+                startPhasorImag[i] = std::sin( startPhases[i] );
+            }
+        }
+        seek( sampleCount );
+    }
+}
+
+void FusedKernelEngine::updateMagnitude( size_t nHarmonic, const double * pMag )
+{
+    magnitudes[ nHarmonic ] = pMag[ nHarmonic ];
+}
+
+void FusedKernelEngine::restartHarmonic( size_t nHarmonic, double radiansPerSample, double startPhase,
+                                         const double * pMag )
+{
+    // As `resetToneBank` does for one tone, then moved to the current sample. Appending a tone replaces padding,
+    // so the padding beyond it still contributes nothing.
+    toneRates[ nHarmonic ] = radiansPerSample;
+    startPhases[ nHarmonic ] = startPhase;
+    const auto phase = PhaseArithmetic::phaseAt( startPhase, radiansPerSample, sampleCount );
+    phasorReal[ nHarmonic ] = std::cos( phase );
+    phasorImag[ nHarmonic ] = std::sin( phase );
+    rateReal[ nHarmonic ] = std::cos( radiansPerSample );
+    rateImag[ nHarmonic ] = std::sin( radiansPerSample );
+    magnitudes[ nHarmonic ] = pMag[ nHarmonic ];
+
+    const auto tileRadians = radiansPerSample * double( FusedKernel::singleTileSamples );
+    tileRateReal[ nHarmonic ] = std::cos( tileRadians );
+    tileRateImag[ nHarmonic ] = std::sin( tileRadians );
+    singleRateReal[ nHarmonic ] = float( rateReal[ nHarmonic ] );
+    singleRateImag[ nHarmonic ] = float( rateImag[ nHarmonic ] );
+
+    numHarmonics = std::max( numHarmonics, nHarmonic + 1 );
+}
+
+void FusedKernelEngine::seek( size_t sampleIndex )
+{
+    // Chirped harmonics are anchored as they are at anchor points.
+    if ( chirped )
+    {
+        anchorChirp( 0, numHarmonics, sampleIndex );
+        sampleCount = sampleIndex;
+        return;
+    }
+
+    for ( size_t i = 0; numHarmonics != i; ++i )
+    {
+        const auto phase = PhaseArithmetic::phaseAt( startPhases[i], toneRates[i], sampleIndex );
+        phasorReal[i] = std::cos( phase );
+        phasorImag[i] = std::sin( phase );
+    }
+
+    sampleCount = sampleIndex;
+}
+
+size_t FusedKernelEngine::getSampleCount() const
+{
+    return sampleCount;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file FusedKernelEngine.h
+ * @brief The specification file for the Fused Sample Major Kernel Engine (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_FUSEDKERNELENGINE_H
+#define REISER_RT_FUSEDKERNELENGINE_H
+
+#include "HarmonicEngine.h"
+#include "AlignedAllocator.h"
+#include "FusedKernel.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Fused Sample Major Kernel Engine
+         *
+         * This engine keeps every harmonic's phasor state in a structure of arrays layout
+         * (real, imaginary, rotation and magnitude arrays) and advances all harmonics together over
+         * cache resident sample tiles. Without an envelope functor, the user buffer is written exactly once
+         * per `getSamples` invocation rather than once per harmonic.
+         *
+         * When an envelope functor is registered, each harmonic requires its own envelope buffer which
+         * the functor reuses between invocations. In that case harmonics are synthesized one at a time,
+         * from the same structure of arrays state. A batch envelope functor avoids this. It fills an envelope
+         * matrix, sample major, which the fused kernel applies in place of the magnitudes a lane group at a time.
+         * A harmonic muted by the envelope functor for a block is skipped, its phasor computed directly for the
+         * sample following the block.
+         *
+         * Single precision synthesis, without an envelope functor, runs natively in single precision at twice the
+         * lane width. The double precision state remains the reference, advanced a tile at a time.
+         *
+         * Seeking recomputes each phasor directly from its starting phase, rate and the sample index.
+         *
+         * When chirped, each harmonic's rotation is advanced every sample within the chirp kernel. Phasors, rotations
+         * and sweeps are re-anchored from the analytic chirp phase every `chirpAnchorSamples`, so recurrence error
+         * does not accumulate beyond that. Anchoring costs a few complex multiplications per harmonic, as each
+         * harmonic's state is the matching power of the fundamental's. Single precision samples are synthesized
+         * in double precision and converted.
+         *
+         * The kernels themselves are reached through a kernel table selected for the running processor.
+         */
+        class FusedKernelEngine : public HarmonicEngine
+        {
+        public:
+            FusedKernelEngine( size_t maxHarmonics, const FusedKernel::KernelTable & kernelTable );
+            ~FusedKernelEngine() override = default;
+
+            void reset( size_t numHarmonics, double fundamentalRadiansPerSample,
+                        const double * pMag, const double * pPhase ) override;
+
+            void resetToneBank( size_t numTones, const double * pRate,
+                                const double * pMag, const double * pPhase ) override;
+
+            void resetChirp( size_t numHarmonics, const CombGeneratorChirpType & chirp,
+                             const double * pMag, const double * pPhase ) override;
+
+            void reset() override;
+
+            void synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                             const HarmonicEnvelope & envelope, bool accumulate ) override;
+
+            void synthesizeSingle( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   const HarmonicEnvelope & envelope, bool accumulate ) override;
+
+            size_t getPartitionGranularity() const override;
+
+            void synthesizePartition( size_t firstHarmonic, size_t numPartitionHarmonics, size_t currentSample,
+                                      FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                      const HarmonicEnvelope & envelope ) override;
+
+            void completePartitions( size_t numSamples ) override;
+
+            bool acceptsParameterUpdates() const override;
+
+            void updateParameters( const double * pMag, const double * pPhase ) override;
+
+            void updateMagnitude( size_t nHarmonic, const double * pMag ) override;
+
+            void restartHarmonic( size_t nHarmonic, double radiansPerSample, double startPhase,
+                                  const double * pMag ) override;
+
+            void retune( double fundamentalRadiansPerSample, const double * pPhase ) override;
+
+            void seek( size_t sampleIndex ) override;
+
+            size_t getSampleCount() const override;
+
+            /**
+             * @brief The Number of Samples Between Chirp Anchor Points
+             */
+            static constexpr size_t chirpAnchorSamples = 4 * FusedKernel::tileSamples;
+
+        private:
+            void synthesizeEnveloped( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                      FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                      const HarmonicEnvelope & envelope, bool accumulate );
+
+            void synthesizeSegmented( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                      FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                      const HarmonicEnvelope & envelope, bool accumulate );
+
+            void synthesizeChirp( size_t firstHarmonic, size_t numTones, size_t currentSample,
+                                  FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                  const HarmonicEnvelope & envelope, bool accumulate );
+
+            void anchorChirp( size_t firstHarmonic, size_t numRangeHarmonics, size_t sampleIndex );
+
+            void synthesizeBatchEnveloped( const FusedKernel::ToneBankView & bank, size_t firstHarmonic,
+                                           size_t currentSample, FlyingPhasorElementBufferTypePtr pElementBuffer,
+                                           size_t numSamples, const HarmonicEnvelope & envelope, bool accumulate );
+
+            const FusedKernel::KernelTable & kernels;
+            AlignedScalarVector phasorReal;
+            AlignedScalarVector phasorImag;
+            AlignedScalarVector rateReal;
+            AlignedScalarVector rateImag;
+            AlignedScalarVector magnitudes;
+            AlignedScalarVector tileRateReal;
+            AlignedScalarVector tileRateImag;
+            AlignedSingleVector singleRateReal;
+            AlignedSingleVector singleRateImag;
+            AlignedSingleVector singleAnchorReal;
+            AlignedSingleVector singleAnchorImag;
+            AlignedScalarVector startPhases;
+            AlignedScalarVector toneRates;
+            AlignedScalarVector startPhasorReal;
+            AlignedScalarVector startPhasorImag;
+            AlignedScalarVector sweepReal;
+            AlignedScalarVector sweepImag;
+            AlignedScalarVector sweepRateReal;
+            AlignedScalarVector sweepRateImag;
+            CombGeneratorChirpType chirp{};
+            bool chirped{};
+            size_t numHarmonics{};
+            size_t sampleCount{};
+        };
+    }
+}
+
+#endif //REISER_RT_FUSEDKERNELENGINE_H
@@ -0,0 +1,83 @@
+/**
+ * @file HarmonicEngine.cpp
+ * @brief The implementation file for the Harmonic Engine interface
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "HarmonicEngine.h"
+
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+void HarmonicEngine::synthesizeSingle( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                       const HarmonicEnvelope & envelope, bool accumulate )
+{
+    FlyingPhasorElementType chunk[ conversionChunkSamples ];
+    while ( numSamples )
+    {
+        const auto chunkLen = numSamples < conversionChunkSamples ? numSamples : conversionChunkSamples;
+        synthesize( chunk, chunkLen, envelope, false );
+        for ( size_t n = 0; chunkLen != n; ++n )
+        {
+            const CombGeneratorSingleElementType sample{ float( chunk[n].real() ), float( chunk[n].imag() ) };
+            if ( accumulate )
+                pElementBuffer[n] += sample;
+            else
+                pElementBuffer[n] = sample;
+        }
+        pElementBuffer += chunkLen;
+        numSamples -= chunkLen;
+    }
+}
+
+void HarmonicEngine::resetToneBank( size_t /*numTones*/, const double * /*pRate*/,
+                                    const double * /*pMag*/, const double * /*pPhase*/ )
+{
+    throw std::logic_error{ "This engine does not support tone banks!" };
+}
+
+void HarmonicEngine::resetChirp( size_t /*numHarmonics*/, const CombGeneratorChirpType & /*chirp*/,
+                                 const double * /*pMag*/, const double * /*pPhase*/ )
+{
+    throw std::logic_error{ "This engine does not support chirps!" };
+}
+
+size_t HarmonicEngine::getPartitionGranularity() const
+{
+    return 0;
+}
+
+void HarmonicEngine::synthesizePartition( size_t /*firstHarmonic*/, size_t /*numPartitionHarmonics*/,
+                                          size_t /*currentSample*/, FlyingPhasorElementBufferTypePtr /*pElementBuffer*/,
+                                          size_t /*numSamples*/, const HarmonicEnvelope & /*envelope*/ )
+{
+    throw std::logic_error{ "This engine does not support harmonic partitioned synthesis!" };
+}
+
+void HarmonicEngine::completePartitions( size_t /*numSamples*/ )
+{
+    throw std::logic_error{ "This engine does not support harmonic partitioned synthesis!" };
+}
+
+bool HarmonicEngine::acceptsParameterUpdates() const
+{
+    return false;
+}
+
+void HarmonicEngine::updateParameters( const double * /*pMag*/, const double * /*pPhase*/ )
+{
+    throw std::logic_error{ "This engine does not support parameter updates!" };
+}
+
+void HarmonicEngine::updateMagnitude( size_t /*nHarmonic*/, const double * /*pMag*/ )
+{
+    throw std::logic_error{ "This engine does not support parameter updates!" };
+}
+
+void HarmonicEngine::restartHarmonic( size_t /*nHarmonic*/, double /*radiansPerSample*/, double /*startPhase*/,
+                                      const double * /*pMag*/ )
+{
+    throw std::logic_error{ "This engine does not support parameter updates!" };
+}
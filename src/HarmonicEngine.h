@@ -0,0 +1,265 @@
+/**
+ * @file HarmonicEngine.h
+ * @brief The specification file for the Harmonic Engine interface (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_HARMONICENGINE_H
+#define REISER_RT_HARMONICENGINE_H
+
+#include "CombGeneratorEnvelopeFunkType.h"
+#include "CombGeneratorBatchEnvelopeFunkType.h"
+#include "CombGeneratorSegmentEnvelopeFunkType.h"
+#include "CombGeneratorSingleElementType.h"
+#include "CombGeneratorChirpType.h"
+#include "FlyingPhasorToneGeneratorDataTypes.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief The Envelope Registered at Reset, in Any Form
+         *
+         * At most one of the functors is non-empty. A batch envelope functor is accompanied by the envelope matrix,
+         * `combGeneratorBatchEnvelopeBlockSamples` rows of `envelopeMatrixStride` elements, owned by the CombGenerator.
+         * Columns beyond the number of harmonics are zero.
+         */
+        struct HarmonicEnvelope
+        {
+            CombGeneratorEnvelopeFunkType envelopeFunk{};
+            CombGeneratorBatchEnvelopeFunkType batchEnvelopeFunk{};
+            CombGeneratorSegmentEnvelopeFunkType segmentEnvelopeFunk{};
+            double * pEnvelopeMatrix{};
+            size_t envelopeMatrixStride{};
+
+            /**
+             * @brief Query Whether Any Envelope is Registered
+             */
+            explicit operator bool() const { return envelopeFunk || batchEnvelopeFunk || segmentEnvelopeFunk; }
+        };
+
+        /**
+         * @brief Harmonic Engine Interface
+         *
+         * This is the interface the CombGenerator implementation uses to drive a particular synthesis engine.
+         * Engines are not exposed to clients. They are selected by CombGeneratorEngineType at construction.
+         * The CombGenerator implementation validates arguments and handles the zero harmonic case
+         * before delegating to an engine.
+         */
+        class HarmonicEngine
+        {
+        public:
+            HarmonicEngine() = default;
+            virtual ~HarmonicEngine() = default;
+
+            HarmonicEngine( const HarmonicEngine & another ) = delete;
+            HarmonicEngine & operator =( const HarmonicEngine & another ) = delete;
+
+            /**
+             * @brief Reset for a Harmonic Series
+             *
+             * @param numHarmonics The number of harmonics to generate. Never more than constructed for.
+             * @param fundamentalRadiansPerSample The fundamental frequency in radians per sample.
+             * @param pMag Pointer to `numHarmonics` magnitudes, or nullptr for unity. The storage is kept
+             * alive by the CombGenerator until the next reset.
+             * @param pPhase Pointer to `numHarmonics` starting phases, or nullptr for zero. Only valid during this call.
+             */
+            virtual void reset( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                const double * pMag, const double * pPhase ) = 0;
+
+            /**
+             * @brief Reset for a Bank of Tones at Arbitrary Rates
+             *
+             * As `reset` except that each tone's rate is given rather than being a multiple of a fundamental.
+             * Tones are otherwise treated as harmonics are, in the order given. The default implementation throws
+             * `std::logic_error`.
+             *
+             * @param numTones The number of tones to generate. Never more than constructed for.
+             * @param pRate Pointer to `numTones` rates in radians per sample. Only valid during this call.
+             * @param pMag Pointer to `numTones` magnitudes, or nullptr for unity. The storage is kept
+             * alive by the CombGenerator until the next reset.
+             * @param pPhase Pointer to `numTones` starting phases, or nullptr for zero. Only valid during this call.
+             */
+            virtual void resetToneBank( size_t numTones, const double * pRate,
+                                        const double * pMag, const double * pPhase );
+
+            /**
+             * @brief Reset for a Chirped Harmonic Series
+             *
+             * As `reset` except that the fundamental frequency sweeps as the chirp describes. Harmonic `k` sweeps at
+             * `k` times the fundamental. The default implementation throws `std::logic_error`.
+             *
+             * @param numHarmonics The number of harmonics to generate. Never more than constructed for.
+             * @param chirp The fundamental frequency sweep.
+             * @param pMag Pointer to `numHarmonics` magnitudes, or nullptr for unity. The storage is kept
+             * alive by the CombGenerator until the next reset.
+             * @param pPhase Pointer to `numHarmonics` starting phases, or nullptr for zero. Only valid during this call.
+             */
+            virtual void resetChirp( size_t numHarmonics, const CombGeneratorChirpType & chirp,
+                                     const double * pMag, const double * pPhase );
+
+            /**
+             * @brief Pure Reset, Return to Freshly Constructed State
+             */
+            virtual void reset() = 0;
+
+            /**
+             * @brief Produce Samples Overwriting, or Accumulating onto, the User Buffer
+             *
+             * @param pElementBuffer User provided buffer large enough to hold `numSamples`.
+             * @param numSamples The number of samples to produce.
+             * @param envelope The envelope registered at reset which may be empty.
+             * @param accumulate If true, samples are accumulated onto the buffer. Otherwise, the buffer is overwritten.
+             */
+            virtual void synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                     const HarmonicEnvelope & envelope, bool accumulate ) = 0;
+
+            /**
+             * @brief Produce Single Precision Samples Overwriting, or Accumulating onto, the User Buffer
+             *
+             * The default implementation synthesizes double precision samples in chunks of `conversionChunkSamples`
+             * and converts them. An envelope functor is therefore invoked once per harmonic, or once, per chunk.
+             * Engines able to compute in single precision override this.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold `numSamples`.
+             * @param numSamples The number of samples to produce.
+             * @param envelope The envelope registered at reset which may be empty.
+             * @param accumulate If true, samples are accumulated onto the buffer. Otherwise, the buffer is overwritten.
+             */
+            virtual void synthesizeSingle( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                           const HarmonicEnvelope & envelope, bool accumulate );
+
+            /**
+             * @brief Query the Harmonic Partition Granularity
+             *
+             * Engines able to synthesize a range of harmonics independently of the others support harmonic
+             * partitioned synthesis. The default implementation returns zero, indicating no such support.
+             *
+             * @return The multiple of which partition boundaries must be, or zero if not supported.
+             */
+            virtual size_t getPartitionGranularity() const;
+
+            /**
+             * @brief Produce the Contribution of a Range of Harmonics, Overwriting the Buffer
+             *
+             * Partitions of disjoint harmonic ranges may be synthesized concurrently, each into its own buffer.
+             * The harmonics of the range advance but the engine sample count does not. Once every partition of
+             * the harmonic series has been synthesized for `numSamples`, `completePartitions` must be invoked.
+             * The default implementation throws `std::logic_error`.
+             *
+             * @param firstHarmonic The first harmonic of the range. A multiple of the partition granularity.
+             * @param numPartitionHarmonics The number of harmonics in the range. A multiple of the partition
+             * granularity unless the range ends at the number of harmonics.
+             * @param currentSample The engine sample count, to be reported to the envelope functor.
+             * @param pElementBuffer Buffer large enough to hold `numSamples`.
+             * @param numSamples The number of samples to produce.
+             * @param envelope The envelope registered at reset which may be empty.
+             */
+            virtual void synthesizePartition( size_t firstHarmonic, size_t numPartitionHarmonics, size_t currentSample,
+                                              FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                              const HarmonicEnvelope & envelope );
+
+            /**
+             * @brief Advance the Sample Count After Partitioned Synthesis
+             *
+             * The default implementation throws `std::logic_error`.
+             *
+             * @param numSamples The number of samples each partition produced.
+             */
+            virtual void completePartitions( size_t numSamples );
+
+            /**
+             * @brief Change the Fundamental Rate, Retaining Phase Continuity
+             *
+             * Each harmonic continues from its phase at the current sample count at its new rate. The sample count
+             * is retained. Only the harmonics of the last reset are visited.
+             *
+             * @param fundamentalRadiansPerSample The new fundamental frequency in radians per sample.
+             * @param pPhase Pointer to `numHarmonics` starting phases, continuing each harmonic at its new rate, as
+             * if reset with these at sample index zero. Engines with phasor state of their own may prefer it.
+             * Only valid during this call.
+             */
+            virtual void retune( double fundamentalRadiansPerSample, const double * pPhase ) = 0;
+
+            /**
+             * @brief Query Whether the Engine Accepts Parameter Updates
+             *
+             * The default implementation returns false.
+             *
+             * @return True if `updateParameters` is supported.
+             */
+            virtual bool acceptsParameterUpdates() const;
+
+            /**
+             * @brief Update Magnitudes, and Optionally Starting Phases, Without a Reset
+             *
+             * Phasors are not reset for a magnitude update, so phase continuity is retained. New starting phases
+             * apply from sample index zero, as they do for `reset`, and every harmonic is moved to the phase
+             * it would have at the current sample count. The default implementation throws `std::logic_error`.
+             *
+             * @param pMag Pointer to `numHarmonics` magnitudes, or nullptr for unity. The storage is kept
+             * alive by the CombGenerator until the next update or reset.
+             * @param pPhase Pointer to `numHarmonics` starting phases, or nullptr to retain the starting phases.
+             * Only valid during this call.
+             */
+            virtual void updateParameters( const double * pMag, const double * pPhase );
+
+            /**
+             * @brief Update the Magnitude of One Harmonic Without a Reset
+             *
+             * Only supported by engines accepting parameter updates. Other harmonics are not touched.
+             * The default implementation throws `std::logic_error`.
+             *
+             * @param nHarmonic The zero based harmonic whose magnitude changed. Less than the number of harmonics.
+             * @param pMag Pointer to the magnitudes in effect, which must not be nullptr. The storage is kept alive
+             * by the CombGenerator until the next update or reset.
+             */
+            virtual void updateMagnitude( size_t nHarmonic, const double * pMag );
+
+            /**
+             * @brief Restart One Harmonic Without a Reset
+             *
+             * The harmonic is given a new rate and starting phase, and moved to the phase it has at the current
+             * sample count. Its magnitude is taken from `pMag`. Other harmonics are not touched. A harmonic one
+             * past the last is appended. Only supported by engines accepting parameter updates and never for chirps.
+             * The default implementation throws `std::logic_error`.
+             *
+             * @param nHarmonic The zero based harmonic. No more than the number of harmonics and less than
+             * constructed for.
+             * @param radiansPerSample The rate of the harmonic in radians per sample.
+             * @param startPhase The phase of the harmonic at sample index zero.
+             * @param pMag Pointer to the magnitudes in effect, which must not be nullptr. The storage is kept alive
+             * by the CombGenerator until the next update or reset.
+             */
+            virtual void restartHarmonic( size_t nHarmonic, double radiansPerSample, double startPhase,
+                                          const double * pMag );
+
+            /**
+             * @brief Move Every Harmonic to a Sample Index Without Producing Samples
+             *
+             * Harmonic phases are computed directly for the sample index. No samples are synthesized.
+             *
+             * @param sampleIndex The sample index, relative to the last reset, of the next sample to be produced.
+             */
+            virtual void seek( size_t sampleIndex ) = 0;
+
+            /**
+             * @brief Query the Sample Index of the Next Sample to be Produced
+             *
+             * @return The number of samples produced, or skipped over, since the last reset.
+             */
+            virtual size_t getSampleCount() const = 0;
+
+            /**
+             * @brief The Number of Samples Converted at a Time by the Default Single Precision Implementation
+             */
+            static constexpr size_t conversionChunkSamples = 256;
+        };
+    }
+}
+
+#endif //REISER_RT_HARMONICENGINE_H
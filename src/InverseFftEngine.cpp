@@ -0,0 +1,241 @@
+/**
+ * @file InverseFftEngine.cpp
+ * @brief The implementation file for the Inverse FFT Block Synthesis Engine
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "InverseFftEngine.h"
+#include "PhaseArithmetic.h"
+
+#include <cmath>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    /**
+     * @brief The Series Remainder, Relative to Harmonic Magnitude, Considered Negligible
+     */
+    constexpr double negligibleRemainder = 1e-18;
+
+    /**
+     * @brief The Normalized Time Half Width
+     */
+    constexpr double halfBlock = 0.5 * double( InverseFftEngine::blockSamples );
+
+    /**
+     * @brief The Block Center
+     */
+    constexpr double blockCenter = 0.5 * double( InverseFftEngine::blockSamples - 1 );
+
+    /**
+     * @brief Bessel Function of the First Kind by Power Series
+     *
+     * Only ever evaluated for arguments no larger than pi / 4 in magnitude where the series
+     * converges in a handful of terms without cancellation.
+     */
+    double besselJ( size_t order, double x )
+    {
+        const auto halfX = 0.5 * x;
+        double term = 1.0;
+        for ( size_t m = 1; order >= m; ++m )
+            term *= halfX / double( m );
+
+        double sum = term;
+        for ( size_t m = 1; 32 != m; ++m )
+        {
+            term *= -halfX * halfX / ( double( m ) * double( m + order ) );
+            sum += term;
+            if ( std::abs( term ) <= 1e-20 * std::abs( sum ) ) break;
+        }
+        return sum;
+    }
+}
+
+InverseFftEngine::InverseFftEngine( size_t theMaxHarmonics )
+  : spectrumReal( fftSize )
+  , spectrumImag( fftSize )
+  , blockReal( blockSamples )
+  , blockImag( blockSamples )
+  , normalizedTime( blockSamples )
+  , chebyshevPrevious( blockSamples )
+  , chebyshevCurrent( blockSamples )
+  , maxHarmonics{ theMaxHarmonics }
+  , startPhases( theMaxHarmonics )
+  , rates( theMaxHarmonics )
+  , offsetPhases( theMaxHarmonics )
+  , besselTable( theMaxHarmonics * maxSeriesTerms )
+  , blockPhasorReal( theMaxHarmonics )
+  , blockPhasorImag( theMaxHarmonics )
+  , bins( theMaxHarmonics )
+{
+    for ( size_t t = 0; blockSamples != t; ++t )
+        normalizedTime[t] = ( double( t ) - blockCenter ) / halfBlock;
+}
+
+void InverseFftEngine::reset( size_t theNumHarmonics, double fundamentalRadiansPerSample,
+                              const double * pMag, const double * pPhase )
+{
+    pMagnitudes = pMag;
+    numHarmonics = theNumHarmonics;
+    sampleCount = 0;
+    blockIndex = blockSamples;
+
+    double maxOffsetRate = 0.0;
+    for ( size_t i = 0; numHarmonics != i; ++i )
+    {
+        const auto rate = double( i + 1 ) * fundamentalRadiansPerSample;
+        startPhases[i] = pPhase ? pPhase[i] : 0.0;
+        rates[i] = rate;
+
+        // Nearest bin to the aliased rate, and what remains as a fraction of a bin.
+        const auto binPosition = PhaseArithmetic::wrap( rate ) * double( fftSize ) / ( 2.0 * M_PI );
+        const auto nearestBin = std::nearbyint( binPosition );
+        const auto fraction = binPosition - nearestBin;
+        bins[i] = nearestBin < 0.0 ? size_t( nearestBin + double( fftSize ) ) : size_t( nearestBin );
+        offsetPhases[i] = 2.0 * M_PI * fraction * blockCenter / double( fftSize );
+
+        // The offset rate in normalized time. The Jacobi-Anger expansion of e^(j rate u) has coefficients
+        // J0(rate) followed by 2 j^n Jn(rate). The powers of j are common to all harmonics and applied later.
+        const auto offsetRate = 2.0 * M_PI * fraction * halfBlock / double( fftSize );
+        for ( size_t term = 0; maxSeriesTerms != term; ++term )
+            besselTable[ term * maxHarmonics + i ] = ( term ? 2.0 : 1.0 ) * besselJ( term, offsetRate );
+
+        if ( maxOffsetRate < std::abs( offsetRate ) ) maxOffsetRate = std::abs( offsetRate );
+    }
+
+    // Take only as many terms as the largest offset requires, bounding each omitted coefficient
+    // by 2 (x/2)^n / n!. A comb entirely on bins needs just one.
+    numTerms = 1;
+    double bound = maxOffsetRate;
+    while ( maxSeriesTerms != numTerms && negligibleRemainder < bound )
+    {
+        ++numTerms;
+        bound *= 0.5 * maxOffsetRate / double( numTerms );
+    }
+}
+
+void InverseFftEngine::reset()
+{
+    pMagnitudes = nullptr;
+    numHarmonics = 0;
+    numTerms = 1;
+    sampleCount = 0;
+    blockIndex = blockSamples;
+}
+
+void InverseFftEngine::synthesizeBlock()
+{
+    // Each harmonic's phasor at the block center, less its nearest bin contribution.
+    for ( size_t i = 0; numHarmonics != i; ++i )
+    {
+        const auto phase = PhaseArithmetic::phaseAt( startPhases[i], rates[i], sampleCount ) + offsetPhases[i];
+        const auto mag = pMagnitudes ? pMagnitudes[i] : 1.0;
+        blockPhasorReal[i] = mag * std::cos( phase );
+        blockPhasorImag[i] = mag * std::sin( phase );
+    }
+
+    for ( size_t t = 0; blockSamples != t; ++t )
+    {
+        blockReal[t] = 0.0;
+        blockImag[t] = 0.0;
+        chebyshevPrevious[t] = 0.0;
+        chebyshevCurrent[t] = 1.0;
+    }
+
+    for ( size_t term = 0; numTerms != term; ++term )
+    {
+        for ( size_t b = 0; fftSize != b; ++b )
+        {
+            spectrumReal[b] = 0.0;
+            spectrumImag[b] = 0.0;
+        }
+        const auto pBessel = besselTable.data() + term * maxHarmonics;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            spectrumReal[ bins[i] ] += pBessel[i] * blockPhasorReal[i];
+            spectrumImag[ bins[i] ] += pBessel[i] * blockPhasorImag[i];
+        }
+
+        inverseFft.transformFirstHalf( spectrumReal.data(), spectrumImag.data() );
+
+        // Weigh by j^n T(n) and advance the Chebyshev recurrence, T(1) = u and T(n+1) = 2 u T(n) - T(n-1).
+        static constexpr double powersOfJ[4][2] = { { 1.0, 0.0 }, { 0.0, 1.0 }, { -1.0, 0.0 }, { 0.0, -1.0 } };
+        const auto jr = powersOfJ[ term % 4 ][0];
+        const auto ji = powersOfJ[ term % 4 ][1];
+        for ( size_t t = 0; blockSamples != t; ++t )
+        {
+            const auto chebyshev = chebyshevCurrent[t];
+            blockReal[t] += chebyshev * ( jr * spectrumReal[t] - ji * spectrumImag[t] );
+            blockImag[t] += chebyshev * ( jr * spectrumImag[t] + ji * spectrumReal[t] );
+
+            const auto next = term ? 2.0 * normalizedTime[t] * chebyshev - chebyshevPrevious[t]
+                                   : normalizedTime[t];
+            chebyshevPrevious[t] = chebyshev;
+            chebyshevCurrent[t] = next;
+        }
+    }
+
+    blockIndex = 0;
+}
+
+template < typename ElementType >
+void InverseFftEngine::deliver( ElementType * pElementBuffer, size_t numSamples, bool accumulate )
+{
+    using ValueType = typename ElementType::value_type;
+    while ( numSamples )
+    {
+        if ( blockSamples == blockIndex )
+            synthesizeBlock();
+
+        const auto available = blockSamples - blockIndex;
+        const auto runLen = numSamples < available ? numSamples : available;
+        for ( size_t n = 0; runLen != n; ++n )
+        {
+            const ElementType sample{ ValueType( blockReal[ blockIndex + n ] ), ValueType( blockImag[ blockIndex + n ] ) };
+            if ( accumulate )
+                pElementBuffer[n] += sample;
+            else
+                pElementBuffer[n] = sample;
+        }
+
+        pElementBuffer += runLen;
+        numSamples -= runLen;
+        blockIndex += runLen;
+        sampleCount += runLen;
+    }
+}
+
+void InverseFftEngine::synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   const HarmonicEnvelope & /*envelope*/, bool accumulate )
+{
+    deliver( pElementBuffer, numSamples, accumulate );
+}
+
+void InverseFftEngine::synthesizeSingle( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                         const HarmonicEnvelope & /*envelope*/, bool accumulate )
+{
+    // Blocks are synthesized in double precision regardless. Conversion is all that differs.
+    deliver( pElementBuffer, numSamples, accumulate );
+}
+
+void InverseFftEngine::retune( double fundamentalRadiansPerSample, const double * pPhase )
+{
+    // Bins and series coefficients depend upon the rates. We set up anew and resume at the sample count.
+    const auto currentSample = sampleCount;
+    reset( numHarmonics, fundamentalRadiansPerSample, pMagnitudes, pPhase );
+    seek( currentSample );
+}
+
+void InverseFftEngine::seek( size_t sampleIndex )
+{
+    // The next block starts at the sample index. Block phases are computed from it.
+    sampleCount = sampleIndex;
+    blockIndex = blockSamples;
+}
+
+size_t InverseFftEngine::getSampleCount() const
+{
+    return sampleCount;
+}
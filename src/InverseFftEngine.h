@@ -0,0 +1,120 @@
+/**
+ * @file InverseFftEngine.h
+ * @brief The specification file for the Inverse FFT Block Synthesis Engine (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_INVERSEFFTENGINE_H
+#define REISER_RT_INVERSEFFTENGINE_H
+
+#include "HarmonicEngine.h"
+#include "AlignedAllocator.h"
+#include "RadixTwoInverseFft.h"
+
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Inverse FFT Block Synthesis Engine
+         *
+         * Samples are synthesized a block of `blockSamples` at a time. Each harmonic is placed at its nearest
+         * bin of an inverse FFT twice the block length. What remains is a fractional bin offset, which within the
+         * block is a slow complex exponential about the block center. It is expanded in Chebyshev polynomials of
+         * time (the Jacobi-Anger expansion), whose coefficients are Bessel functions of the offset.
+         * Each term of the series is a sparse spectrum, transformed separately, and weighted by its Chebyshev
+         * polynomial when summed. The series is truncated where its remainder falls below double precision rounding.
+         *
+         * The phase of each harmonic at the start of each block is computed directly from the sample count,
+         * not carried from block to block. There is no error accumulation across blocks.
+         *
+         * The cost per sample grows with the logarithm of the block size rather than with the number of
+         * harmonics, with a small per harmonic cost per block. This engine does not support envelope functors.
+         */
+        class InverseFftEngine : public HarmonicEngine
+        {
+        public:
+            /**
+             * @brief The Number of Samples Synthesized per Block
+             */
+            static constexpr size_t blockSamples = 1024;
+
+            /**
+             * @brief The Inverse FFT Size
+             *
+             * Twice the block size bounds the fractional bin offset phase excursion over a block to pi / 4 radians.
+             */
+            static constexpr size_t fftSize = 2 * blockSamples;
+
+            /**
+             * @brief The Maximum Number of Chebyshev Series Terms
+             *
+             * The offset phase excursion over a block never exceeds pi / 4 radians. The remainder after
+             * sixteen terms is below 1e-20 of the harmonic magnitude.
+             */
+            static constexpr size_t maxSeriesTerms = 16;
+
+            explicit InverseFftEngine( size_t maxHarmonics );
+            ~InverseFftEngine() override = default;
+
+            void reset( size_t numHarmonics, double fundamentalRadiansPerSample,
+                        const double * pMag, const double * pPhase ) override;
+
+            void reset() override;
+
+            void synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                             const HarmonicEnvelope & envelope, bool accumulate ) override;
+
+            void synthesizeSingle( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   const HarmonicEnvelope & envelope, bool accumulate ) override;
+
+            void retune( double fundamentalRadiansPerSample, const double * pPhase ) override;
+
+            void seek( size_t sampleIndex ) override;
+
+            size_t getSampleCount() const override;
+
+        private:
+            /**
+             * @brief Deliver Samples from Blocks, Synthesizing Blocks as Required
+             */
+            template < typename ElementType >
+            void deliver( ElementType * pElementBuffer, size_t numSamples, bool accumulate );
+
+            /**
+             * @brief Synthesize the Block Starting at the Current Sample Count
+             */
+            void synthesizeBlock();
+
+            RadixTwoInverseFft inverseFft{ fftSize };
+            AlignedScalarVector spectrumReal;
+            AlignedScalarVector spectrumImag;
+            AlignedScalarVector blockReal;
+            AlignedScalarVector blockImag;
+            AlignedScalarVector normalizedTime;     // Block time relative to center, scaled to [-1, 1].
+            AlignedScalarVector chebyshevPrevious;  // Chebyshev polynomials of normalized time,
+            AlignedScalarVector chebyshevCurrent;   // for the previous and current series term.
+
+            // Per harmonic state.
+            const size_t maxHarmonics;
+            AlignedScalarVector startPhases;
+            AlignedScalarVector rates;
+            AlignedScalarVector offsetPhases;       // The fractional bin offset phase at block center.
+            AlignedScalarVector besselTable;        // Series coefficients, series term major.
+            AlignedScalarVector blockPhasorReal;    // Each harmonic's phasor at the block center, less its bin.
+            AlignedScalarVector blockPhasorImag;
+            std::vector< size_t > bins;
+
+            const double * pMagnitudes{};
+            size_t numHarmonics{};
+            size_t numTerms{ 1 };
+            size_t sampleCount{};
+            size_t blockIndex{ blockSamples };      // Index into the current block. Exhausted initially.
+        };
+    }
+}
+
+#endif //REISER_RT_INVERSEFFTENGINE_H
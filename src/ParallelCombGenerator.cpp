@@ -0,0 +1,132 @@
+/**
+ * @file ParallelCombGenerator.cpp
+ * @brief The implementation file for the Time Partitioned Parallel Comb Generator
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "ParallelCombGenerator.h"
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+class ParallelCombGenerator::Imple
+{
+// Deleted Operations Should be `public`
+public:
+    Imple() = delete;
+
+// Everything else is private but accessible by our nested class.
+private:
+    friend class ParallelCombGenerator;
+
+    Imple( const CombGenerator & prototype, size_t numWorkers, size_t theMinSamplesPerWorker )
+      : workerPool{ resolveNumWorkers( numWorkers ) }
+      , minSamplesPerWorker{ std::max( theMinSamplesPerWorker, size_t( 1 ) ) }
+      , sampleCount{ prototype.getSampleCount() }
+    {
+        workers.reserve( workerPool.getNumWorkers() );
+        for ( size_t i = 0; workerPool.getNumWorkers() != i; ++i )
+            workers.emplace_back( prototype.clone() );
+    }
+
+    ~Imple() = default;
+
+    static size_t resolveNumWorkers( size_t numWorkers )
+    {
+        if ( numWorkers ) return numWorkers;
+        const auto hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads ? hardwareThreads : 1;
+    }
+
+    template < typename ElementType >
+    void produce( ElementType * pElementBuffer, size_t numSamples, bool accumulate )
+    {
+        // Split into as many segments as we have workers, each at least our minimum, and at least one segment.
+        const auto numSegments = std::max( std::min( workers.size(), numSamples / minSamplesPerWorker ), size_t( 1 ) );
+        const auto segmentSize = ( numSamples + numSegments - 1 ) / numSegments;
+        const auto startSample = sampleCount;
+
+        auto produceSegment = [ this, pElementBuffer, numSamples, accumulate, segmentSize, startSample ]( size_t k )
+        {
+            const auto begin = k * segmentSize;
+            if ( numSamples <= begin ) return;
+            const auto length = std::min( segmentSize, numSamples - begin );
+
+            // Position the worker's clone at the start of its segment, unless it is already there.
+            auto & worker = workers[ k ];
+            if ( startSample + begin != worker.getSampleCount() )
+                worker.seekTo( startSample + begin );
+
+            if ( accumulate )
+                worker.accumSamples( pElementBuffer + begin, length );
+            else
+                worker.getSamples( pElementBuffer + begin, length );
+        };
+
+        // A single segment requires no other threads. Otherwise, the job is handed to the pool by
+        // reference, so that wrapping it does not allocate.
+        if ( 1 == numSegments )
+            produceSegment( 0 );
+        else
+            workerPool.run( std::ref( produceSegment ) );
+
+        sampleCount += numSamples;
+    }
+
+    WorkerPool workerPool;
+    std::vector< CombGenerator > workers{};
+    const size_t minSamplesPerWorker;
+    size_t sampleCount;
+};
+
+ParallelCombGenerator::ParallelCombGenerator( const CombGenerator & prototype, size_t numWorkers,
+                                              size_t minSamplesPerWorker )
+  : pImple{ new Imple{ prototype, numWorkers, minSamplesPerWorker } }
+{
+}
+
+ParallelCombGenerator::~ParallelCombGenerator()
+{
+    delete pImple;
+}
+
+void ParallelCombGenerator::getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->produce( pElementBuffer, numSamples, false );
+}
+
+void ParallelCombGenerator::accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->produce( pElementBuffer, numSamples, true );
+}
+
+void ParallelCombGenerator::getSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->produce( pElementBuffer, numSamples, false );
+}
+
+void ParallelCombGenerator::accumSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples )
+{
+    pImple->produce( pElementBuffer, numSamples, true );
+}
+
+void ParallelCombGenerator::seekTo( size_t sampleIndex )
+{
+    // Workers are positioned lazily, at the start of their next segment.
+    pImple->sampleCount = sampleIndex;
+}
+
+size_t ParallelCombGenerator::getSampleCount() const
+{
+    return pImple->sampleCount;
+}
+
+size_t ParallelCombGenerator::getNumWorkers() const
+{
+    return pImple->workerPool.getNumWorkers();
+}
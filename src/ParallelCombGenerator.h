@@ -0,0 +1,153 @@
+/**
+ * @file ParallelCombGenerator.h
+ * @brief The specification file for the Time Partitioned Parallel Comb Generator
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_PARALLELCOMBGENERATOR_H
+#define REISER_RT_PARALLELCOMBGENERATOR_H
+
+// Include Export Specification File
+#include "ReiserRT_CombGeneratorExport.h"
+
+#include "CombGenerator.h"
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Time Partitioned Parallel Comb Generator
+         *
+         * The ParallelCombGenerator produces one long comb sample series on several cores. At construction,
+         * a configured CombGenerator is cloned once per worker. Each `getSamples` invocation splits the user buffer
+         * into contiguous time segments, one per worker. Each worker seeks its clone to the start of its segment
+         * and fills that segment, in parallel with the others. As seeking computes phases directly, the result
+         * is within the accuracy documented for the engine in effect of what the single threaded CombGenerator
+         * would produce. It is not bit identical.
+         *
+         * The invoking thread serves as one of the workers. Worker threads are created at construction.
+         *
+         * @warning An envelope functor registered with the prototype is copied into each clone and is invoked
+         * concurrently by the worker threads, each with the `currentSample` of its own segment. It must be
+         * safe to invoke concurrently and must not depend on being invoked in sample order.
+         */
+        class ReiserRT_CombGenerator_EXPORT ParallelCombGenerator
+        {
+        private:
+            /**
+             * @brief Forward Reference to Hidden Implementation
+             */
+            class Imple;
+
+        public:
+            /**
+             * @brief The Default Minimum Number of Samples Produced by a Worker
+             *
+             * Smaller requests are split across fewer workers, so that each one amortizes its seek and
+             * the thread wake up over enough samples.
+             */
+            static constexpr size_t defaultMinSamplesPerWorker = 16384;
+
+            /**
+             * @brief Qualified Constructor
+             *
+             * This constructor clones the prototype once per worker and creates the worker threads.
+             * The prototype is not modified and may continue to be used independently.
+             *
+             * @param prototype A CombGenerator configured by `reset` for the comb to be produced.
+             * @param numWorkers The number of workers, inclusive of the invoking thread. If zero,
+             * the number of hardware threads is used.
+             * @param minSamplesPerWorker The minimum number of samples a worker produces per invocation.
+             */
+            ParallelCombGenerator( const CombGenerator & prototype, size_t numWorkers,
+                                   size_t minSamplesPerWorker = defaultMinSamplesPerWorker );
+
+            /**
+             * @brief Destructor
+             *
+             * Joins the worker threads and deletes the Implementation.
+             */
+            ~ParallelCombGenerator();
+
+            /**
+             * @brief Copy Construction is Disallowed
+             */
+            ParallelCombGenerator( const ParallelCombGenerator & another ) = delete;
+
+            /**
+             * @brief Copy Assignment is Disallowed
+             */
+            ParallelCombGenerator & operator =( const ParallelCombGenerator & another ) = delete;
+
+            /**
+             * @brief Get Samples Operation
+             *
+             * This operation delivers 'N' number of samples into the user provided buffer, overwriting the buffers
+             * content, with each worker filling a disjoint time segment. It returns once all segments are filled.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation
+             *
+             * This operation accumulates 'N' number of samples onto the user provided buffer.
+             * Otherwise, it behaves as `getSamples` does.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void accumSamples( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Get Samples Operation, Single Precision
+             *
+             * @see CombGenerator::getSamples for single precision specifics.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void getSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Accumulate Samples Operation, Single Precision
+             *
+             * @see CombGenerator::accumSamples for single precision specifics.
+             *
+             * @param pElementBuffer User provided buffer large enough to hold the requested number of samples.
+             * @param numSamples The number of samples to be delivered.
+             */
+            void accumSamples( CombGeneratorSingleElementBufferTypePtr pElementBuffer, size_t numSamples );
+
+            /**
+             * @brief Seek To Operation
+             *
+             * @param sampleIndex The sample index of the next sample to be produced.
+             */
+            void seekTo( size_t sampleIndex );
+
+            /**
+             * @brief Query the Current Sample Count
+             *
+             * @return The sample index of the next sample to be produced.
+             */
+            [[nodiscard]] size_t getSampleCount() const;
+
+            /**
+             * @brief Query the Number of Workers
+             *
+             * @return The number of workers, inclusive of the invoking thread.
+             */
+            [[nodiscard]] size_t getNumWorkers() const;
+
+        private:
+            Imple * pImple{};    //!< Pointer to hidden implementation.
+        };
+    }
+}
+
+#endif //REISER_RT_PARALLELCOMBGENERATOR_H
@@ -0,0 +1,148 @@
+/**
+ * @file PhaseArithmetic.h
+ * @brief The specification file for Accurate Phase Arithmetic (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_PHASEARITHMETIC_H
+#define REISER_RT_PHASEARITHMETIC_H
+
+#include <cmath>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        namespace PhaseArithmetic
+        {
+            /**
+             * @brief Two Pi Split into a High Part and a Low Order Correction
+             *
+             * The high part is the double nearest two pi and the low part is the remainder. Reductions multiply
+             * through `std::fma` so that the high part product is not rounded before subtraction.
+             */
+            constexpr double twoPiHigh = 6.28318530717958623200e+00;
+            constexpr double twoPiLow = 2.44929359829470635445e-16;
+
+            /**
+             * @brief Wrap a Phase into the Interval [-pi, pi]
+             *
+             * @param phase The phase in radians.
+             * @return The equivalent phase within [-pi, pi].
+             */
+            inline double wrap( double phase )
+            {
+                const auto k = std::nearbyint( phase / twoPiHigh );
+                return std::fma( -k, twoPiLow, std::fma( -k, twoPiHigh, phase ) );
+            }
+
+            /**
+             * @brief Compute the Phase of a Tone at an Arbitrary Sample Index
+             *
+             * This evaluates `phase0 + radiansPerSample * sampleIndex`, wrapped into [-pi, pi], while retaining
+             * the rounding error of the product. Unlike a recurrence, the error does not grow with the sample index
+             * beyond the representation of the wrapped product itself.
+             *
+             * @param phase0 The phase at sample index zero.
+             * @param radiansPerSample The tone rate.
+             * @param sampleIndex The sample index of interest.
+             * @return The wrapped phase at the sample index.
+             */
+            inline double phaseAt( double phase0, double radiansPerSample, size_t sampleIndex )
+            {
+                const auto n = double( sampleIndex );
+                const auto product = radiansPerSample * n;
+                const auto productError = std::fma( radiansPerSample, n, -product );
+                const auto k = std::nearbyint( product / twoPiHigh );
+                const auto reduced = std::fma( -k, twoPiLow, std::fma( -k, twoPiHigh, product ) );
+                return wrap( reduced + productError + phase0 );
+            }
+
+            /**
+             * @brief Compute the Phase of a Scaled Double-Double Value
+             *
+             * This evaluates `scale * ( valueHigh + valueLow )`, wrapped into [-pi, pi], where `valueLow` is the
+             * low order correction of `valueHigh`. The high part product is reduced as `phaseAt` reduces its
+             * product, retaining its rounding error.
+             *
+             * @param scale The rate scaling the value.
+             * @param valueHigh The high part of the value.
+             * @param valueLow The low order correction of the value.
+             * @return The wrapped phase.
+             */
+            inline double scaledPhase( double scale, double valueHigh, double valueLow )
+            {
+                const auto product = scale * valueHigh;
+                const auto productError = std::fma( scale, valueHigh, -product );
+                const auto k = std::nearbyint( product / twoPiHigh );
+                const auto reduced = std::fma( -k, twoPiLow, std::fma( -k, twoPiHigh, product ) );
+                return wrap( reduced + productError + scale * valueLow );
+            }
+
+            /**
+             * @brief Compute the Phase of a Chirp at an Arbitrary Sample Index
+             *
+             * The rate in effect from sample index `m` to `m + 1` is `startRadiansPerSample + linearSweep * m +
+             * quadraticSweep * m * m`. This evaluates `phase0` plus the sum of those rates over the samples before
+             * `sampleIndex`, wrapped into [-pi, pi]. Each term is reduced separately, as `phaseAt` reduces its product.
+             * The sums of the sample indices and of their squares are carried exactly, as double-double values,
+             * for sample indices below 2^52.
+             *
+             * @param phase0 The phase at sample index zero.
+             * @param startRadiansPerSample The rate at sample index zero.
+             * @param linearSweep The rate change per sample.
+             * @param quadraticSweep The rate change per sample squared.
+             * @param sampleIndex The sample index of interest.
+             * @return The wrapped phase at the sample index.
+             */
+            inline double chirpPhaseAt( double phase0, double startRadiansPerSample, double linearSweep,
+                                        double quadraticSweep, size_t sampleIndex )
+            {
+                // The sum of the sample indices before the sample index is n(n-1)/2 and the sum of their squares
+                // n(n-1)(2n-1)/6. Each is formed from integer factors, divided down exactly beforehand, so neither
+                // overflows. Every factor is exact as a double and each product is split into high and low parts.
+                auto f1 = sampleIndex;
+                auto f2 = sampleIndex ? sampleIndex - 1 : 0;
+                auto f3 = f1 + f2;
+                if ( 0 == f1 % 2 ) f1 /= 2;
+                else f2 /= 2;
+                const auto sumOfIndicesHigh = double( f1 ) * double( f2 );
+                const auto sumOfIndicesLow = std::fma( double( f1 ), double( f2 ), -sumOfIndicesHigh );
+                if ( 0 == f1 % 3 ) f1 /= 3;
+                else if ( 0 == f2 % 3 ) f2 /= 3;
+                else f3 /= 3;
+                const auto partialHigh = double( f1 ) * double( f2 );
+                const auto partialLow = std::fma( double( f1 ), double( f2 ), -partialHigh );
+                const auto sumOfSquaresHigh = partialHigh * double( f3 );
+                const auto sumOfSquaresLow = std::fma( partialHigh, double( f3 ), -sumOfSquaresHigh ) +
+                                             partialLow * double( f3 );
+                return wrap( phaseAt( phase0, startRadiansPerSample, sampleIndex ) +
+                             scaledPhase( linearSweep, sumOfIndicesHigh, sumOfIndicesLow ) +
+                             scaledPhase( quadraticSweep, sumOfSquaresHigh, sumOfSquaresLow ) );
+            }
+
+            /**
+             * @brief Compute the Starting Phase that Continues a Tone at a New Rate
+             *
+             * A tone started at `phase0` with `radiansPerSample` has some phase at `sampleIndex`. This computes the
+             * phase at sample index zero of a tone at `newRadiansPerSample` having that same phase at `sampleIndex`.
+             *
+             * @param phase0 The phase at sample index zero.
+             * @param radiansPerSample The tone rate.
+             * @param newRadiansPerSample The new tone rate.
+             * @param sampleIndex The sample index at which the rate changes.
+             * @return The wrapped phase at sample index zero for the new rate.
+             */
+            inline double retunedPhase( double phase0, double radiansPerSample, double newRadiansPerSample,
+                                        size_t sampleIndex )
+            {
+                return wrap( phaseAt( phase0, radiansPerSample, sampleIndex ) -
+                             phaseAt( 0.0, newRadiansPerSample, sampleIndex ) );
+            }
+        }
+    }
+}
+
+#endif //REISER_RT_PHASEARITHMETIC_H
@@ -0,0 +1,322 @@
+/**
+ * @file PhasorBankEngine.cpp
+ * @brief The implementation file for the ReiserRT_FlyingPhasor Bank Engine
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "PhasorBankEngine.h"
+#include "PhaseArithmetic.h"
+
+#include <algorithm>
+
+using namespace ReiserRT::Signal;
+
+PhasorBankEngine::PhasorBankEngine( size_t maxHarmonics )
+  : harmonicGenerators{ maxHarmonics }
+  , startPhases( maxHarmonics, 0.0 )
+  , toneRates( maxHarmonics, 0.0 )
+{
+}
+
+void PhasorBankEngine::reset( size_t theNumHarmonics, double fundamentalRadiansPerSample,
+                              const double * pMag, const double * pPhase )
+{
+    // A harmonic series is a tone bank at multiples of the fundamental.
+    for ( size_t i = 0; theNumHarmonics != i; ++i )
+        toneRates[i] = double(i+1) * fundamentalRadiansPerSample;
+    resetToneBank( theNumHarmonics, toneRates.data(), pMag, pPhase );
+}
+
+void PhasorBankEngine::resetToneBank( size_t numTones, const double * pRate,
+                                      const double * pMag, const double * pPhase )
+{
+    numHarmonics = numTones;
+    pMagnitudes = pMag;
+    sampleCount = 0;
+
+    // Reset each Harmonic Tone Generator specified. Rates and starting phases are retained for seeking.
+    for ( size_t i = 0; numHarmonics != i; ++i )
+    {
+        toneRates[i] = pRate[i];
+        startPhases[i] = pPhase ? *pPhase++ : 0.0;
+        harmonicGenerators[i].reset( toneRates[i], startPhases[i] );
+    }
+
+    // Reset the excess harmonic generators. We do not want them to contain garbage.
+    for ( size_t i = numHarmonics; harmonicGenerators.size() != i; ++i )
+        harmonicGenerators[i].reset();
+}
+
+void PhasorBankEngine::reset()
+{
+    // Reset all harmonic generators. We do not want them to contain garbage.
+    for ( auto & harmonicGenerator : harmonicGenerators )
+        harmonicGenerator.reset();
+
+    numHarmonics = 0;
+    pMagnitudes = nullptr;
+    sampleCount = 0;
+}
+
+void PhasorBankEngine::synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                   const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // Get pointer to harmonic magnitudes. This is allowed to be nullptr.
+    auto pMag = pMagnitudes;
+
+    // If no envelope functor, we use a constant magnitude.
+    if ( !envelope )
+    {
+        // For each harmonic tone specified last reset, accumulate its samples.
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            // Get the nth harmonic magnitude or default to unity gain.
+            auto mag = pMag ? *pMag++ : 1.0;
+
+            // Fundamental tone optimization: If NOT fundamental tone or accumulating, accumulate.
+            // Otherwise, we just get and store.
+            if ( i || accumulate )
+                harmonicGenerators[i].accumSamplesScaled( pElementBuffer, numSamples, mag );
+            else
+                harmonicGenerators[i].getSamplesScaled( pElementBuffer, numSamples, mag );
+        }
+    }
+    // Else if we have a batch envelope functor, its envelope matrix is gathered a harmonic at a time.
+    else if ( envelope.batchEnvelopeFunk )
+    {
+        synthesizeBatchEnveloped( 0, numHarmonics, getSampleCount(), pElementBuffer, numSamples, envelope, accumulate );
+    }
+    // Else if we have a segment envelope functor, its segments are expanded a harmonic at a time.
+    else if ( envelope.segmentEnvelopeFunk )
+    {
+        synthesizeSegmented( 0, numHarmonics, getSampleCount(), pElementBuffer, numSamples, envelope, accumulate );
+    }
+    // Else, we have an envelope functor, we will utilize it
+    else
+    {
+        synthesizeEnveloped( 0, numHarmonics, getSampleCount(), pElementBuffer, numSamples, envelope, accumulate );
+    }
+
+    sampleCount += numSamples;
+}
+
+void PhasorBankEngine::synthesizeEnveloped( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                            FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                            const HarmonicEnvelope & envelope, bool accumulate )
+{
+    auto & envelopeFunk = envelope.envelopeFunk;
+
+    // For each harmonic tone of the range, accumulate its envelope modulated samples.
+    // The first harmonic not muted overwrites the buffer, unless accumulating.
+    auto written = accumulate;
+    for ( size_t i = firstHarmonic; firstHarmonic + numRangeHarmonics != i; ++i )
+    {
+        // Get the nth harmonic magnitude or default to unity gain.
+        const auto mag = pMagnitudes ? pMagnitudes[i] : 1.0;
+
+        // Invoke the envelope functor for this harmonic to obtain its modulation envelope.
+        auto pEnvelope = envelopeFunk( currentSample, numSamples, i, mag );
+
+        // A muted harmonic is not accumulated. Its generator is restarted where it would be after the block.
+        if ( !pEnvelope )
+        {
+            harmonicGenerators[i].reset( toneRates[i], PhaseArithmetic::phaseAt( startPhases[i], toneRates[i],
+                                                                                 currentSample + numSamples ) );
+            continue;
+        }
+
+        if ( written )
+            harmonicGenerators[i].accumSamplesScaled( pElementBuffer, numSamples, pEnvelope );
+        else
+            harmonicGenerators[i].getSamplesScaled( pElementBuffer, numSamples, pEnvelope );
+        written = true;
+    }
+
+    // Every harmonic muted. Getting samples, we must still write zeros.
+    if ( !written )
+        std::fill( pElementBuffer, pElementBuffer + numSamples, FlyingPhasorElementType{} );
+}
+
+void PhasorBankEngine::synthesizeSegmented( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                            FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                            const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // A ReiserRT_FlyingPhasor takes its envelope from a buffer. Segments are expanded into a small one on the stack,
+    // a chunk at a time, rather than into one of the whole block.
+    double chunkEnvelope[ conversionChunkSamples ];
+    auto & segmentEnvelopeFunk = envelope.segmentEnvelopeFunk;
+    auto written = accumulate;
+    for ( size_t i = firstHarmonic; firstHarmonic + numRangeHarmonics != i; ++i )
+    {
+        const auto mag = pMagnitudes ? pMagnitudes[i] : 1.0;
+        const auto segments = segmentEnvelopeFunk( currentSample, numSamples, i, mag );
+
+        // A muted harmonic is not accumulated. Its generator is restarted where it would be after the block.
+        if ( !segments.numSegments )
+        {
+            harmonicGenerators[i].reset( toneRates[i], PhaseArithmetic::phaseAt( startPhases[i], toneRates[i],
+                                                                                 currentSample + numSamples ) );
+            continue;
+        }
+
+        size_t k = 0;
+        for ( size_t offset = 0; numSamples != offset; )
+        {
+            const auto chunkLen = std::min( numSamples - offset, conversionChunkSamples );
+            for ( size_t n = 0; chunkLen != n; ++n )
+            {
+                const auto sampleOffset = offset + n;
+                while ( k + 1 != segments.numSegments && segments.pSegments[ k + 1 ].sampleOffset <= sampleOffset )
+                    ++k;
+                const auto & segment = segments.pSegments[k];
+                chunkEnvelope[n] = segment.value + segment.slope * double( sampleOffset - segment.sampleOffset );
+            }
+
+            if ( written )
+                harmonicGenerators[i].accumSamplesScaled( pElementBuffer + offset, chunkLen, chunkEnvelope );
+            else
+                harmonicGenerators[i].getSamplesScaled( pElementBuffer + offset, chunkLen, chunkEnvelope );
+            offset += chunkLen;
+        }
+        written = true;
+    }
+
+    // Every harmonic muted. Getting samples, we must still write zeros.
+    if ( !written )
+        std::fill( pElementBuffer, pElementBuffer + numSamples, FlyingPhasorElementType{} );
+}
+
+size_t PhasorBankEngine::getPartitionGranularity() const
+{
+    return 1;
+}
+
+void PhasorBankEngine::synthesizePartition( size_t firstHarmonic, size_t numPartitionHarmonics, size_t currentSample,
+                                            FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                            const HarmonicEnvelope & envelope )
+{
+    if ( envelope.batchEnvelopeFunk )
+    {
+        synthesizeBatchEnveloped( firstHarmonic, numPartitionHarmonics, currentSample,
+                                  pElementBuffer, numSamples, envelope, false );
+        return;
+    }
+
+    if ( envelope.envelopeFunk )
+    {
+        synthesizeEnveloped( firstHarmonic, numPartitionHarmonics, currentSample,
+                             pElementBuffer, numSamples, envelope, false );
+        return;
+    }
+
+    if ( envelope.segmentEnvelopeFunk )
+    {
+        synthesizeSegmented( firstHarmonic, numPartitionHarmonics, currentSample,
+                             pElementBuffer, numSamples, envelope, false );
+        return;
+    }
+
+    // As `synthesize` does, over the range. The first harmonic of the range overwrites the buffer.
+    for ( size_t i = firstHarmonic; firstHarmonic + numPartitionHarmonics != i; ++i )
+    {
+        const auto mag = pMagnitudes ? pMagnitudes[i] : 1.0;
+        if ( i != firstHarmonic )
+            harmonicGenerators[i].accumSamplesScaled( pElementBuffer, numSamples, mag );
+        else
+            harmonicGenerators[i].getSamplesScaled( pElementBuffer, numSamples, mag );
+    }
+}
+
+void PhasorBankEngine::synthesizeBatchEnveloped( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                                 FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                                 const HarmonicEnvelope & envelope, bool accumulate )
+{
+    // The envelope matrix is sample major. Each harmonic's column is gathered into a contiguous envelope.
+    double columnEnvelope[ combGeneratorBatchEnvelopeBlockSamples ];
+    const auto stride = envelope.envelopeMatrixStride;
+    const auto pMatrix = envelope.pEnvelopeMatrix + firstHarmonic;
+    for ( size_t offset = 0; numSamples != offset; )
+    {
+        const auto blockLen = std::min( numSamples - offset, combGeneratorBatchEnvelopeBlockSamples );
+        envelope.batchEnvelopeFunk( currentSample + offset, blockLen, firstHarmonic, numRangeHarmonics,
+                                    pMatrix, stride );
+
+        for ( size_t h = 0; numRangeHarmonics != h; ++h )
+        {
+            for ( size_t n = 0; blockLen != n; ++n )
+                columnEnvelope[n] = pMatrix[ n * stride + h ];
+
+            auto & harmonicGenerator = harmonicGenerators[ firstHarmonic + h ];
+            if ( h || accumulate )
+                harmonicGenerator.accumSamplesScaled( pElementBuffer + offset, blockLen, columnEnvelope );
+            else
+                harmonicGenerator.getSamplesScaled( pElementBuffer + offset, blockLen, columnEnvelope );
+        }
+
+        offset += blockLen;
+    }
+}
+
+void PhasorBankEngine::completePartitions( size_t numSamples )
+{
+    sampleCount += numSamples;
+}
+
+void PhasorBankEngine::retune( double fundamentalRadiansPerSample, const double * pPhase )
+{
+    // A ReiserRT_FlyingPhasor rate is fixed at reset. Each is restarted at the new rate from its current phase.
+    for ( size_t i = 0; numHarmonics != i; ++i )
+        toneRates[i] = double(i+1) * fundamentalRadiansPerSample;
+    std::copy( pPhase, pPhase + numHarmonics, startPhases.begin() );
+    seek( getSampleCount() );
+}
+
+bool PhasorBankEngine::acceptsParameterUpdates() const
+{
+    return true;
+}
+
+void PhasorBankEngine::updateParameters( const double * pMag, const double * pPhase )
+{
+    // Magnitudes are applied as the tones are accumulated. The generators are left as they are.
+    pMagnitudes = pMag;
+
+    // New starting phases restart each generator where it would be had it been reset with them.
+    if ( pPhase )
+    {
+        std::copy( pPhase, pPhase + numHarmonics, startPhases.begin() );
+        seek( getSampleCount() );
+    }
+}
+
+void PhasorBankEngine::updateMagnitude( size_t /*nHarmonic*/, const double * pMag )
+{
+    // Magnitudes are read as the tones are accumulated. Only the storage may have changed.
+    pMagnitudes = pMag;
+}
+
+void PhasorBankEngine::restartHarmonic( size_t nHarmonic, double radiansPerSample, double startPhase,
+                                        const double * pMag )
+{
+    toneRates[ nHarmonic ] = radiansPerSample;
+    startPhases[ nHarmonic ] = startPhase;
+    harmonicGenerators[ nHarmonic ].reset( radiansPerSample,
+                                           PhaseArithmetic::phaseAt( startPhase, radiansPerSample, sampleCount ) );
+    pMagnitudes = pMag;
+    numHarmonics = std::max( numHarmonics, nHarmonic + 1 );
+}
+
+void PhasorBankEngine::seek( size_t sampleIndex )
+{
+    // Restart each Harmonic Tone Generator at the phase it would have at the sample index.
+    for ( size_t i = 0; numHarmonics != i; ++i )
+        harmonicGenerators[i].reset( toneRates[i], PhaseArithmetic::phaseAt( startPhases[i], toneRates[i], sampleIndex ) );
+
+    sampleCount = sampleIndex;
+}
+
+size_t PhasorBankEngine::getSampleCount() const
+{
+    return sampleCount;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file PhasorBankEngine.h
+ * @brief The specification file for the ReiserRT_FlyingPhasor Bank Engine (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_PHASORBANKENGINE_H
+#define REISER_RT_PHASORBANKENGINE_H
+
+#include "HarmonicEngine.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief ReiserRT_FlyingPhasor Bank Engine
+         *
+         * The original CombGenerator engine. It utilizes one ReiserRT_FlyingPhasor instance per harmonic
+         * and accumulates each one over the entire user buffer in harmonic order.
+         *
+         * A batch envelope functor fills its envelope matrix a block at a time. Each harmonic's envelope is then
+         * gathered from its column and applied over the block.
+         *
+         * A seek resets each ReiserRT_FlyingPhasor to the phase computed for the sample index, as does an envelope
+         * functor muting a harmonic for a block. The engine therefore keeps its own sample count.
+         */
+        class PhasorBankEngine : public HarmonicEngine
+        {
+        public:
+            explicit PhasorBankEngine( size_t maxHarmonics );
+            ~PhasorBankEngine() override = default;
+
+            void reset( size_t numHarmonics, double fundamentalRadiansPerSample,
+                        const double * pMag, const double * pPhase ) override;
+
+            void resetToneBank( size_t numTones, const double * pRate,
+                                const double * pMag, const double * pPhase ) override;
+
+            void reset() override;
+
+            void synthesize( FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                             const HarmonicEnvelope & envelope, bool accumulate ) override;
+
+            size_t getPartitionGranularity() const override;
+
+            void synthesizePartition( size_t firstHarmonic, size_t numPartitionHarmonics, size_t currentSample,
+                                      FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                      const HarmonicEnvelope & envelope ) override;
+
+            void completePartitions( size_t numSamples ) override;
+
+            bool acceptsParameterUpdates() const override;
+
+            void updateParameters( const double * pMag, const double * pPhase ) override;
+
+            void updateMagnitude( size_t nHarmonic, const double * pMag ) override;
+
+            void restartHarmonic( size_t nHarmonic, double radiansPerSample, double startPhase,
+                                  const double * pMag ) override;
+
+            void retune( double fundamentalRadiansPerSample, const double * pPhase ) override;
+
+            void seek( size_t sampleIndex ) override;
+
+            size_t getSampleCount() const override;
+
+        private:
+            void synthesizeEnveloped( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                      FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                      const HarmonicEnvelope & envelope, bool accumulate );
+
+            void synthesizeSegmented( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                      FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                      const HarmonicEnvelope & envelope, bool accumulate );
+
+            void synthesizeBatchEnveloped( size_t firstHarmonic, size_t numRangeHarmonics, size_t currentSample,
+                                           FlyingPhasorElementBufferTypePtr pElementBuffer, size_t numSamples,
+                                           const HarmonicEnvelope & envelope, bool accumulate );
+
+            std::vector< FlyingPhasorToneGenerator > harmonicGenerators;
+            std::vector< double > startPhases;
+            std::vector< double > toneRates;
+            const double * pMagnitudes{};
+            size_t numHarmonics{};
+            size_t sampleCount{};
+        };
+    }
+}
+
+#endif //REISER_RT_PHASORBANKENGINE_H
@@ -0,0 +1,136 @@
+/**
+ * @file RadixTwoInverseFft.cpp
+ * @brief The implementation file for a Radix-2 Inverse FFT
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "RadixTwoInverseFft.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    /**
+     * @brief The Butterflies of One Group
+     *
+     * The upper and lower halves of a group never overlap one another or the twiddles. Saying so
+     * allows the compiler to vectorize the loop without runtime alias checks.
+     */
+    inline void butterflyGroup( double * __restrict pUpperReal, double * __restrict pUpperImag,
+                                double * __restrict pLowerReal, double * __restrict pLowerImag,
+                                const double * __restrict pTwiddleReal, const double * __restrict pTwiddleImag,
+                                size_t half )
+    {
+        for ( size_t k = 0; half != k; ++k )
+        {
+            const auto tr = pLowerReal[k] * pTwiddleReal[k] - pLowerImag[k] * pTwiddleImag[k];
+            const auto ti = pLowerReal[k] * pTwiddleImag[k] + pLowerImag[k] * pTwiddleReal[k];
+            pLowerReal[k] = pUpperReal[k] - tr;
+            pLowerImag[k] = pUpperImag[k] - ti;
+            pUpperReal[k] += tr;
+            pUpperImag[k] += ti;
+        }
+    }
+
+    /**
+     * @brief One Butterfly Stage Over Groups of `2 * half` Elements
+     *
+     * The twiddles for the stage, e^(j pi k / half) for k less than `half`, are contiguous.
+     */
+    void butterflyStage( double * pReal, double * pImag, size_t size, size_t half,
+                         const double * pTwiddleReal, const double * pTwiddleImag )
+    {
+        for ( size_t group = 0; size != group; group += 2 * half )
+            butterflyGroup( pReal + group, pImag + group, pReal + group + half, pImag + group + half,
+                            pTwiddleReal, pTwiddleImag, half );
+    }
+}
+
+RadixTwoInverseFft::RadixTwoInverseFft( size_t theSize )
+  : size{ theSize }
+  , twiddleReal( theSize )
+  , twiddleImag( theSize )
+  , bitReversed( theSize )
+{
+    if ( size < 2 || 0 != ( size & ( size - 1 ) ) )
+        throw std::invalid_argument{ "The transform size must be a power of two of at least two!" };
+
+    // The twiddles for the stage of half width `half` start at index `half`.
+    for ( size_t half = 1; size != half; half *= 2 )
+    {
+        for ( size_t k = 0; half != k; ++k )
+        {
+            const auto angle = M_PI * double( k ) / double( half );
+            twiddleReal[ half + k ] = std::cos( angle );
+            twiddleImag[ half + k ] = std::sin( angle );
+        }
+    }
+
+    size_t numBits = 0;
+    while ( ( size_t( 1 ) << numBits ) != size ) ++numBits;
+    for ( size_t i = 0; size != i; ++i )
+    {
+        size_t reversed = 0;
+        for ( size_t bit = 0; numBits != bit; ++bit )
+            reversed |= ( ( i >> bit ) & 1 ) << ( numBits - 1 - bit );
+        bitReversed[i] = reversed;
+    }
+}
+
+void RadixTwoInverseFft::transformAllButLast( double * pReal, double * pImag ) const
+{
+    for ( size_t i = 0; size != i; ++i )
+    {
+        const auto j = bitReversed[i];
+        if ( i < j )
+        {
+            std::swap( pReal[i], pReal[j] );
+            std::swap( pImag[i], pImag[j] );
+        }
+    }
+
+    // The first stage has only unit twiddles.
+    for ( size_t i = 0; size != i; i += 2 )
+    {
+        const auto tr = pReal[ i + 1 ];
+        const auto ti = pImag[ i + 1 ];
+        pReal[ i + 1 ] = pReal[i] - tr;
+        pImag[ i + 1 ] = pImag[i] - ti;
+        pReal[i] += tr;
+        pImag[i] += ti;
+    }
+
+    for ( size_t half = 2; size / 2 > half; half *= 2 )
+        butterflyStage( pReal, pImag, size, half, twiddleReal.data() + half, twiddleImag.data() + half );
+}
+
+void RadixTwoInverseFft::transform( double * pReal, double * pImag ) const
+{
+    transformAllButLast( pReal, pImag );
+
+    const auto half = size / 2;
+    if ( 1 < half )
+        butterflyStage( pReal, pImag, size, half, twiddleReal.data() + half, twiddleImag.data() + half );
+}
+
+void RadixTwoInverseFft::transformFirstHalf( double * pReal, double * pImag ) const
+{
+    transformAllButLast( pReal, pImag );
+
+    const auto half = size / 2;
+    if ( 1 == half )
+        return;
+
+    const auto pTwiddleReal = twiddleReal.data() + half;
+    const auto pTwiddleImag = twiddleImag.data() + half;
+    for ( size_t k = 0; half != k; ++k )
+    {
+        pReal[k] += pReal[ half + k ] * pTwiddleReal[k] - pImag[ half + k ] * pTwiddleImag[k];
+        pImag[k] += pReal[ half + k ] * pTwiddleImag[k] + pImag[ half + k ] * pTwiddleReal[k];
+    }
+}
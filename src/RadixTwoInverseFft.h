@@ -0,0 +1,80 @@
+/**
+ * @file RadixTwoInverseFft.h
+ * @brief The specification file for a Radix-2 Inverse FFT (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_RADIXTWOINVERSEFFT_H
+#define REISER_RT_RADIXTWOINVERSEFFT_H
+
+#include "AlignedAllocator.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Radix-2 Inverse FFT
+         *
+         * An in place, decimation in time, inverse FFT over split real and imaginary arrays.
+         * It computes y[t] = sum over b of Y[b] e^(j 2 pi b t / M) without any 1/M normalization.
+         * Twiddle factors and the bit reversal permutation are computed once at construction, each twiddle
+         * directly from `std::cos` and `std::sin`, so that no rounding accumulates across them. Twiddles
+         * are stored contiguously per stage so that butterfly loops run at unit stride.
+         */
+        class RadixTwoInverseFft
+        {
+        public:
+            /**
+             * @brief Qualified Constructor
+             *
+             * @param size The transform size. Must be a power of two and at least two.
+             * @throw std::invalid_argument If the size is not a power of two of at least two.
+             */
+            explicit RadixTwoInverseFft( size_t size );
+
+            /**
+             * @brief Transform in Place
+             *
+             * @param pReal The real parts, `getSize` in length.
+             * @param pImag The imaginary parts, `getSize` in length.
+             */
+            void transform( double * pReal, double * pImag ) const;
+
+            /**
+             * @brief Transform in Place, Producing Only the First Half of the Outputs
+             *
+             * The last butterfly stage only computes outputs zero through `getSize() / 2 - 1`.
+             * The remaining outputs are left holding intermediate values.
+             *
+             * @param pReal The real parts, `getSize` in length.
+             * @param pImag The imaginary parts, `getSize` in length.
+             */
+            void transformFirstHalf( double * pReal, double * pImag ) const;
+
+            /**
+             * @brief Query the Transform Size
+             *
+             * @return The transform size.
+             */
+            [[nodiscard]] size_t getSize() const { return size; }
+
+        private:
+            /**
+             * @brief Bit Reversal Permutation and All But the Last Butterfly Stage
+             */
+            void transformAllButLast( double * pReal, double * pImag ) const;
+
+            const size_t size;
+            AlignedScalarVector twiddleReal;
+            AlignedScalarVector twiddleImag;
+            std::vector< size_t > bitReversed;
+        };
+    }
+}
+
+#endif //REISER_RT_RADIXTWOINVERSEFFT_H
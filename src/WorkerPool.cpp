@@ -0,0 +1,152 @@
+/**
+ * @file WorkerPool.cpp
+ * @brief The implementation file for the Worker Pool
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "WorkerPool.h"
+
+#if defined( __linux__ )
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    void pinThread( std::thread & thread, size_t workerIndex )
+    {
+#if defined( __linux__ )
+        // Choose the worker index'th core among those we are allowed to run on.
+        cpu_set_t allowed;
+        CPU_ZERO( &allowed );
+        if ( 0 != sched_getaffinity( 0, sizeof( allowed ), &allowed ) )
+            return;
+        const auto numAllowed = size_t( CPU_COUNT( &allowed ) );
+        if ( !numAllowed )
+            return;
+
+        auto remaining = workerIndex % numAllowed;
+        for ( int cpu = 0; CPU_SETSIZE != cpu; ++cpu )
+        {
+            if ( !CPU_ISSET( cpu, &allowed ) ) continue;
+            if ( remaining-- ) continue;
+
+            cpu_set_t pinned;
+            CPU_ZERO( &pinned );
+            CPU_SET( cpu, &pinned );
+            pthread_setaffinity_np( thread.native_handle(), sizeof( pinned ), &pinned );
+            return;
+        }
+#else
+        (void)thread;
+        (void)workerIndex;
+#endif
+    }
+}
+
+WorkerPool::WorkerPool( size_t numWorkers, bool pinThreads )
+{
+    // The invoking thread is worker zero. We spawn the rest.
+    for ( size_t i = 1; i < numWorkers; ++i )
+    {
+        threads.emplace_back( &WorkerPool::workerLoop, this, i );
+        if ( pinThreads )
+            pinThread( threads.back(), i );
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard< std::mutex > lock{ mutex };
+        terminating = true;
+    }
+    startCondition.notify_all();
+    for ( auto & thread : threads )
+        thread.join();
+}
+
+void WorkerPool::run( const JobType & job )
+{
+    // Publish the job to the spawned workers.
+    {
+        std::lock_guard< std::mutex > lock{ mutex };
+        pJob = &job;
+        firstException = nullptr;
+        numPending = threads.size();
+        ++generation;
+    }
+    startCondition.notify_all();
+
+    // Do our own share.
+    invoke( 0 );
+
+    // Wait for the spawned workers.
+    std::exception_ptr exception;
+    {
+        std::unique_lock< std::mutex > lock{ mutex };
+        doneCondition.wait( lock, [ this ]() { return 0 == numPending; } );
+        pJob = nullptr;
+        exception = firstException;
+        firstException = nullptr;
+    }
+
+    if ( exception )
+        std::rethrow_exception( exception );
+}
+
+void WorkerPool::arriveAndWait()
+{
+    // The last worker to arrive releases the others by advancing the barrier generation.
+    const auto arrivalGeneration = barrierGeneration.load( std::memory_order_acquire );
+    if ( getNumWorkers() == barrierCount.fetch_add( 1, std::memory_order_acq_rel ) + 1 )
+    {
+        barrierCount.store( 0, std::memory_order_relaxed );
+        barrierGeneration.fetch_add( 1, std::memory_order_release );
+        return;
+    }
+
+    while ( arrivalGeneration == barrierGeneration.load( std::memory_order_acquire ) )
+        std::this_thread::yield();
+}
+
+void WorkerPool::workerLoop( size_t workerIndex )
+{
+    size_t lastGeneration = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock< std::mutex > lock{ mutex };
+            startCondition.wait( lock, [ this, lastGeneration ]() { return terminating || lastGeneration != generation; } );
+            if ( terminating ) return;
+            lastGeneration = generation;
+        }
+
+        invoke( workerIndex );
+
+        bool lastDone;
+        {
+            std::lock_guard< std::mutex > lock{ mutex };
+            lastDone = 0 == --numPending;
+        }
+        if ( lastDone )
+            doneCondition.notify_one();
+    }
+}
+
+void WorkerPool::invoke( size_t workerIndex )
+{
+    try
+    {
+        (*pJob)( workerIndex );
+    }
+    catch ( ... )
+    {
+        std::lock_guard< std::mutex > lock{ mutex };
+        if ( !firstException )
+            firstException = std::current_exception();
+    }
+}
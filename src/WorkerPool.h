@@ -0,0 +1,97 @@
+/**
+ * @file WorkerPool.h
+ * @brief The specification file for the Worker Pool (private)
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_WORKERPOOL_H
+#define REISER_RT_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ReiserRT
+{
+    namespace Signal
+    {
+        /**
+         * @brief Worker Pool
+         *
+         * A fixed set of worker threads which run one job at a time, each worker invoking the job with its own
+         * worker index. The invoking thread serves as worker zero, so a pool of one worker spawns no threads.
+         * Threads are created at construction and joined at destruction, never while running a job.
+         */
+        class WorkerPool
+        {
+        public:
+            /**
+             * @brief The Job Type, Invoked with a Worker Index in the Range [0, numWorkers)
+             */
+            using JobType = std::function< void( size_t workerIndex ) >;
+
+            /**
+             * @brief Qualified Constructor
+             *
+             * @param numWorkers The number of workers, inclusive of the invoking thread. Zero is taken as one.
+             * @param pinThreads If true, each spawned worker thread is pinned to a core, worker `k` to the `k`th
+             * core of the process's affinity mask, wrapping around. The invoking thread is left as it is.
+             * Pinning is only supported on Linux and is otherwise ignored.
+             */
+            explicit WorkerPool( size_t numWorkers, bool pinThreads = false );
+
+            ~WorkerPool();
+
+            WorkerPool( const WorkerPool & another ) = delete;
+            WorkerPool & operator =( const WorkerPool & another ) = delete;
+
+            /**
+             * @brief Run a Job on Every Worker and Wait for All of Them
+             *
+             * @param job The job, invoked once for each worker index. It must remain valid until return.
+             * @throw Rethrows the first exception thrown by any worker, after all workers complete.
+             */
+            void run( const JobType & job );
+
+            /**
+             * @brief Wait Until Every Worker of the Running Job Arrives
+             *
+             * Invoked from within a job, by every worker, to separate phases of the job. Workers spin, yielding,
+             * rather than block, as phases are expected to be short and evenly balanced.
+             * @warning A job utilizing this must not throw, or the remaining workers would wait indefinitely.
+             * Such a job records any exception itself, still arriving at every barrier, and rethrows after `run`.
+             */
+            void arriveAndWait();
+
+            /**
+             * @brief Query the Number of Workers
+             *
+             * @return The number of workers, inclusive of the invoking thread.
+             */
+            [[nodiscard]] size_t getNumWorkers() const { return threads.size() + 1; }
+
+        private:
+            void workerLoop( size_t workerIndex );
+            void invoke( size_t workerIndex );
+
+            std::vector< std::thread > threads;
+            std::mutex mutex;
+            std::condition_variable startCondition;
+            std::condition_variable doneCondition;
+            const JobType * pJob{};
+            std::exception_ptr firstException{};
+            std::atomic< size_t > barrierCount{};
+            std::atomic< size_t > barrierGeneration{};
+            size_t generation{};
+            size_t numPending{};
+            bool terminating{};
+        };
+    }
+}
+
+#endif //REISER_RT_WORKERPOOL_H
@@ -0,0 +1,108 @@
+/**
+ * @file batchEnvelopeBenchmark.cpp
+ * @brief A Measurement of Batch Envelopes Against Per Harmonic Envelopes
+ *
+ * For a range of harmonic counts, we measure the throughput of scintillated comb generation with the
+ * CombScintillationEnvelopeFunctor delivering its envelopes one harmonic per invocation, against the same
+ * functor filling the envelope matrix of a batch envelope functor. Scintillated magnitudes are drawn from
+ * counter based streams of harmonic and decorrelation boundary, so both forms apply the same envelopes and
+ * their outputs differ only by the order of summation. The peak difference relative to the sum of the
+ * harmonic magnitudes is also reported.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "CombScintillationEnvelopeFunctor.h"
+
+#include <memory>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t maxHarmonics = 1024;
+    constexpr size_t epochSize = combGeneratorBatchEnvelopeBlockSamples;
+    constexpr size_t numTimedEpochs = 2048;
+    constexpr size_t decorrelationSamples = 1000;
+    constexpr uint32_t seed = 4242;
+    constexpr double fundamentalRadiansPerSample = 2.0 * M_PI * 3.0 / 4096.0;
+
+    // Runs the timed epochs, leaving the last epoch in the buffer.
+    double timeEpochs( CombGeneratorEngineType engineType, size_t numHarmonics,
+                       const CombGeneratorScalarVectorType & magnitudes, bool batch, FlyingPhasorElementType * pBuffer )
+    {
+        CombScintillationEnvelopeFunctor scintillation{ maxHarmonics, epochSize };
+        scintillation.reset( numHarmonics, decorrelationSamples, magnitudes, seed );
+
+        CombGenerator combGenerator{ maxHarmonics, engineType };
+        if ( batch )
+            combGenerator.resetWithBatchEnvelope( numHarmonics, fundamentalRadiansPerSample, magnitudes, nullptr,
+                [ &scintillation ]( size_t currentSample, size_t numSamples, size_t firstHarmonic, size_t numRangeHarmonics,
+                                    double * pEnvelopeMatrix, size_t stride )
+                {
+                    scintillation.fillEnvelopeMatrix( currentSample, numSamples, firstHarmonic, numRangeHarmonics,
+                                                      pEnvelopeMatrix, stride );
+                } );
+        else
+            combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, nullptr,
+                                 std::ref( scintillation ) );
+
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t epoch = 0; numTimedEpochs != epoch; ++epoch )
+            combGenerator.getSamples( pBuffer, epochSize );
+        const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+        return elapsed.count();
+    }
+}
+
+int main()
+{
+    CombGenerator probe{ 1, CombGeneratorEngineType::FusedKernel };
+    std::cout << "Kernel variant: " << int( probe.getKernelVariant() ) << std::endl;
+    std::cout << std::setw( 12 ) << "engine" << std::setw( 10 ) << "harmonics" << std::setw( 18 ) << "per harmonic (s)"
+              << std::setw( 12 ) << "batch (s)" << std::setw( 10 ) << "speedup" << std::setw( 18 ) << "peak delta (dB)"
+              << std::endl;
+
+    std::unique_ptr< FlyingPhasorElementType[] > perHarmonicBuffer{ new FlyingPhasorElementType[ epochSize ] };
+    std::unique_ptr< FlyingPhasorElementType[] > batchBuffer{ new FlyingPhasorElementType[ epochSize ] };
+    for ( auto engineType : { CombGeneratorEngineType::FusedKernel, CombGeneratorEngineType::PhasorBank } )
+    {
+        for ( size_t numHarmonics : { 12, 48, 240, 1024 } )
+        {
+            // Magnitudes the reciprocal of harmonic number (sawtooth), as streamCombGenerator profile 1.
+            std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+            double sumOfMagnitudes = 0.0;
+            for ( size_t i = 0; numHarmonics != i; ++i )
+            {
+                magnitudes[i] = 1.0 / double( i + 1 );
+                sumOfMagnitudes += magnitudes[i];
+            }
+            CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+
+            const auto perHarmonicSeconds = timeEpochs( engineType, numHarmonics, sharedMagnitudes, false,
+                                                        perHarmonicBuffer.get() );
+            const auto batchSeconds = timeEpochs( engineType, numHarmonics, sharedMagnitudes, true, batchBuffer.get() );
+
+            double peakDelta = 0.0;
+            for ( size_t n = 0; epochSize != n; ++n )
+                peakDelta = std::max( peakDelta, std::abs( batchBuffer[n] - perHarmonicBuffer[n] ) );
+            const auto peakDeltaDb = 20.0 * std::log10( peakDelta / sumOfMagnitudes );
+
+            std::cout << std::fixed << std::setprecision( 4 )
+                      << std::setw( 12 ) << ( CombGeneratorEngineType::FusedKernel == engineType ? "fusedKernel" : "phasorBank" )
+                      << std::setw( 10 ) << numHarmonics << std::setw( 18 ) << perHarmonicSeconds
+                      << std::setw( 12 ) << batchSeconds
+                      << std::setprecision( 2 ) << std::setw( 10 ) << perHarmonicSeconds / batchSeconds
+                      << std::setprecision( 1 ) << std::setw( 18 ) << peakDeltaDb << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file fixedCombGeneratorBenchmark.cpp
+ * @brief A Measurement of the Compile Time Specialized Comb Generator Against the Runtime Comb Generator
+ *
+ * For a range of harmonic counts, we measure the throughput of a FixedCombGenerator against a CombGenerator
+ * constructed with the FusedKernel engine and with the default PhasorBank engine, both without an envelope
+ * and with an envelope. The envelope is a linear fade, supplied to the FixedCombGenerator as an envelope policy
+ * and to the CombGenerator as the equivalent per harmonic envelope functor. The peak difference between the
+ * FixedCombGenerator and the FusedKernel engine, relative to the sum of the harmonic magnitudes, is also reported.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "FixedCombGenerator.h"
+
+#include <memory>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t epochSize = 256;
+    constexpr size_t numTimedEpochs = 4096;
+    constexpr size_t fadeSamples = epochSize * numTimedEpochs;
+    constexpr double fundamentalRadiansPerSample = 2.0 * M_PI * 3.0 / 4096.0;
+
+    double fadeGain( size_t sampleCount )
+    {
+        return 1.0 - double( sampleCount ) / double( fadeSamples );
+    }
+
+    // The envelope policy form of the fade.
+    struct FadeEnvelope
+    {
+        double operator()( size_t sampleCount, size_t, double nominalMagnitude ) const
+        {
+            return nominalMagnitude * fadeGain( sampleCount );
+        }
+    };
+
+    // The per harmonic envelope functor form of the fade.
+    class FadeEnvelopeFunctor
+    {
+    public:
+        explicit FadeEnvelopeFunctor( size_t maxHarmonics ) : buffers( maxHarmonics, std::vector< double >( epochSize ) ) {}
+
+        const double * operator()( size_t currentSample, size_t numSamples, size_t nHarmonic, double nominalMagnitude )
+        {
+            auto & buffer = buffers[ nHarmonic ];
+            for ( size_t i = 0; numSamples != i; ++i )
+                buffer[i] = nominalMagnitude * fadeGain( currentSample + i );
+            return buffer.data();
+        }
+
+    private:
+        std::vector< std::vector< double > > buffers;
+    };
+
+    template < typename Generator >
+    double timeEpochs( Generator & generator, FlyingPhasorElementType * pBuffer )
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t epoch = 0; numTimedEpochs != epoch; ++epoch )
+            generator.getSamples( pBuffer, epochSize );
+        const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+        return elapsed.count();
+    }
+
+    template < size_t numHarmonics, typename EnvelopePolicy >
+    void measure()
+    {
+        constexpr bool enveloped = !std::is_same< EnvelopePolicy, FixedCombGeneratorNominalEnvelope >::value;
+
+        // Magnitudes the reciprocal of harmonic number (sawtooth), as streamCombGenerator profile 1.
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 );
+            sumOfMagnitudes += magnitudes[i];
+        }
+
+        std::unique_ptr< FlyingPhasorElementType[] > fixedBuffer{ new FlyingPhasorElementType[ epochSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > fusedBuffer{ new FlyingPhasorElementType[ epochSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > phasorBankBuffer{ new FlyingPhasorElementType[ epochSize ] };
+
+        std::unique_ptr< FixedCombGenerator< numHarmonics, EnvelopePolicy > > fixedGenerator{
+                new FixedCombGenerator< numHarmonics, EnvelopePolicy >{} };
+        fixedGenerator->reset( fundamentalRadiansPerSample, magnitudes.get() );
+        const auto fixedSeconds = timeEpochs( *fixedGenerator, fixedBuffer.get() );
+
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        double runtimeSeconds[ 2 ];
+        FlyingPhasorElementType * runtimeBuffers[ 2 ] = { fusedBuffer.get(), phasorBankBuffer.get() };
+        const CombGeneratorEngineType engineTypes[ 2 ] = { CombGeneratorEngineType::FusedKernel,
+                                                           CombGeneratorEngineType::PhasorBank };
+        for ( size_t e = 0; 2 != e; ++e )
+        {
+            FadeEnvelopeFunctor fadeEnvelopeFunctor{ numHarmonics };
+            CombGeneratorEnvelopeFunkType envelopeFunk{};
+            if ( enveloped )
+                envelopeFunk = std::ref( fadeEnvelopeFunctor );
+
+            CombGenerator combGenerator{ numHarmonics, engineTypes[e] };
+            combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, nullptr, envelopeFunk );
+            runtimeSeconds[e] = timeEpochs( combGenerator, runtimeBuffers[e] );
+        }
+
+        double peakDelta = 0.0;
+        for ( size_t n = 0; epochSize != n; ++n )
+            peakDelta = std::max( peakDelta, std::abs( fixedBuffer[n] - fusedBuffer[n] ) );
+        const auto peakDeltaDb = peakDelta ? 20.0 * std::log10( peakDelta / sumOfMagnitudes ) : -INFINITY;
+
+        std::cout << std::fixed << std::setprecision( 4 )
+                  << std::setw( 10 ) << ( enveloped ? "fade" : "none" ) << std::setw( 10 ) << numHarmonics
+                  << std::setw( 12 ) << fixedSeconds << std::setw( 12 ) << runtimeSeconds[0]
+                  << std::setw( 12 ) << runtimeSeconds[1]
+                  << std::setprecision( 2 ) << std::setw( 10 ) << runtimeSeconds[0] / fixedSeconds
+                  << std::setw( 10 ) << runtimeSeconds[1] / fixedSeconds
+                  << std::setprecision( 1 ) << std::setw( 18 ) << peakDeltaDb << std::endl;
+    }
+}
+
+int main()
+{
+    CombGenerator probe{ 1, CombGeneratorEngineType::FusedKernel };
+    std::cout << "Kernel variant: " << int( probe.getKernelVariant() ) << std::endl;
+    std::cout << std::setw( 10 ) << "envelope" << std::setw( 10 ) << "harmonics" << std::setw( 12 ) << "fixed (s)"
+              << std::setw( 12 ) << "fused (s)" << std::setw( 12 ) << "bank (s)" << std::setw( 10 ) << "vs fused"
+              << std::setw( 10 ) << "vs bank" << std::setw( 18 ) << "peak delta (dB)" << std::endl;
+
+    measure< 4, FixedCombGeneratorNominalEnvelope >();
+    measure< 12, FixedCombGeneratorNominalEnvelope >();
+    measure< 48, FixedCombGeneratorNominalEnvelope >();
+    measure< 240, FixedCombGeneratorNominalEnvelope >();
+    measure< 4, FadeEnvelope >();
+    measure< 12, FadeEnvelope >();
+    measure< 48, FadeEnvelope >();
+    measure< 240, FadeEnvelope >();
+
+    return 0;
+}
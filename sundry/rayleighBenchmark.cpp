@@ -0,0 +1,119 @@
+/**
+ * @file rayleighBenchmark.cpp
+ * @brief A Measurement of Batched Rayleigh and Gaussian Variate Generation
+ *
+ * For a range of batch sizes, we measure the rate at which the RayleighDistributor of the test utilities delivers
+ * values one `getValue` invocation at a time, against its batch `fill` operation. Likewise, the rate at which
+ * a `std::normal_distribution` over a `std::mt19937` delivers normal values, against the batch `fill` operation
+ * of the GaussianDistributor. As a check of the statistics, the mean and mean square of each are reported relative
+ * to those expected, a mean of one and a mean square of 4/pi for Rayleigh values and a mean square of one for
+ * normal values of unit sigma.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "RayleighDistributor.h"
+#include "GaussianDistributor.h"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t numValuesTimed = size_t( 1 ) << 24;
+    constexpr uint32_t seed = 4242;
+
+    struct Measurement
+    {
+        double valuesPerSecond{};
+        double mean{};
+        double meanSquare{};
+    };
+
+    // Runs the batches, summing the values and their squares to check their statistics.
+    template< typename BatchFunkType >
+    Measurement measure( size_t batchSize, BatchFunkType batchFunk )
+    {
+        std::vector< double > values( batchSize );
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+        const auto numBatches = numValuesTimed / batchSize;
+
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t batch = 0; numBatches != batch; ++batch )
+        {
+            batchFunk( values.data(), batchSize );
+            for ( auto value : values )
+            {
+                sum += value;
+                sumOfSquares += value * value;
+            }
+        }
+        const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto numValues = double( numBatches * batchSize );
+        return Measurement{ numValues / elapsed.count(), sum / numValues, sumOfSquares / numValues };
+    }
+
+    void report( const char * pName, size_t batchSize, const Measurement & current, const Measurement & batched,
+                 double expectedMean, double expectedMeanSquare )
+    {
+        std::cout << std::setw( 10 ) << pName << std::setw( 8 ) << batchSize
+                  << std::fixed << std::setprecision( 1 )
+                  << std::setw( 16 ) << current.valuesPerSecond / 1e6
+                  << std::setw( 16 ) << batched.valuesPerSecond / 1e6
+                  << std::setprecision( 2 ) << std::setw( 10 ) << batched.valuesPerSecond / current.valuesPerSecond
+                  << std::setprecision( 4 )
+                  << std::setw( 10 ) << ( expectedMean ? batched.mean / expectedMean : batched.mean )
+                  << std::setw( 12 ) << batched.meanSquare / expectedMeanSquare << std::endl;
+    }
+}
+
+int main()
+{
+    std::cout << std::setw( 10 ) << "variate" << std::setw( 8 ) << "batch" << std::setw( 16 ) << "current (M/s)"
+              << std::setw( 16 ) << "batched (M/s)" << std::setw( 10 ) << "speedup" << std::setw( 10 ) << "mean"
+              << std::setw( 12 ) << "mean square" << std::endl;
+
+    for ( size_t batchSize : { 24, 240, 4096 } )
+    {
+        // Unit means, so the expected mean of every value is one.
+        std::vector< double > means( batchSize, 1.0 );
+
+        RayleighDistributor rayleighDistributor{};
+        rayleighDistributor.reset( seed );
+        const auto current = measure( batchSize, [ & ]( double * pValues, size_t numValues )
+        {
+            for ( size_t i = 0; numValues != i; ++i )
+                pValues[i] = rayleighDistributor.getValue( means[i] );
+        } );
+        const auto batched = measure( batchSize, [ & ]( double * pValues, size_t numValues )
+        {
+            rayleighDistributor.fill( pValues, numValues, means.data() );
+        } );
+        report( "rayleigh", batchSize, current, batched, 1.0, 4.0 / M_PI );
+
+        std::mt19937 rndEngine{ seed };
+        std::normal_distribution< double > normalDistribution{};
+        GaussianDistributor gaussianDistributor{};
+        gaussianDistributor.reset( seed );
+        const auto currentNormal = measure( batchSize, [ & ]( double * pValues, size_t numValues )
+        {
+            for ( size_t i = 0; numValues != i; ++i )
+                pValues[i] = normalDistribution( rndEngine );
+        } );
+        const auto batchedNormal = measure( batchSize, [ & ]( double * pValues, size_t numValues )
+        {
+            gaussianDistributor.fill( pValues, numValues, 1.0 );
+        } );
+        report( "gaussian", batchSize, currentNormal, batchedNormal, 0.0, 1.0 );
+    }
+
+    return 0;
+}
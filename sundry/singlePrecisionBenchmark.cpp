@@ -0,0 +1,119 @@
+/**
+ * @file singlePrecisionBenchmark.cpp
+ * @brief A Measurement of Single Precision Generation Against Double Precision
+ *
+ * For a range of harmonic counts, we measure the throughput of the single precision `getSamples`
+ * against the double precision `getSamples` of the FusedKernel engine, followed by the single precision
+ * spur level. The spur level is taken from the spectrum of the difference between the two precisions
+ * relative to the strongest harmonic. Harmonics are placed exactly on DFT basis functions so that no
+ * window is required. Peak sample error relative to the sum of the harmonic magnitudes is also reported.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+
+#include <memory>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t maxHarmonics = 1024;
+    constexpr size_t epochSize = 4096;
+    constexpr size_t numTimedEpochs = 256;
+    constexpr double fundamentalRadiansPerSample = 2.0 * M_PI * 3.0 / double( epochSize );
+
+    template < typename ElementType >
+    double timeEpochs( size_t numHarmonics, const CombGeneratorScalarVectorType & magnitudes )
+    {
+        CombGenerator combGenerator{ maxHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, nullptr );
+        std::unique_ptr< ElementType[] > epochBuffer{ new ElementType[ epochSize ] };
+
+        const auto start = std::chrono::steady_clock::now();
+        for ( size_t epoch = 0; numTimedEpochs != epoch; ++epoch )
+            combGenerator.getSamples( epochBuffer.get(), epochSize );
+        const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+        return elapsed.count();
+    }
+
+    // The largest DFT bin power of a series in decibels. Plain DFT, computed once per harmonic count.
+    double peakBinPowerDb( const FlyingPhasorElementType * pSeries )
+    {
+        double peakPower = 0.0;
+        for ( size_t k = 0; epochSize != k; ++k )
+        {
+            FlyingPhasorElementType sum{};
+            for ( size_t n = 0; epochSize != n; ++n )
+            {
+                const auto angle = -2.0 * M_PI * double( ( k * n ) % epochSize ) / double( epochSize );
+                sum += pSeries[n] * FlyingPhasorElementType{ std::cos( angle ), std::sin( angle ) };
+            }
+            peakPower = std::max( peakPower, std::norm( sum ) );
+        }
+        return 10.0 * std::log10( peakPower );
+    }
+}
+
+int main()
+{
+    CombGenerator probe{ 1, CombGeneratorEngineType::FusedKernel };
+    std::cout << "Kernel variant: " << int( probe.getKernelVariant() ) << std::endl;
+    std::cout << std::setw( 10 ) << "harmonics" << std::setw( 14 ) << "double (s)" << std::setw( 14 ) << "single (s)"
+              << std::setw( 10 ) << "speedup" << std::setw( 14 ) << "spur (dBc)" << std::setw( 18 ) << "peak error (dB)"
+              << std::endl;
+
+    for ( size_t numHarmonics : { 12, 48, 240, 1024 } )
+    {
+        // Magnitudes the reciprocal of harmonic number (sawtooth), as streamCombGenerator profile 1.
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 );
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+
+        const auto doubleSeconds = timeEpochs< FlyingPhasorElementType >( numHarmonics, sharedMagnitudes );
+        const auto singleSeconds = timeEpochs< CombGeneratorSingleElementType >( numHarmonics, sharedMagnitudes );
+
+        // Produce one epoch in each precision, well into the series, and take the difference.
+        CombGenerator doubleGenerator{ maxHarmonics, CombGeneratorEngineType::FusedKernel };
+        CombGenerator singleGenerator{ maxHarmonics, CombGeneratorEngineType::FusedKernel };
+        doubleGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, nullptr );
+        singleGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, nullptr );
+        std::unique_ptr< FlyingPhasorElementType[] > doubleBuffer{ new FlyingPhasorElementType[ epochSize ] };
+        std::unique_ptr< CombGeneratorSingleElementType[] > singleBuffer{ new CombGeneratorSingleElementType[ epochSize ] };
+        for ( size_t epoch = 0; numTimedEpochs != epoch; ++epoch )
+        {
+            doubleGenerator.getSamples( doubleBuffer.get(), epochSize );
+            singleGenerator.getSamples( singleBuffer.get(), epochSize );
+        }
+
+        std::unique_ptr< FlyingPhasorElementType[] > errorBuffer{ new FlyingPhasorElementType[ epochSize ] };
+        double peakError = 0.0;
+        for ( size_t n = 0; epochSize != n; ++n )
+        {
+            errorBuffer[n] = FlyingPhasorElementType{ singleBuffer[n].real(), singleBuffer[n].imag() } - doubleBuffer[n];
+            peakError = std::max( peakError, std::abs( errorBuffer[n] ) );
+        }
+
+        const auto spurDbc = peakBinPowerDb( errorBuffer.get() ) - peakBinPowerDb( doubleBuffer.get() );
+        const auto peakErrorDb = 20.0 * std::log10( peakError / sumOfMagnitudes );
+
+        std::cout << std::fixed << std::setprecision( 4 )
+                  << std::setw( 10 ) << numHarmonics << std::setw( 14 ) << doubleSeconds << std::setw( 14 ) << singleSeconds
+                  << std::setprecision( 2 ) << std::setw( 10 ) << doubleSeconds / singleSeconds
+                  << std::setprecision( 1 ) << std::setw( 14 ) << spurDbc << std::setw( 18 ) << peakErrorDb << std::endl;
+    }
+
+    return 0;
+}
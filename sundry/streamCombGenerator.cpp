@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <iostream>
+#include <stdexcept>
 
 using namespace ReiserRT::Signal;
 
@@ -40,6 +41,7 @@ void printHelpScreen()
     std::cout << "    --skipChunks=<ulong>" << std::endl;
     std::cout << "        The number of chunks to skip before any chunks are output. Does not effect the numChunks output." << std::endl;
     std::cout << "        In essence if numChunks is 1 and skip chunks is 4, chunk number 5 is the only chunk output." << std::endl;
+    std::cout << "        Skipped chunks are not generated. The comb generator seeks directly past them." << std::endl;
     std::cout << "        Defaults to 0 chunks skipped if unspecified." << std::endl;
     std::cout << "    --decorrelSamples=<ulong>: The number of samples for scintillation decorrelation." << std::endl;
     std::cout << "        Defaults to zero (no scintillation)." << std::endl;
@@ -54,6 +56,13 @@ void printHelpScreen()
     std::cout << "        b32 - Outputs data in raw binary with 32bit precision (uint32 and float), native endian-ness." << std::endl;
     std::cout << "        b64 - Outputs data in raw binary 64bit precision (uint64 and double), native endian-ness." << std::endl;
     std::cout << "        Defaults to t64 if unspecified." << std::endl;
+    std::cout << "    --engine=<string>" << std::endl;
+    std::cout << "        phasorBank - One ReiserRT_FlyingPhasor per harmonic." << std::endl;
+    std::cout << "        fused - Fused sample major kernel." << std::endl;
+    std::cout << "        closedForm - Closed form geometric series. Requires profile 0, a seed of 0 and no scintillation." << std::endl;
+    std::cout << "        inverseFft - Inverse FFT block synthesis. Fused kernel with scintillation." << std::endl;
+    std::cout << "        automatic - Closed form, inverse FFT or fused kernel, whichever suits best." << std::endl;
+    std::cout << "        Defaults to phasorBank if unspecified." << std::endl;
     std::cout << "    --includeX" << std::endl;
     std::cout << "        Include sample count in the output stream. This is useful for gnuplot using any format." << std::endl;
     std::cout << "        Defaults to no inclusion if unspecified." << std::endl;
@@ -64,6 +73,8 @@ void printHelpScreen()
     std::cout << "    3 - Number of harmonics exceeds the maximum of " << MAX_HARMONICS << "." << std::endl;
     std::cout << "    4 - Invalid streamFormat specified." << std::endl;
     std::cout << "    5 - Invalid profile specified." << std::endl;
+    std::cout << "    6 - Invalid engine specified." << std::endl;
+    std::cout << "    7 - Engine does not support the generation parameters specified." << std::endl;
 }
 
 int main( int argc, char * argv[] )
@@ -94,6 +105,7 @@ int main( int argc, char * argv[] )
               << " --profile=" << cmdLineParser.getProfile() << std::endl
               << " --seed=" << cmdLineParser.getSeed() << std::endl
               << " --streamFormat=" << (int)cmdLineParser.getStreamFormat() << std::endl
+              << " --engine=" << (int)cmdLineParser.getEngine() << std::endl
               << " --includeX=" << (int)cmdLineParser.getIncludeX() << std::endl
               << std::endl;
 #endif
@@ -135,6 +147,31 @@ int main( int argc, char * argv[] )
         exit( 5 );
     }
 
+    // Do we have a valid engine to use?
+    auto engineType = CombGeneratorEngineType::PhasorBank;
+    switch ( cmdLineParser.getEngine() )
+    {
+        case CommandLineParser::Engine::PhasorBank:
+            engineType = CombGeneratorEngineType::PhasorBank;
+            break;
+        case CommandLineParser::Engine::FusedKernel:
+            engineType = CombGeneratorEngineType::FusedKernel;
+            break;
+        case CommandLineParser::Engine::ClosedForm:
+            engineType = CombGeneratorEngineType::ClosedForm;
+            break;
+        case CommandLineParser::Engine::InverseFft:
+            engineType = CombGeneratorEngineType::InverseFft;
+            break;
+        case CommandLineParser::Engine::Automatic:
+            engineType = CombGeneratorEngineType::Automatic;
+            break;
+        case CommandLineParser::Engine::Invalid:
+        default:
+            std::cerr << "streamCombGenerator Error: Invalid Engine Specified. Use --help for instructions" << std::endl;
+            exit( 6 );
+    }
+
     // If we are using a text stream format, set the output precision
     if ( CommandLineParser::StreamFormat::Text32 == streamFormat)
     {
@@ -191,30 +228,39 @@ int main( int argc, char * argv[] )
     // go out of scope until we are potentially done using it.
     CombScintillationEnvelopeFunctor combScintillationEnvelopeFunctor{ MAX_HARMONICS, chunkSize };
 
-    // Instantiate Comb Generator for maximum number of harmonics.
-    ReiserRT::Signal::CombGenerator combGenerator{ MAX_HARMONICS };
+    // Instantiate Comb Generator for maximum number of harmonics and the engine requested.
+    ReiserRT::Signal::CombGenerator combGenerator{ MAX_HARMONICS, engineType };
 
     // Reset the Comb Generator for the job at hand
     const auto harmonicSpacing = cmdLineParser.getSpacingRadsPerSample();
     const auto decorrelationSamples = cmdLineParser.getDecorrelSamples();
-    if ( !decorrelationSamples )
+    try
     {
-        // The magnitudes and the phases are moved into shared pointer interfaces implicitly.
-        combGenerator.reset( numHarmonics, harmonicSpacing,
-                             std::move( pMagnitudes ), std::move( pPhases ) );
-    }
-    else
-    {
-        // We are going to share magnitudes between our Comb Generator and our Comb Scintillation Envelope Functor
-        ReiserRT::Signal::CombGeneratorScalarVectorType sharedMagnitudes{ std::move( pMagnitudes ) };
+        if ( !decorrelationSamples )
+        {
+            // The magnitudes and the phases are moved into shared pointer interfaces implicitly.
+            combGenerator.reset( numHarmonics, harmonicSpacing,
+                                 std::move( pMagnitudes ), std::move( pPhases ) );
+        }
+        else
+        {
+            // We are going to share magnitudes between our Comb Generator and our Comb Scintillation Envelope Functor
+            ReiserRT::Signal::CombGeneratorScalarVectorType sharedMagnitudes{ std::move( pMagnitudes ) };
 
-        // Reset our Comb Scintillation Envelope Functor
-        combScintillationEnvelopeFunctor.reset( numHarmonics, decorrelationSamples, sharedMagnitudes,
-                                                subSeedGenerator.getSubSeed() );
+            // Reset our Comb Scintillation Envelope Functor
+            combScintillationEnvelopeFunctor.reset( numHarmonics, decorrelationSamples, sharedMagnitudes,
+                                                    subSeedGenerator.getSubSeed() );
 
-        // Reset our Comb Generator
-        combGenerator.reset( numHarmonics, harmonicSpacing, sharedMagnitudes,
-                             std::move( pPhases ), std::ref( combScintillationEnvelopeFunctor ) );
+            // Reset our Comb Generator
+            combGenerator.reset( numHarmonics, harmonicSpacing, sharedMagnitudes,
+                                 std::move( pPhases ), std::ref( combScintillationEnvelopeFunctor ) );
+        }
+    }
+    catch ( const std::invalid_argument & e )
+    {
+        // The closed form engine rejects generation parameters it cannot synthesize.
+        std::cerr << "streamCombGenerator Error: " << e.what() << std::endl;
+        exit( 7 );
     }
 
     // Allocate Memory for Comb Generator Output Samples
@@ -223,23 +269,16 @@ int main( int argc, char * argv[] )
     // Are we including Sample count in the output?
     auto includeX = cmdLineParser.getIncludeX();
 
+    // Skip over any chunks we are not to output. The Comb Generator moves its phase state
+    // directly to the sample index, at a cost independent of the number of samples skipped.
     FlyingPhasorElementBufferTypePtr p = pCombSampleSeries.get();
-    size_t sampleCount = 0;
-    size_t skippedChunks = 0;
-    for ( size_t chunk = 0; numChunks != chunk; ++chunk )
+    size_t sampleCount = skipChunks * chunkSize;
+    combGenerator.skipSamples( sampleCount );
+    for ( size_t chunk = skipChunks; numChunks != chunk; ++chunk )
     {
-        // Get Samples. If we are skipping chunks, we may not output, but we must
-        // maintain flying phasor state.
+        // Get Samples.
         combGenerator.getSamples( p, chunkSize );
 
-        // Skip this Chunk?
-        if ( skipChunks != skippedChunks )
-        {
-            ++skippedChunks;
-            sampleCount += chunkSize;
-            continue;
-        }
-
         if ( CommandLineParser::StreamFormat::Text32 == streamFormat ||
              CommandLineParser::StreamFormat::Text64 == streamFormat )
         {
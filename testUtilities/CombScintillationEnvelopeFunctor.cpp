@@ -4,8 +4,9 @@
 #include "RayleighDistributor.h"
 #include "ScintillationEngine.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
-#include <cstring>
 #include <vector>
 
 class CombScintillationEnvelopeFunctor::Imple
@@ -19,58 +20,72 @@ private:
     Imple( size_t theMaxHarmonics, size_t theEpochSize )
       : maxHarmonics{ theMaxHarmonics }
       , maxEpochSize{ theEpochSize }
-      , envelopeBuffer{ new double[ maxEpochSize ] }
-      , scintillationStates{ maxHarmonics }
+      , envelopeRows( maxHarmonics * maxEpochSize, 0.0 )
+      , scintillationEngine{ maxHarmonics }
+      , means( maxHarmonics, 0.0 )
     {
-        std::memset( envelopeBuffer.get(), 0, sizeof ( double ) * maxEpochSize );
     }
 
     ~Imple() = default;
 
-    void reset(size_t numHarmonics, size_t theDecorrelationSamples,
+    void reset(size_t theNumHarmonics, size_t theDecorrelationSamples,
                const ReiserRT::Signal::CombGeneratorScalarVectorType & pNominalMagnitudes, uint32_t seed )
     {
-        decorrelationSamples = theDecorrelationSamples;
+        numHarmonics = theNumHarmonics;
         rayleighDistributor.reset( seed );
+        nominalMagnitudes = pNominalMagnitudes;
 
-        // Initialize Scintillation State Vector for each harmonic tone.
+        // Each harmonic scintillates about its nominal magnitude. Scintillated magnitudes are drawn at every
+        // decorrelation boundary, the very first sample included, from a stream of the harmonic and boundary.
         auto pNominalMag = pNominalMagnitudes.get();
         for ( size_t i = 0; i != numHarmonics; ++i )
-        {
-            // The 'first' field is initial scintillated magnitude value and the 'second' field is
-            // reserved for the delta magnitude per sample value. We initialize this to zero as it
-            // will be set on the very first sample obtained per harmonic tone.
-            auto & ss = scintillationStates[i];
-            ss.first = rayleighDistributor.getValue( pNominalMag ? *pNominalMag++ : 1.0 );
-            ss.second = 0.0;    // The delta (slope) gets set by scintillation logic
-        }
-        std::memset( envelopeBuffer.get(), 0, sizeof ( double ) * maxEpochSize );
+            means[i] = pNominalMag ? pNominalMag[i] : 1.0;
+        scintillationEngine.reset( theDecorrelationSamples );
+
+        std::fill( envelopeRows.begin(), envelopeRows.end(), 0.0 );
     }
 
-    const double * operator()( size_t currentSampleCount, size_t numSamples, size_t nHarmonic, double nominalMag )
+    const double * operator()( size_t currentSampleCount, size_t numSamples, size_t nHarmonic, double )
     {
         ///@todo Throw if nHarmonic is greater than or equal to max harmonics?
         ///What about numSamples and maxEpochSize.
 
-        auto scintillateFunk = [ this, nominalMag ]()
-        {
-            return rayleighDistributor.getValue( nominalMag );
-        };
-
-        auto & ss = scintillationStates[ nHarmonic ];
+        // A harmonic of zero nominal magnitude stays at zero and draws no random values. It is muted.
+        if ( 0.0 == means[ nHarmonic ] )
+            return nullptr;
 
-        ScintillationEngine::run(envelopeBuffer.get(), numSamples,
-             std::ref( scintillateFunk ), ss, currentSampleCount, decorrelationSamples );
+        // Each harmonic is ramped into a row of its own, so harmonics may be invoked concurrently.
+        auto pRow = envelopeRows.data() + nHarmonic * maxEpochSize;
+        scintillationEngine.run( pRow, maxEpochSize, 1, currentSampleCount, numSamples,
+                                 nHarmonic, 1, std::ref( scintillateFunk ) );
+        return pRow;
+    }
 
-        return envelopeBuffer.get();
+    void fillEnvelopeMatrix( size_t currentSampleCount, size_t numSamples, size_t firstHarmonic,
+                             size_t numRangeHarmonics, double * pEnvelopeMatrix, size_t stride )
+    {
+        // The matrix is sample major, a row across the harmonics per sample, so it is written contiguously.
+        scintillationEngine.run( pEnvelopeMatrix, 1, stride, currentSampleCount, numSamples,
+                                 firstHarmonic, numRangeHarmonics, std::ref( scintillateFunk ) );
     }
 
     const size_t maxHarmonics;
     const size_t maxEpochSize;
-    std::unique_ptr< double[] > envelopeBuffer;
-    size_t decorrelationSamples{};
+    std::vector< double > envelopeRows;         // Harmonic major, a row of the maximum epoch size per harmonic.
+    size_t numHarmonics{};
     RayleighDistributor rayleighDistributor{};
-    std::vector< ScintillationEngine::StateType > scintillationStates;
+    ScintillationEngine scintillationEngine;
+    std::vector< double > means;
+    ReiserRT::Signal::CombGeneratorScalarVectorType nominalMagnitudes{};
+
+    // Magnitudes are drawn in batches, for every harmonic of the range at a boundary. The stream of each harmonic
+    // is that harmonic's index and its counter the boundary index, so draws do not depend on invocation order.
+    ScintillationEngine::ScintillateFunkType scintillateFunk =
+        [ this ]( double * pMagnitudes, size_t firstHarmonic, size_t numRangeHarmonics, size_t boundaryIndex )
+        {
+            rayleighDistributor.fill( pMagnitudes, numRangeHarmonics, means.data() + firstHarmonic,
+                                      firstHarmonic, boundaryIndex );
+        };
 };
 
 CombScintillationEnvelopeFunctor::CombScintillationEnvelopeFunctor( size_t maxHarmonics, size_t maxEpochSize )
@@ -94,3 +109,10 @@ const double * CombScintillationEnvelopeFunctor::operator ()( size_t currentSamp
 {
     return (*pImple)( currentSampleCount, numSamples, nHarmonic, nominalMag );
 }
+
+void CombScintillationEnvelopeFunctor::fillEnvelopeMatrix( size_t currentSampleCount, size_t numSamples,
+                                                           size_t firstHarmonic, size_t numHarmonics,
+                                                           double * pEnvelopeMatrix, size_t stride )
+{
+    pImple->fillEnvelopeMatrix( currentSampleCount, numSamples, firstHarmonic, numHarmonics, pEnvelopeMatrix, stride );
+}
@@ -26,6 +26,10 @@ public:
 
     const double * operator()( size_t currentSampleCount, size_t numSamples, size_t nHarmonic, double nominalMag );
 
+    // The CombGeneratorBatchEnvelopeFunkType form. Wrap in a lambda, or `std::bind`, to pass along.
+    void fillEnvelopeMatrix( size_t currentSampleCount, size_t numSamples, size_t firstHarmonic, size_t numHarmonics,
+                             double * pEnvelopeMatrix, size_t stride );
+
 private:
     Imple * pImple;
 };
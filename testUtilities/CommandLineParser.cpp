@@ -13,7 +13,7 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
     int retCode = 0;
 
     enum eOptions { SpacingRadsPerSample=1, NumHarmonics, Profile, ChunkSize, NumChunks, SkipChunks, DecorrelSamples,
-            Seed, StreamFormat, Help, IncludeX };
+            Seed, StreamFormat, Engine, Help, IncludeX };
 
     while (true) {
 //        int thisOptionOptIndex = optind ? optind : 1;
@@ -28,6 +28,7 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
                 {"decorrelSamples", required_argument, nullptr, DecorrelSamples },
                 {"seed", required_argument, nullptr, Seed },
                 {"streamFormat", required_argument, nullptr, StreamFormat },
+                {"engine", required_argument, nullptr, Engine },
                 {"help", no_argument, nullptr, Help },
                 {"includeX", no_argument, nullptr, IncludeX },
                 {nullptr, 0, nullptr, 0 }
@@ -89,6 +90,25 @@ int CommandLineParser::parseCommandLine( int argc, char * argv[] )
                 break;
             }
 
+            case Engine:
+            {
+                // Likewise, we either detect a valid engine string here, or we don't.
+                const std::string engineStr{ optarg };
+                if ( engineStr == "phasorBank" )
+                    engineIn = Engine::PhasorBank;
+                else if ( engineStr == "fused" )
+                    engineIn = Engine::FusedKernel;
+                else if ( engineStr == "closedForm" )
+                    engineIn = Engine::ClosedForm;
+                else if ( engineStr == "inverseFft" )
+                    engineIn = Engine::InverseFft;
+                else if ( engineStr == "automatic" )
+                    engineIn = Engine::Automatic;
+                else
+                    engineIn = Engine::Invalid;
+                break;
+            }
+
             case Help:
                 helpFlagIn = true;
                 break;
@@ -25,6 +25,9 @@ public:
     enum class StreamFormat : short { Invalid=0, Text32, Text64, Bin32, Bin64 };
     [[nodiscard]] StreamFormat getStreamFormat() const { return streamFormatIn; }
 
+    enum class Engine : short { Invalid=0, PhasorBank, FusedKernel, ClosedForm, InverseFft, Automatic };
+    [[nodiscard]] Engine getEngine() const { return engineIn; }
+
     inline bool getHelpFlag() const { return helpFlagIn; }
     inline bool getIncludeX() const { return includeX_In; }
 
@@ -42,6 +45,7 @@ private:
     bool includeX_In{ false };
 
     StreamFormat streamFormatIn{ StreamFormat::Text64 };
+    Engine engineIn{ Engine::PhasorBank };
 };
 
 #endif //REISER_RT_COMBGENERATOR_COMMANDLINEPARSER_H
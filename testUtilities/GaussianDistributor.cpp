@@ -0,0 +1,71 @@
+// Created on 20261016
+
+#include "GaussianDistributor.h"
+#include "Xoshiro256Engine.h"
+
+#include <cmath>
+#include <random>
+
+class GaussianDistributor::Imple
+{
+private:
+    friend class GaussianDistributor;
+
+    Imple()
+    {
+        engine.seed( std::random_device{}() );
+    }
+
+    ~Imple() = default;
+
+    void reset( uint32_t seed )
+    {
+        engine.seed( seed );
+    }
+
+    void fill( double * pValues, size_t numValues, double sigma )
+    {
+        // Deviates are drawn in place, then transformed a pair at a time. An odd value out takes a deviate
+        // of its own for its angle.
+        engine.fillUniform( pValues, numValues );
+        const auto numPairs = numValues / 2;
+        for ( size_t k = 0; numPairs != k; ++k )
+        {
+            const auto radius = sigma * std::sqrt( -2.0 * std::log( pValues[ 2 * k ] ) );
+            const auto angle = twoPi * pValues[ 2 * k + 1 ];
+            pValues[ 2 * k ] = radius * std::cos( angle );
+            pValues[ 2 * k + 1 ] = radius * std::sin( angle );
+        }
+
+        if ( numValues & 0x1 )
+        {
+            double u{};
+            engine.fillUniform( &u, 1 );
+            pValues[ numValues - 1 ] = sigma * std::sqrt( -2.0 * std::log( pValues[ numValues - 1 ] ) ) *
+                                       std::cos( twoPi * u );
+        }
+    }
+
+    const double twoPi{ 2.0 * M_PI };   // Deliberately not static.
+    Xoshiro256Engine engine{};
+};
+
+GaussianDistributor::GaussianDistributor()
+  : pImple{ new Imple{} }
+{
+}
+
+GaussianDistributor::~GaussianDistributor()
+{
+    delete pImple;
+}
+
+void GaussianDistributor::reset( uint32_t seed )
+{
+    pImple->reset( seed );
+}
+
+void GaussianDistributor::fill( double * pValues, size_t numValues, double sigma )
+{
+    pImple->fill( pValues, numValues, sigma );
+}
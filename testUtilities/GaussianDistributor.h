@@ -0,0 +1,29 @@
+// Created on 20261016
+
+#ifndef REISER_RT_COMBGENERATOR_GAUSSIANDISTRIBUTOR_H
+#define REISER_RT_COMBGENERATOR_GAUSSIANDISTRIBUTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+class GaussianDistributor
+{
+private:
+    class Imple;
+
+public:
+    GaussianDistributor();
+
+    ~GaussianDistributor();
+
+    void reset( uint32_t seed );
+
+    // Zero mean normal values of sigma, a batch at a time, by Box-Muller transforms of interleaved
+    // xoshiro256+ generators. Each pair of values takes a pair of uniform deviates.
+    void fill( double * pValues, size_t numValues, double sigma );
+
+private:
+    Imple * pImple;
+};
+
+#endif //REISER_RT_COMBGENERATOR_GAUSSIANDISTRIBUTOR_H
@@ -0,0 +1,47 @@
+// Created on 20261016
+
+#ifndef REISER_RT_COMBGENERATOR_PHILOX4X32_H
+#define REISER_RT_COMBGENERATOR_PHILOX4X32_H
+
+#include <cstdint>
+
+// The Philox4x32-10 counter based generator of Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3".
+// Its output is a pure function of a 128 bit counter and a 64 bit key, so any value of any stream may be drawn
+// independently, in any order. It is defined here, inline, so that batch loops over it may be vectorized.
+class Philox4x32
+{
+public:
+    struct Words
+    {
+        uint32_t w[4];
+    };
+
+    static Words generate( Words counter, uint32_t key0, uint32_t key1 )
+    {
+        for ( int round = 0; 10 != round; ++round )
+        {
+            const auto product0 = uint64_t( multiplier0 ) * counter.w[0];
+            const auto product1 = uint64_t( multiplier1 ) * counter.w[2];
+            counter = Words{ { uint32_t( product1 >> 32 ) ^ counter.w[1] ^ key0, uint32_t( product1 ),
+                               uint32_t( product0 >> 32 ) ^ counter.w[3] ^ key1, uint32_t( product0 ) } };
+            key0 += weyl0;
+            key1 += weyl1;
+        }
+        return counter;
+    }
+
+    // A uniform deviate in (0, 1] from the upper 53 bits of the first two words.
+    static double uniform( const Words & words )
+    {
+        const auto bits = ( uint64_t( words.w[0] ) << 32 ) | words.w[1];
+        return double( ( bits >> 11 ) + 1 ) / 9007199254740992.0;    // 2^53
+    }
+
+private:
+    static constexpr uint32_t multiplier0 = 0xD2511F53;
+    static constexpr uint32_t multiplier1 = 0xCD9E8D57;
+    static constexpr uint32_t weyl0 = 0x9E3779B9;
+    static constexpr uint32_t weyl1 = 0xBB67AE85;
+};
+
+#endif //REISER_RT_COMBGENERATOR_PHILOX4X32_H
@@ -1,7 +1,11 @@
 // Created on 20230103
 
 #include "RayleighDistributor.h"
+#include "Xoshiro256Engine.h"
+#include "Philox4x32.h"
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 
 class RayleighDistributor::Imple
@@ -12,33 +16,67 @@ private:
     using RandomNumberEngineType = std::mt19937;
     using GaussianDistribution = std::normal_distribution< double >;
 
-    Imple() = default;
+    Imple()
+    {
+        batchEngine.seed( std::random_device{}() );
+    }
+
     ~Imple() = default;
 
     void reset( uint32_t seed )
     {
         rndEngine.seed( seed );
+        batchEngine.seed( seed );
+        counterKey = seed;
     }
 
     double getValue( double desiredMean )
     {
         if ( desiredMean <= 0.0 ) return 0.0;
 
+        // The distribution stays at unit sigma and its values are scaled by sigma, as it would scale them
+        // itself, so it need not be parameterized for every value.
         const auto sigma = desiredMean / sqrtQtyPiOver2;
-
-        // We use sigma and not sigma^2 (variance) in the arguments below because the C++ standard
-        // for the normal (gaussian) distribution function requires sigma as input, not variance.
-        using ParamType = GaussianDistribution::param_type;
-        normalDistribution.param( ParamType{0.0, sigma } );
-        const auto X = normalDistribution(rndEngine );
-        const auto Y = normalDistribution(rndEngine );
+        const auto X = normalDistribution( rndEngine ) * sigma;
+        const auto Y = normalDistribution( rndEngine ) * sigma;
 
         return std::sqrt( X * X + Y * Y );
     }
 
+    void fill( double * pValues, size_t numValues, const double * pDesiredMeans )
+    {
+        // The magnitude of two independent normals of sigma is sigma * sqrt( -2 ln( U ) ), the Box-Muller radius,
+        // so no angle, and no second deviate, is required. Deviates are drawn in place, then transformed.
+        batchEngine.fillUniform( pValues, numValues );
+        for ( size_t i = 0; numValues != i; ++i )
+        {
+            const auto sigma = std::max( pDesiredMeans[i], 0.0 ) / sqrtQtyPiOver2;
+            pValues[i] = sigma * std::sqrt( -2.0 * std::log( pValues[i] ) );
+        }
+    }
+
+    void fill( double * pValues, size_t numValues, const double * pDesiredMeans,
+               uint64_t firstStream, uint64_t counter ) const
+    {
+        // The counter occupies the low words of the Philox counter and the stream the high words.
+        for ( size_t i = 0; numValues != i; ++i )
+        {
+            const auto stream = firstStream + i;
+            const auto words = Philox4x32::generate( Philox4x32::Words{ { uint32_t( counter ),
+                                                                          uint32_t( counter >> 32 ),
+                                                                          uint32_t( stream ),
+                                                                          uint32_t( stream >> 32 ) } },
+                                                     counterKey, 0 );
+            const auto sigma = std::max( pDesiredMeans[i], 0.0 ) / sqrtQtyPiOver2;
+            pValues[i] = sigma * std::sqrt( -2.0 * std::log( Philox4x32::uniform( words ) ) );
+        }
+    }
+
     const double sqrtQtyPiOver2{ std::sqrt( M_PI / 2.0 ) }; // Deliberately not static.
     RandomNumberEngineType rndEngine{std::random_device{}() };
-    GaussianDistribution normalDistribution{};  // Parameterized when utilized.
+    GaussianDistribution normalDistribution{};  // Unit sigma.
+    Xoshiro256Engine batchEngine{};             // Seeded by `reset`, or at random as `rndEngine` is.
+    uint32_t counterKey{};                      // The seed given to `reset`.
 };
 
 RayleighDistributor::RayleighDistributor()
@@ -60,3 +98,14 @@ double RayleighDistributor::getValue( double desiredMean )
 {
     return pImple->getValue( desiredMean);
 }
+
+void RayleighDistributor::fill( double * pValues, size_t numValues, const double * pDesiredMeans )
+{
+    pImple->fill( pValues, numValues, pDesiredMeans );
+}
+
+void RayleighDistributor::fill( double * pValues, size_t numValues, const double * pDesiredMeans,
+                                uint64_t firstStream, uint64_t counter ) const
+{
+    pImple->fill( pValues, numValues, pDesiredMeans, firstStream, counter );
+}
@@ -3,6 +3,7 @@
 #ifndef REISER_RT_COMBGENERATOR_RAYLEIGHDISTRIBUTOR_H
 #define REISER_RT_COMBGENERATOR_RAYLEIGHDISTRIBUTOR_H
 
+#include <cstddef>
 #include <cstdint>
 
 class RayleighDistributor
@@ -19,6 +20,17 @@ public:
 
     double getValue( double desiredMean );
 
+    // Rayleigh values for a series of means, a batch at a time. Values are drawn from interleaved xoshiro256+
+    // generators, seeded by `reset` as well, rather than from the generator of `getValue`. Each value is
+    // the Box-Muller radius of one uniform deviate, whatever its mean. The buffers may not overlap.
+    void fill( double * pValues, size_t numValues, const double * pDesiredMeans );
+
+    // Counter based Rayleigh values, value `i` drawn from stream `firstStream + i` at the counter. Each is
+    // a pure function of the seed given to `reset`, its stream and the counter, by Philox4x32-10, so values
+    // may be drawn in any order, by any thread, and draw the same. No generator state is advanced.
+    void fill( double * pValues, size_t numValues, const double * pDesiredMeans,
+               uint64_t firstStream, uint64_t counter ) const;
+
 private:
     Imple * pImple;    //!< Pointer to hidden implementation.
 };
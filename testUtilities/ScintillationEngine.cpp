@@ -7,32 +7,78 @@
 
 #include "ScintillationEngine.h"
 
-void ScintillationEngine::run( double * pBuffer,
-                               size_t runLen,
-                               const ScintillateFunkType & scintillateFunk,
-                               StateType & scintillationState,
-                               size_t sampleCounter,
-                               size_t decorrelationSamples )
+ScintillationEngine::ScintillationEngine( size_t maxHarmonics )
+  : magnitudes( maxHarmonics, 0.0 )
+  , nextMagnitudes( maxHarmonics, 0.0 )
+  , slopes( maxHarmonics, 0.0 )
 {
-    // Compute Scintillated Magnitude over the Buffer Length.
-    for ( size_t i = 0; i != runLen; ++i )
+}
+
+void ScintillationEngine::reset( size_t theDecorrelationSamples )
+{
+    decorrelationSamples = theDecorrelationSamples;
+}
+
+void ScintillationEngine::run( double * pBuffer, size_t harmonicStride, size_t sampleStride, size_t sampleCounter,
+                               size_t runLen, size_t firstHarmonic, size_t numHarmonics,
+                               const ScintillateFunkType & scintillateFunk )
+{
+    auto pMag = magnitudes.data() + firstHarmonic;
+    auto pNext = nextMagnitudes.data() + firstHarmonic;
+    auto pSlope = slopes.data() + firstHarmonic;
+
+    // The magnitudes of the boundaries either side of the interval the run begins in, drawn for every harmonic
+    // at once. Each slope is the change in magnitude per sample from one to the next.
+    auto boundaryIndex = sampleCounter / decorrelationSamples;
+    auto intervalStart = boundaryIndex * decorrelationSamples;
+    scintillateFunk( pMag, firstHarmonic, numHarmonics, boundaryIndex );
+    scintillateFunk( pNext, firstHarmonic, numHarmonics, boundaryIndex + 1 );
+    for ( size_t h = 0; numHarmonics != h; ++h )
+        pSlope[h] = ( pNext[h] - pMag[h] ) / double( decorrelationSamples );
+
+    // The run is ramped a segment at a time, a segment being the part of the run within one interval.
+    // Each sample is evaluated from its distance into the interval, so it is the same however runs fall.
+    for ( size_t offset = 0; runLen != offset; )
     {
-        // Set scintillation buffer magnitude value for sample i.
-        // This is the current magnitude value (first) plus the change in magnitude per sample (second).
-        // We conveniently update the magnitude while we are at it for the next iteration.
-        // On the initial sample of zero, the change in magnitude per sample is zero.
-        *pBuffer++ = scintillationState.first += scintillationState.second;
-
-        // If time to calculate a new scintillation slope
-        if ( 0 == (sampleCounter++ % decorrelationSamples ) )
+        const auto intoInterval = sampleCounter + offset - intervalStart;
+        const auto intervalRemaining = decorrelationSamples - intoInterval;
+        const auto segmentLen = intervalRemaining < runLen - offset ? intervalRemaining : runLen - offset;
+
+        // Contiguous envelopes are written innermost.
+        auto pSegment = pBuffer + offset * sampleStride;
+        if ( 1 == sampleStride )
+        {
+            for ( size_t h = 0; numHarmonics != h; ++h )
+            {
+                auto pOut = pSegment + h * harmonicStride;
+                const auto mag = pMag[h];
+                const auto slope = pSlope[h];
+                for ( size_t n = 0; segmentLen != n; ++n )
+                    pOut[n] = mag + slope * double( intoInterval + n );
+            }
+        }
+        else
         {
-            // Get a new scintillation target magnitude by invoking scintillateFunk observer.
-            auto scintillationTargetMag = scintillateFunk();
+            for ( size_t n = 0; segmentLen != n; ++n )
+            {
+                auto pOut = pSegment + n * sampleStride;
+                const auto steps = double( intoInterval + n );
+                for ( size_t h = 0; numHarmonics != h; ++h )
+                    pOut[ h * harmonicStride ] = pMag[h] + pSlope[h] * steps;
+            }
+        }
+        offset += segmentLen;
 
-            // Calculate the change in magnitude per sample and store as the second parameter for the line.
-            scintillationState.second = (scintillationTargetMag - scintillationState.first ) /
-                    double( decorrelationSamples );
+        // Moving into the next interval, its far boundary is drawn for every harmonic at once.
+        if ( segmentLen == intervalRemaining && runLen != offset )
+        {
+            ++boundaryIndex;
+            intervalStart += decorrelationSamples;
+            for ( size_t h = 0; numHarmonics != h; ++h )
+                pMag[h] = pNext[h];
+            scintillateFunk( pNext, firstHarmonic, numHarmonics, boundaryIndex + 1 );
+            for ( size_t h = 0; numHarmonics != h; ++h )
+                pSlope[h] = ( pNext[h] - pMag[h] ) / double( decorrelationSamples );
         }
     }
 }
-
@@ -4,24 +4,35 @@
 
 #include <cstdlib>
 #include <functional>
+#include <vector>
 
 class ScintillationEngine
 {
 public:
-    using StateType = std::pair< double, double >;
+    // Draws the scintillated magnitudes of a range of harmonics at a decorrelation boundary, the sample
+    // `boundaryIndex * decorrelationSamples`. They must be a pure function of harmonic and boundary index.
+    using ScintillateFunkType = std::function< void( double * pMagnitudes, size_t firstHarmonic, size_t numHarmonics,
+                                                     size_t boundaryIndex ) >;
 
-    using ScintillateFunkType = std::function< double() >;
-
-    ScintillationEngine() = default;
+    explicit ScintillationEngine( size_t maxHarmonics );
 
     ~ScintillationEngine() = default;
 
-    static void run( double * pBuffer,
-                     size_t runLen,
-                     const ScintillateFunkType & scintillateFunk,
-                     StateType & scintillationState,
-                     size_t sampleCounter,
-                     size_t decorrelationSamples );
+    void reset( size_t decorrelationSamples );
+
+    // Ramps a range of harmonics over `runLen` samples. The envelope of harmonic `h` at sample `n` of the run is
+    // written to `pBuffer[ h * harmonicStride + n * sampleStride ]`, with `h` counted from `firstHarmonic`.
+    // Either stride may be one, for harmonic major or sample major envelopes. Envelopes ramp linearly from
+    // one boundary's magnitudes to the next and are a pure function of harmonic and sample counter.
+    // Runs over different harmonic ranges may be invoked concurrently.
+    void run( double * pBuffer, size_t harmonicStride, size_t sampleStride, size_t sampleCounter, size_t runLen,
+              size_t firstHarmonic, size_t numHarmonics, const ScintillateFunkType & scintillateFunk );
+
+private:
+    std::vector< double > magnitudes;
+    std::vector< double > nextMagnitudes;
+    std::vector< double > slopes;
+    size_t decorrelationSamples{};
 };
 
 #endif //TSG_NG_SCINTILLATIONENGINE_H
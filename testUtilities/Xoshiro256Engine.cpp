@@ -0,0 +1,59 @@
+// Created on 20261016
+
+#include "Xoshiro256Engine.h"
+
+namespace
+{
+    uint64_t splitMix64( uint64_t & state )
+    {
+        auto z = ( state += 0x9E3779B97F4A7C15ULL );
+        z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+        z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+        return z ^ ( z >> 31 );
+    }
+}
+
+void Xoshiro256Engine::seed( uint32_t seed )
+{
+    uint64_t state = seed;
+    for ( size_t lane = 0; numLanes != lane; ++lane )
+    {
+        s0[ lane ] = splitMix64( state );
+        s1[ lane ] = splitMix64( state );
+        s2[ lane ] = splitMix64( state );
+        s3[ lane ] = splitMix64( state );
+    }
+}
+
+void Xoshiro256Engine::fillUniform( double * pValues, size_t numValues )
+{
+    size_t i = 0;
+    for ( ; numValues - i >= numLanes; i += numLanes )
+        next( pValues + i );
+
+    if ( numValues != i )
+    {
+        double group[ numLanes ];
+        next( group );
+        for ( size_t lane = 0; numValues != i; ++i, ++lane )
+            pValues[i] = group[ lane ];
+    }
+}
+
+void Xoshiro256Engine::next( double * pGroup )
+{
+    // The upper 53 bits of each result, offset by one, scaled into (0, 1]. Zero is excluded for the logarithms
+    // of Box-Muller transforms.
+    for ( size_t lane = 0; numLanes != lane; ++lane )
+    {
+        const auto result = s0[ lane ] + s3[ lane ];
+        const auto t = s1[ lane ] << 17;
+        s2[ lane ] ^= s0[ lane ];
+        s3[ lane ] ^= s1[ lane ];
+        s1[ lane ] ^= s2[ lane ];
+        s0[ lane ] ^= s3[ lane ];
+        s2[ lane ] ^= t;
+        s3[ lane ] = ( s3[ lane ] << 45 ) | ( s3[ lane ] >> 19 );
+        pGroup[ lane ] = double( ( result >> 11 ) + 1 ) / 9007199254740992.0;    // 2^53
+    }
+}
@@ -0,0 +1,36 @@
+// Created on 20261016
+
+#ifndef REISER_RT_COMBGENERATOR_XOSHIRO256ENGINE_H
+#define REISER_RT_COMBGENERATOR_XOSHIRO256ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Interleaved xoshiro256+ generators, one per lane, kept in a structure of arrays layout so that the lanes
+// advance together in vector registers. Uniform deviates are produced a lane group at a time.
+class Xoshiro256Engine
+{
+public:
+    static constexpr size_t numLanes = 4;
+
+    Xoshiro256Engine() = default;
+
+    ~Xoshiro256Engine() = default;
+
+    // The state of every lane is expanded from the seed by splitmix64.
+    void seed( uint32_t seed );
+
+    // Fills the buffer with uniform deviates in (0, 1]. A lane group is consumed per `numLanes` values,
+    // and the remainder of the last group is discarded.
+    void fillUniform( double * pValues, size_t numValues );
+
+private:
+    void next( double * pGroup );
+
+    uint64_t s0[ numLanes ]{};
+    uint64_t s1[ numLanes ]{};
+    uint64_t s2[ numLanes ]{};
+    uint64_t s3[ numLanes ]{};
+};
+
+#endif //REISER_RT_COMBGENERATOR_XOSHIRO256ENGINE_H
@@ -0,0 +1,130 @@
+/**
+ * @file HarmonicSeriesFixture.h
+ * @brief Reference Series and Comparisons Shared by the Test Harnesses
+ *
+ * Many harnesses compare CombGenerator output against a series of tones evaluated directly, sample by sample,
+ * with every phase computed from the sample index by PhaseArithmetic. This provides the scalar vectors they reset
+ * with, that direct sum, the comparison of output against it and the tolerances comparisons are held to.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#ifndef REISER_RT_HARMONICSERIESFIXTURE_H
+#define REISER_RT_HARMONICSERIESFIXTURE_H
+
+#include "CombGenerator.h"
+#include "PhaseArithmetic.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+namespace HarmonicSeriesFixture
+{
+    using namespace ReiserRT::Signal;
+
+    /**
+     * @brief The Tolerance of Output Against a Direct Sum
+     *
+     * Relative to the sum of the magnitudes. Recursive synthesis accumulates phase error over the thousands of
+     * samples a harness produces, while a direct sum, or a seek, computes each phase from the sample index.
+     * Output so computed differs from recursive output by well within this.
+     */
+    constexpr double directSumTolerance = 1e-10;
+
+    /**
+     * @brief The Tolerance of Output Against the Same Series Synthesized Otherwise
+     *
+     * Relative to the sum of the magnitudes. Such output differs only by the order of summation.
+     */
+    constexpr double summationTolerance = 1e-13;
+
+    /**
+     * @brief The Tolerance of Single Precision Output, Relative to the Sum of the Magnitudes
+     */
+    constexpr double singlePrecisionTolerance = 2e-6;
+
+    /**
+     * @brief Make a Vector of `scale / ( i + 1 ) + offset` for Each Index `i`
+     */
+    inline CombGeneratorScalarVectorType makeVector( size_t numValues, double scale, double offset )
+    {
+        std::unique_ptr< double[] > values{ new double[ numValues ] };
+        for ( size_t i = 0; numValues != i; ++i )
+            values[i] = scale / double( i + 1 ) + offset;
+        return CombGeneratorScalarVectorType{ std::move( values ) };
+    }
+
+    /**
+     * @brief The Sum of the Absolute Values of a Vector
+     */
+    inline double sumOf( const CombGeneratorScalarVectorType & vector, size_t numValues )
+    {
+        double sum = 0.0;
+        for ( size_t i = 0; numValues != i; ++i )
+            sum += std::abs( vector[i] );
+        return sum;
+    }
+
+    /**
+     * @brief The Sample of a Harmonic Series at a Sample Index, Summed Directly
+     *
+     * Empty magnitude and phase vectors are taken as unity and zero, as a `reset` takes them.
+     */
+    inline FlyingPhasorElementType directSample( size_t numHarmonics, double fundamentalRadiansPerSample,
+                                                 const CombGeneratorScalarVectorType & mags,
+                                                 const CombGeneratorScalarVectorType & phases, size_t sampleIndex )
+    {
+        FlyingPhasorElementType sample{};
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            sample += std::polar( mags ? mags[i] : 1.0,
+                                  PhaseArithmetic::phaseAt( phases ? phases[i] : 0.0,
+                                                            double( i + 1 ) * fundamentalRadiansPerSample,
+                                                            sampleIndex ) );
+        return sample;
+    }
+
+    /**
+     * @brief The Sample of a Tone Bank at a Sample Index, Summed Directly
+     */
+    inline FlyingPhasorElementType directSample( size_t numTones, const CombGeneratorScalarVectorType & rates,
+                                                 const CombGeneratorScalarVectorType & mags,
+                                                 const CombGeneratorScalarVectorType & phases, size_t sampleIndex )
+    {
+        FlyingPhasorElementType sample{};
+        for ( size_t i = 0; numTones != i; ++i )
+            sample += std::polar( mags[i], PhaseArithmetic::phaseAt( phases[i], rates[i], sampleIndex ) );
+        return sample;
+    }
+
+    /**
+     * @brief Compare Samples Against Those Expected
+     *
+     * @param pSamples The samples, the first of which is at `firstSample`.
+     * @param firstSample The sample index of the first sample.
+     * @param count The number of samples.
+     * @param expectedFunk Returns the sample expected at a sample index.
+     * @param maxDelta The largest delta accepted, a tolerance times the sum of the magnitudes.
+     * @param pTestName The name reported on failure.
+     * @return True if every delta is within `maxDelta`.
+     */
+    template< typename ExpectedFunkType >
+    bool compareToExpected( const FlyingPhasorElementType * pSamples, size_t firstSample, size_t count,
+                            ExpectedFunkType expectedFunk, double maxDelta, const char * pTestName )
+    {
+        for ( size_t n = 0; count != n; ++n )
+        {
+            const auto delta = std::abs( pSamples[n] - expectedFunk( firstSample + n ) );
+            if ( maxDelta < delta )
+            {
+                std::cout << "Failed " << pTestName << " at sample index " << firstSample + n << " with a delta of "
+                          << delta << "." << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+#endif //REISER_RT_HARMONICSERIESFIXTURE_H
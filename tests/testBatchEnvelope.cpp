@@ -0,0 +1,228 @@
+/**
+ * @file testBatchEnvelope.cpp
+ * @brief Test Harness for Batch Envelope Functors
+ *
+ * Output of a CombGenerator reset with a batch envelope functor is compared against that of one reset with
+ * the equivalent per harmonic envelope functor. Envelopes are a pure function of harmonic and sample count,
+ * so both forms apply identical envelopes, and the delta must be within a few units of rounding relative to
+ * the sum of the harmonic magnitudes. We also verify how, and how often, the batch functor is invoked.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    double envelopeValue( size_t nHarmonic, size_t sampleCount )
+    {
+        return 0.75 + 0.25 * std::cos( 1e-3 * double( nHarmonic + 1 ) * double( sampleCount ) );
+    }
+
+    // The per harmonic form, with a buffer per harmonic so that it may be invoked concurrently.
+    class PerHarmonicEnvelope
+    {
+    public:
+        PerHarmonicEnvelope( size_t maxHarmonics, size_t maxSamples )
+          : buffers( maxHarmonics, std::vector< double >( maxSamples ) )
+        {
+        }
+
+        const double * operator()( size_t currentSample, size_t numSamples, size_t nHarmonic, double )
+        {
+            auto & buffer = buffers[ nHarmonic ];
+            for ( size_t i = 0; numSamples != i; ++i )
+                buffer[i] = envelopeValue( nHarmonic, currentSample + i );
+            return buffer.data();
+        }
+
+        std::vector< std::vector< double > > buffers;
+    };
+
+    // The batch form, recording its invocations and any violation of the documented contract.
+    class BatchEnvelope
+    {
+    public:
+        explicit BatchEnvelope( size_t theNumHarmonics ) : numHarmonics{ theNumHarmonics } {}
+
+        void operator()( size_t currentSample, size_t numSamples, size_t firstHarmonic, size_t numRangeHarmonics,
+                         double * pEnvelopeMatrix, size_t stride )
+        {
+            ++numInvocations;
+            if ( !numSamples || combGeneratorBatchEnvelopeBlockSamples < numSamples ||
+                 numHarmonics < firstHarmonic + numRangeHarmonics || stride < numRangeHarmonics ||
+                 0 != reinterpret_cast< uintptr_t >( pEnvelopeMatrix - firstHarmonic ) % 64 || 0 != stride % 8 )
+                contractViolated = true;
+
+            for ( size_t n = 0; numSamples != n; ++n )
+                for ( size_t h = 0; numRangeHarmonics != h; ++h )
+                    pEnvelopeMatrix[ n * stride + h ] = envelopeValue( firstHarmonic + h, currentSample + n );
+        }
+
+        const size_t numHarmonics;
+        std::atomic< size_t > numInvocations{};
+        std::atomic< bool > contractViolated{};
+    };
+
+    int testAgainstPerHarmonic( CombGeneratorEngineType engineType, size_t numHarmonics, size_t numThreads,
+                                bool accumulate, int failCode )
+    {
+        const double fundamentalRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * 1.0137;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 );
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+
+        constexpr size_t maxChunkSize = 5000;
+        PerHarmonicEnvelope referenceEnvelope{ numHarmonics, maxChunkSize };
+        BatchEnvelope batchEnvelope{ numHarmonics };
+
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        CombGenerator batchGenerator{ numHarmonics, engineType, numThreads, 1000 };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases,
+                                  std::ref( referenceEnvelope ) );
+        batchGenerator.resetWithBatchEnvelope( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes,
+                                               sharedPhases, std::ref( batchEnvelope ) );
+
+        // Chunk sizes span several envelope blocks, exactly one, and less than one.
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > batchBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        size_t expectedInvocations = 0;
+        for ( size_t chunkSize : { size_t( 5000 ), size_t( 300 ), size_t( 256 ), size_t( 3 ) } )
+        {
+            if ( accumulate )
+            {
+                for ( size_t i = 0; chunkSize != i; ++i )
+                    referenceBuffer[i] = batchBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                referenceGenerator.accumSamples( referenceBuffer.get(), chunkSize );
+                batchGenerator.accumSamples( batchBuffer.get(), chunkSize );
+            }
+            else
+            {
+                referenceGenerator.getSamples( referenceBuffer.get(), chunkSize );
+                batchGenerator.getSamples( batchBuffer.get(), chunkSize );
+            }
+            expectedInvocations += ( chunkSize + combGeneratorBatchEnvelopeBlockSamples - 1 ) /
+                                   combGeneratorBatchEnvelopeBlockSamples;
+
+            for ( size_t i = 0; chunkSize != i; ++i )
+            {
+                const auto delta = std::abs( referenceBuffer[i] - batchBuffer[i] );
+                if ( summationTolerance * sumOfMagnitudes < delta )
+                {
+                    std::cout << "Failed Batch Envelope Test at chunk sample index " << i << " with a delta of "
+                              << delta << "." << std::endl;
+                    return failCode;
+                }
+            }
+        }
+
+        if ( batchEnvelope.contractViolated )
+        {
+            std::cout << "Failed batch envelope functor invocation contract." << std::endl;
+            return failCode;
+        }
+
+        // Without partitioning, the functor is invoked once per envelope block for the whole harmonic range.
+        if ( 1 == numThreads && expectedInvocations != batchEnvelope.numInvocations )
+        {
+            std::cout << "Failed batch envelope functor invocation count with " << batchEnvelope.numInvocations
+                      << "." << std::endl;
+            return failCode;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - The fused kernel engine, `getSamples`. The harmonic count is not a multiple of the lane width.
+    int testResult = testAgainstPerHarmonic( CombGeneratorEngineType::FusedKernel, 37, 1, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - The phasor bank engine, `accumSamples`.
+    testResult = testAgainstPerHarmonic( CombGeneratorEngineType::PhasorBank, 12, 1, true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - The fused kernel engine, harmonic partitioned over several threads.
+    testResult = testAgainstPerHarmonic( CombGeneratorEngineType::FusedKernel, 100, 3, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - The phasor bank engine, harmonic partitioned over several threads.
+    testResult = testAgainstPerHarmonic( CombGeneratorEngineType::PhasorBank, 13, 4, false, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - Single precision samples follow the double precision samples.
+    {
+        constexpr size_t numHarmonics = 24;
+        constexpr size_t numSamples = 1000;
+        BatchEnvelope doubleEnvelope{ numHarmonics };
+        BatchEnvelope singleEnvelope{ numHarmonics };
+        CombGenerator doubleGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        CombGenerator singleGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        doubleGenerator.resetWithBatchEnvelope( numHarmonics, M_PI / 64.0, nullptr, nullptr, std::ref( doubleEnvelope ) );
+        singleGenerator.resetWithBatchEnvelope( numHarmonics, M_PI / 64.0, nullptr, nullptr, std::ref( singleEnvelope ) );
+
+        std::unique_ptr< FlyingPhasorElementType[] > doubleBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< CombGeneratorSingleElementType[] > singleBuffer{ new CombGeneratorSingleElementType[ numSamples ] };
+        doubleGenerator.getSamples( doubleBuffer.get(), numSamples );
+        singleGenerator.getSamples( singleBuffer.get(), numSamples );
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            const FlyingPhasorElementType single{ singleBuffer[i].real(), singleBuffer[i].imag() };
+            if ( singlePrecisionTolerance * double( numHarmonics ) < std::abs( single - doubleBuffer[i] ) )
+            {
+                std::cout << "Failed Single Precision Batch Envelope Test at sample index " << i << "." << std::endl;
+                return 5;
+            }
+        }
+    }
+
+    // Test 6 - Engine selection. The closed form engine rejects a batch envelope functor, others defer.
+    {
+        BatchEnvelope batchEnvelope{ 8 };
+        CombGenerator closedForm{ 8, CombGeneratorEngineType::ClosedForm };
+        bool threw = false;
+        try { closedForm.resetWithBatchEnvelope( 8, M_PI / 64.0, nullptr, nullptr, std::ref( batchEnvelope ) ); }
+        catch ( const std::invalid_argument & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a batch envelope functor for the ClosedForm engine." << std::endl;
+            return 6;
+        }
+
+        for ( auto engineType : { CombGeneratorEngineType::Automatic, CombGeneratorEngineType::InverseFft } )
+        {
+            CombGenerator combGenerator{ 8, engineType };
+            combGenerator.resetWithBatchEnvelope( 8, M_PI / 64.0, nullptr, nullptr, std::ref( batchEnvelope ) );
+            if ( CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+            {
+                std::cout << "Failed engine selection with a batch envelope functor." << std::endl;
+                return 6;
+            }
+        }
+    }
+
+    return 0;
+}
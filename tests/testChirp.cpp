@@ -0,0 +1,270 @@
+/**
+ * @file testChirp.cpp
+ * @brief Test Harness for Chirped Harmonic Series
+ *
+ * Every harmonic of a chirped CombGenerator must follow k times the analytic chirp phase, continuously across
+ * `getSamples` invocations of irregular size and across the anchor points synthesis re-anchors its phases at.
+ * We also verify batch envelopes, harmonic partitioned synthesis, seeking, single precision samples, cloning and
+ * the engines and operations which reject chirps. Chirp phases at sample indices beyond 2^32 must agree with a
+ * reference formed in integer arithmetic, and a chirp sought there must continue from them.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+#include "PhaseArithmetic.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 21;
+    constexpr size_t numSamples = 5000;
+    constexpr CombGeneratorChirpType linearChirp{ 0.01, 1e-6, 0.0 };
+    constexpr CombGeneratorChirpType quadraticChirp{ 0.012, -4e-7, 2e-10 };
+
+    // The gain of a slow fade, applied by the batch envelope test.
+    double fadeGain( size_t sampleIndex )
+    {
+        return 1.0 - double( sampleIndex ) / double( 2 * numSamples );
+    }
+
+    // The analytic sample at a sample index, each harmonic at k times the chirp, optionally faded.
+    FlyingPhasorElementType expectedSample( const CombGeneratorChirpType & chirp,
+                                            const CombGeneratorScalarVectorType & mags,
+                                            const CombGeneratorScalarVectorType & phases,
+                                            size_t sampleIndex, bool faded )
+    {
+        FlyingPhasorElementType sample{};
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            const auto k = double( i + 1 );
+            const auto phase = PhaseArithmetic::chirpPhaseAt( phases[i], k * chirp.startRadiansPerSample,
+                                                              k * chirp.linearSweep, k * chirp.quadraticSweep,
+                                                              sampleIndex );
+            sample += std::polar( faded ? fadeGain( sampleIndex ) : mags[i], phase );
+        }
+        return sample;
+    }
+
+    bool compareToChirp( const FlyingPhasorElementType * pSamples, size_t firstSample, size_t count,
+                         const CombGeneratorChirpType & chirp, const CombGeneratorScalarVectorType & mags,
+                         const CombGeneratorScalarVectorType & phases, bool faded, double sumOfMagnitudes,
+                         const char * pTestName )
+    {
+        return compareToExpected( pSamples, firstSample, count,
+                                  [ & ]( size_t sampleIndex )
+                                  {
+                                      return expectedSample( chirp, mags, phases, sampleIndex, faded );
+                                  },
+                                  directSumTolerance * sumOfMagnitudes, pTestName );
+    }
+
+    // The phase of a chirp whose rates are the high part of two pi over powers of two, so exact as doubles.
+    // The fractional revolutions of each term are formed exactly, in integer arithmetic modulo 2^64, from
+    // the sums of the sample indices and of their squares. Whole revolutions of the high part of two pi fall
+    // short of whole turns by the low part, which is applied to the approximate revolutions.
+    long double referenceChirpPhase( double phase0, unsigned startShift, unsigned linearShift,
+                                     unsigned quadraticShift, size_t sampleIndex )
+    {
+        uint64_t f1 = sampleIndex;
+        uint64_t f2 = sampleIndex - 1;
+        uint64_t f3 = 2 * sampleIndex - 1;
+        if ( 0 == f1 % 2 ) f1 /= 2;
+        else f2 /= 2;
+        const uint64_t sumOfIndices = f1 * f2;
+        if ( 0 == f1 % 3 ) f1 /= 3;
+        else if ( 0 == f2 % 3 ) f2 /= 3;
+        else f3 /= 3;
+        const uint64_t sumOfSquares = f1 * f2 * f3;
+
+        auto fraction = []( uint64_t sum, unsigned shift )
+        {
+            const auto mask = 64 == shift ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << shift ) - 1;
+            return std::ldexp( static_cast< long double >( sum & mask ), -int( shift ) );
+        };
+        const auto fractional = fraction( sampleIndex, startShift ) + fraction( sumOfIndices, linearShift ) +
+                                fraction( sumOfSquares, quadraticShift );
+        const auto revolutions = std::ldexp( static_cast< long double >( sampleIndex ), -int( startShift ) ) +
+                                 std::ldexp( static_cast< long double >( f1 ) * f2 * f3, -int( quadraticShift ) ) +
+                                 std::ldexp( ( static_cast< long double >( sampleIndex ) - 1 ) * sampleIndex / 2,
+                                             -int( linearShift ) );
+        return phase0 + PhaseArithmetic::twoPiHigh * fractional -
+               PhaseArithmetic::twoPiLow * ( revolutions - fractional );
+    }
+
+    // Samples are requested in irregular chunks, straddling anchor points.
+    int testChirp( const CombGeneratorChirpType & chirp, CombGeneratorEngineType engineType, size_t numThreads,
+                   bool faded, int failCode )
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+
+        // The batch envelope fades every harmonic alike, in place of its magnitude.
+        auto fadeEnvelope = []( size_t currentSample, size_t blockSamples, size_t, size_t numRangeHarmonics,
+                                double * pMatrix, size_t stride )
+        {
+            for ( size_t n = 0; blockSamples != n; ++n )
+                for ( size_t h = 0; numRangeHarmonics != h; ++h )
+                    pMatrix[ n * stride + h ] = fadeGain( currentSample + n );
+        };
+
+        CombGenerator combGenerator{ numHarmonics, engineType, numThreads, 100 };
+        combGenerator.resetWithChirp( numHarmonics, chirp, mags, phases,
+                                      faded ? CombGeneratorBatchEnvelopeFunkType{ fadeEnvelope }
+                                            : CombGeneratorBatchEnvelopeFunkType{} );
+        if ( CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed active engine type query for a chirp." << std::endl;
+            return failCode;
+        }
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        size_t offset = 0;
+        for ( size_t chunkSize : { size_t( 1 ), size_t( 255 ), size_t( 300 ), size_t( 3 ), size_t( 4441 ) } )
+        {
+            combGenerator.getSamples( buffer.get() + offset, chunkSize );
+            offset += chunkSize;
+        }
+
+        if ( !compareToChirp( buffer.get(), 0, numSamples, chirp, mags, phases, faded, sumOf( mags, numHarmonics ),
+                              "Chirp Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - A linear chirp.
+    int testResult = testChirp( linearChirp, CombGeneratorEngineType::FusedKernel, 1, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - A quadratic chirp, through the Automatic engine type.
+    testResult = testChirp( quadraticChirp, CombGeneratorEngineType::Automatic, 1, false, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - A quadratic chirp with a batch envelope.
+    testResult = testChirp( quadraticChirp, CombGeneratorEngineType::FusedKernel, 1, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Harmonic partitioned synthesis, with and without a batch envelope.
+    testResult = testChirp( quadraticChirp, CombGeneratorEngineType::FusedKernel, 3, false, 4 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testChirp( linearChirp, CombGeneratorEngineType::InverseFft, 3, true, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - Seeking, single precision samples and cloning continue the chirp.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.resetWithChirp( numHarmonics, quadraticChirp, mags, phases );
+        combGenerator.seekTo( 3333 );
+        FlyingPhasorElementType samples[ 100 ];
+        combGenerator.getSamples( samples, 100 );
+        if ( !compareToChirp( samples, 3333, 100, quadraticChirp, mags, phases, false, sumOf( mags, numHarmonics ),
+                              "Chirp Seek Test" ) )
+            return 5;
+
+        CombGeneratorSingleElementType singleSamples[ 100 ];
+        combGenerator.getSamples( singleSamples, 100 );
+        for ( size_t i = 0; 100 != i; ++i )
+            samples[i] = FlyingPhasorElementType{ singleSamples[i].real(), singleSamples[i].imag() };
+        if ( !compareToExpected( samples, 3433, 100,
+                                 [ & ]( size_t sampleIndex )
+                                 {
+                                     return expectedSample( quadraticChirp, mags, phases, sampleIndex, false );
+                                 },
+                                 singlePrecisionTolerance * sumOf( mags, numHarmonics ),
+                                 "Chirp Single Precision Test" ) )
+            return 5;
+
+        auto clonedGenerator = combGenerator.clone();
+        clonedGenerator.getSamples( samples, 100 );
+        if ( !compareToChirp( samples, 3533, 100, quadraticChirp, mags, phases, false, sumOf( mags, numHarmonics ),
+                              "Chirp Clone Test" ) )
+            return 5;
+    }
+
+    // Test 6 - Engines unable to chirp reject chirps, and a chirp may not be retuned.
+    {
+        for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::ClosedForm } )
+        {
+            CombGenerator combGenerator{ numHarmonics, engineType };
+            bool threw = false;
+            try { combGenerator.resetWithChirp( numHarmonics, linearChirp, nullptr, nullptr ); }
+            catch ( const std::invalid_argument & ) { threw = true; }
+            if ( !threw )
+            {
+                std::cout << "Failed to reject a chirp for engine type " << int( engineType ) << "." << std::endl;
+                return 6;
+            }
+        }
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.resetWithChirp( numHarmonics, linearChirp, nullptr, nullptr );
+        bool threw = false;
+        try { combGenerator.retune( 0.02 ); }
+        catch ( const std::logic_error & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a retune of a chirp." << std::endl;
+            return 6;
+        }
+    }
+
+    // Test 7 - Chirp phases at sample indices beyond 2^32, where the sums of the sample indices and of their
+    // squares exceed 64 bits, against a reference formed in integer arithmetic.
+    {
+        constexpr unsigned startShift = 4;
+        constexpr unsigned linearShift = 38;
+        constexpr unsigned quadraticShift = 64;
+        const auto twoPi = static_cast< long double >( PhaseArithmetic::twoPiHigh ) + PhaseArithmetic::twoPiLow;
+        for ( size_t sampleIndex : { size_t( 1 ), size_t( 4096 ), size_t( 4294967297 ), size_t( 10000012345 ),
+                                     size_t( 30000000007 ) } )
+        {
+            const auto phase = PhaseArithmetic::chirpPhaseAt( 0.25, std::ldexp( PhaseArithmetic::twoPiHigh,
+                                                                                -int( startShift ) ),
+                                                              std::ldexp( PhaseArithmetic::twoPiHigh,
+                                                                          -int( linearShift ) ),
+                                                              std::ldexp( PhaseArithmetic::twoPiHigh,
+                                                                          -int( quadraticShift ) ),
+                                                              sampleIndex );
+            const auto reference = referenceChirpPhase( 0.25, startShift, linearShift, quadraticShift, sampleIndex );
+            const auto delta = std::abs( std::remainder( phase - reference, twoPi ) );
+            if ( 1e-12 < delta )
+            {
+                std::cout << "Failed Chirp Phase Test at sample index " << sampleIndex << " with a delta of "
+                          << double( delta ) << "." << std::endl;
+                return 7;
+            }
+        }
+
+        // A chirp sought beyond 2^32 samples is anchored to the phases so computed. Its rates are powers of two,
+        // so every harmonic's rates are exact multiples of them and the harmonic phases compared are exact too.
+        const CombGeneratorChirpType slowChirp{ std::ldexp( 1.0, -7 ), std::ldexp( 1.0, -40 ), std::ldexp( 1.0, -77 ) };
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.resetWithChirp( numHarmonics, slowChirp, mags, phases );
+        combGenerator.seekTo( 10000012345 );
+        FlyingPhasorElementType samples[ 600 ];
+        combGenerator.getSamples( samples, 600 );
+        if ( !compareToChirp( samples, 10000012345, 600, slowChirp, mags, phases, false, sumOf( mags, numHarmonics ),
+                              "Chirp Long Seek Test" ) )
+            return 7;
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file testClosedFormEngine.cpp
+ * @brief Test Harness for the Closed Form Geometric Series Engine
+ *
+ * The closed form engine must agree with the default ReiserRT_FlyingPhasor bank engine within the
+ * tolerance documented by CombGeneratorEngineType for combs of equal magnitudes and linear phases.
+ * We also verify that automatic engine selection detects such combs, falls back to the fused kernel
+ * engine otherwise and that an explicitly constructed closed form engine rejects what it cannot do.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+
+#include <memory>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t maxHarmonics = 240;
+    constexpr size_t numHarmonics = 237;
+    constexpr size_t maxEpochSize = 4096;
+    constexpr size_t totalSamples = size_t( 1 ) << 16;
+    constexpr double fundamentalRadiansPerSample = M_PI / 256.0;
+    constexpr double magnitude = 0.5;
+
+    // Chunk sizes cycled through. These cross the engine re-anchoring interval in various ways.
+    constexpr size_t chunkSizes[] = { 4096, 1, 1023, 1024, 1025, 1000, 4095, 2 };
+
+    CombGeneratorScalarVectorType makeMagnitudes()
+    {
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            magnitudes[i] = magnitude;
+        return CombGeneratorScalarVectorType{ std::move( magnitudes ) };
+    }
+
+    CombGeneratorScalarVectorType makeLinearPhases()
+    {
+        // Linear in harmonic number but, wrapped into [-pi, pi) as a client would likely provide them.
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            phases[i] = std::fmod( 0.3 + double( i ) * 2.1, 2.0 * M_PI ) - M_PI;
+        return CombGeneratorScalarVectorType{ std::move( phases ) };
+    }
+
+    int compareEngines( const CombGeneratorScalarVectorType & magnitudes, const CombGeneratorScalarVectorType & phases,
+                        bool accumulate, int failCode )
+    {
+        CombGenerator referenceGenerator{ maxHarmonics };
+        CombGenerator closedFormGenerator{ maxHarmonics, CombGeneratorEngineType::ClosedForm };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, phases );
+        closedFormGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, phases );
+        if ( CombGeneratorEngineType::ClosedForm != closedFormGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed active engine type query." << std::endl;
+            return failCode;
+        }
+
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ maxEpochSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > closedFormBuffer{ new FlyingPhasorElementType[ maxEpochSize ] };
+
+        const auto tolerance = 1e-10 * double( numHarmonics ) * ( magnitudes ? magnitude : 1.0 );
+        size_t sampleIndex = 0;
+        for ( size_t chunk = 0; totalSamples > sampleIndex; ++chunk )
+        {
+            const auto numSamples = chunkSizes[ chunk % ( sizeof( chunkSizes ) / sizeof( chunkSizes[0] ) ) ];
+            if ( accumulate )
+            {
+                for ( size_t i = 0; numSamples != i; ++i )
+                    referenceBuffer[i] = closedFormBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                referenceGenerator.accumSamples( referenceBuffer.get(), numSamples );
+                closedFormGenerator.accumSamples( closedFormBuffer.get(), numSamples );
+            }
+            else
+            {
+                referenceGenerator.getSamples( referenceBuffer.get(), numSamples );
+                closedFormGenerator.getSamples( closedFormBuffer.get(), numSamples );
+            }
+
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                const auto delta = std::abs( referenceBuffer[i] - closedFormBuffer[i] );
+                if ( tolerance < delta )
+                {
+                    std::cout << "Failed engine comparison at sample index " << sampleIndex + i
+                              << " with a delta of " << delta << "." << std::endl;
+                    return failCode;
+                }
+            }
+            sampleIndex += numSamples;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Default magnitudes and phases. Every harmonic is in phase at sample zero,
+    // which exercises the singularity guard.
+    int testResult = compareEngines( nullptr, nullptr, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - Equal magnitudes and linear phases, `getSamples`.
+    auto magnitudes = makeMagnitudes();
+    auto phases = makeLinearPhases();
+    testResult = compareEngines( magnitudes, phases, false, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - Equal magnitudes and linear phases, `accumSamples`.
+    testResult = compareEngines( magnitudes, phases, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Automatic selection detects a geometric series and falls back when not.
+    {
+        CombGenerator combGenerator{ maxHarmonics, CombGeneratorEngineType::Automatic };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, phases );
+        if ( CombGeneratorEngineType::ClosedForm != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed to select the ClosedForm engine for a geometric series." << std::endl;
+            return 4;
+        }
+
+        std::unique_ptr< double[] > unequal{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            unequal[i] = 1.0 / double( i + 1 );
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample,
+                             CombGeneratorScalarVectorType{ std::move( unequal ) }, phases );
+        if ( CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed to fall back to the FusedKernel engine for unequal magnitudes." << std::endl;
+            return 4;
+        }
+
+        auto envelopeFunk = []( size_t, size_t, size_t, double ) { return static_cast< const double * >( nullptr ); };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, phases, envelopeFunk );
+        if ( CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed to fall back to the FusedKernel engine with an envelope functor." << std::endl;
+            return 4;
+        }
+
+        combGenerator.reset();
+        if ( CombGeneratorEngineType::Automatic != combGenerator.getEngineType() ||
+             CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed engine type queries after a pure reset." << std::endl;
+            return 4;
+        }
+    }
+
+    // Test 5 - An explicitly constructed ClosedForm engine throws for non linear phases.
+    {
+        CombGenerator combGenerator{ maxHarmonics, CombGeneratorEngineType::ClosedForm };
+        std::unique_ptr< double[] > quadratic{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            quadratic[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI );
+        bool threw = false;
+        try
+        {
+            combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes,
+                                 CombGeneratorScalarVectorType{ std::move( quadratic ) } );
+        }
+        catch ( const std::invalid_argument & )
+        {
+            threw = true;
+        }
+        if ( !threw )
+        {
+            std::cout << "Failed to throw for non linear phases." << std::endl;
+            return 5;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file testCombGeneratorBank.cpp
+ * @brief Test Harness for the Comb Generator Bank
+ *
+ * Output of a CombGeneratorBank is compared against that of identical generators accumulated one after the other,
+ * on the invoking thread. Each generator advances identically either way. Only the order of summation differs,
+ * so the delta must be within a few units of rounding, relative to the sum of all harmonic magnitudes.
+ * We also verify that results are deterministic and that misuse is reported.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGeneratorBank.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    // Generators vary in harmonic count, and so in cost, leaving work to be stolen.
+    size_t numHarmonicsOf( size_t g ) { return 1 + ( g * 37 ) % 61; }
+
+    // Every third generator is assigned to the second output, if there is one.
+    size_t outputOf( size_t g, size_t numOutputs ) { return 1 < numOutputs && 0 == g % 3 ? 1 : 0; }
+
+    CombGenerator makeGenerator( size_t g, double & sumOfMagnitudes )
+    {
+        const auto numHarmonics = numHarmonicsOf( g );
+        const double fundamentalRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * ( 1.0 + 1e-3 * double( g ) );
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 + g );
+            phases[i] = std::fmod( double( i * i + g ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+
+        const auto engineType = g % 2 ? CombGeneratorEngineType::FusedKernel : CombGeneratorEngineType::PhasorBank;
+        CombGenerator combGenerator{ numHarmonics, engineType };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample,
+                             CombGeneratorScalarVectorType{ std::move( magnitudes ) },
+                             CombGeneratorScalarVectorType{ std::move( phases ) } );
+        return combGenerator;
+    }
+
+    int testAgainstSequential( size_t numGenerators, size_t numOutputs, size_t numThreads, size_t maxBatchSamples,
+                               int failCode )
+    {
+        double sumOfMagnitudes = 0.0;
+        std::vector< CombGenerator > referenceGenerators{};
+        CombGeneratorBank bank{ numThreads, numOutputs, maxBatchSamples };
+        for ( size_t g = 0; numGenerators != g; ++g )
+        {
+            double unused = 0.0;
+            referenceGenerators.emplace_back( makeGenerator( g, sumOfMagnitudes ) );
+            if ( g != bank.addGenerator( makeGenerator( g, unused ), outputOf( g, numOutputs ) ) )
+            {
+                std::cout << "Failed generator index returned by addGenerator." << std::endl;
+                return failCode;
+            }
+        }
+        if ( numGenerators != bank.getNumGenerators() || numOutputs != bank.getNumOutputs() ||
+             numThreads != bank.getNumThreads() )
+        {
+            std::cout << "Failed bank queries." << std::endl;
+            return failCode;
+        }
+
+        // Chunk sizes are not multiples of the batch size. Buffers are initialized to verify accumulation.
+        constexpr size_t maxChunkSize = 10000;
+        std::vector< std::unique_ptr< FlyingPhasorElementType[] > > referenceBuffers{};
+        std::vector< std::unique_ptr< FlyingPhasorElementType[] > > bankBuffers{};
+        std::vector< FlyingPhasorElementBufferTypePtr > pBankBuffers{};
+        for ( size_t o = 0; numOutputs != o; ++o )
+        {
+            referenceBuffers.emplace_back( new FlyingPhasorElementType[ maxChunkSize ] );
+            bankBuffers.emplace_back( new FlyingPhasorElementType[ maxChunkSize ] );
+            pBankBuffers.push_back( bankBuffers.back().get() );
+        }
+
+        for ( size_t chunkSize : { size_t( 10000 ), size_t( 4097 ), size_t( 3 ) } )
+        {
+            for ( size_t o = 0; numOutputs != o; ++o )
+                for ( size_t i = 0; chunkSize != i; ++i )
+                    referenceBuffers[o][i] = bankBuffers[o][i] = FlyingPhasorElementType{ 1.0, double( o ) };
+
+            for ( size_t g = 0; numGenerators != g; ++g )
+                referenceGenerators[g].accumSamples( referenceBuffers[ outputOf( g, numOutputs ) ].get(), chunkSize );
+            bank.accumSamples( pBankBuffers.data(), chunkSize );
+
+            for ( size_t o = 0; numOutputs != o; ++o )
+            {
+                for ( size_t i = 0; chunkSize != i; ++i )
+                {
+                    const auto delta = std::abs( referenceBuffers[o][i] - bankBuffers[o][i] );
+                    if ( summationTolerance * sumOfMagnitudes < delta )
+                    {
+                        std::cout << "Failed Comb Generator Bank Test for output " << o << " at chunk sample index "
+                                  << i << " with a delta of " << delta << "." << std::endl;
+                        return failCode;
+                    }
+                }
+            }
+        }
+
+        for ( size_t g = 0; numGenerators != g; ++g )
+        {
+            if ( referenceGenerators[g].getSampleCount() != bank.getGenerator( g ).getSampleCount() )
+            {
+                std::cout << "Failed sample count of generator " << g << "." << std::endl;
+                return failCode;
+            }
+        }
+
+        const auto timing = bank.getLastBatchTiming();
+        if ( !timing.numTasks || numThreads * CombGeneratorBank::tasksPerThread + numOutputs < timing.numTasks ||
+             timing.numTasks < timing.numSteals || timing.totalSeconds < timing.synthesisSeconds )
+        {
+            std::cout << "Failed batch timing with " << timing.numTasks << " tasks and " << timing.numSteals
+                      << " steals." << std::endl;
+            return failCode;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Two outputs, four threads and several batches per chunk.
+    int testResult = testAgainstSequential( 23, 2, 4, 4096, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - One output, one thread.
+    testResult = testAgainstSequential( 7, 1, 1, 1000, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - Fewer generators than tasks, and more threads than generators.
+    testResult = testAgainstSequential( 3, 2, 8, 2048, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Results are deterministic, bit for bit, from run to run.
+    {
+        constexpr size_t numGenerators = 19;
+        constexpr size_t numSamples = 10000;
+        std::unique_ptr< FlyingPhasorElementType[] > firstBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< FlyingPhasorElementType[] > secondBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        for ( auto pBuffer : { firstBuffer.get(), secondBuffer.get() } )
+        {
+            double unused = 0.0;
+            CombGeneratorBank bank{ 4 };
+            for ( size_t g = 0; numGenerators != g; ++g )
+                bank.addGenerator( makeGenerator( g, unused ) );
+            for ( size_t i = 0; numSamples != i; ++i )
+                pBuffer[i] = FlyingPhasorElementType{};
+            bank.accumSamples( pBuffer, numSamples );
+        }
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( firstBuffer[i] != secondBuffer[i] )
+            {
+                std::cout << "Failed Determinism Test at sample index " << i << "." << std::endl;
+                return 4;
+            }
+        }
+    }
+
+    // Test 5 - Misuse is reported and outputs without generators are untouched.
+    {
+        double unused = 0.0;
+        CombGeneratorBank bank{ 2, 3 };
+        bool threw = false;
+        try { bank.addGenerator( makeGenerator( 0, unused ), 3 ); }
+        catch ( const std::out_of_range & ) { threw = true; }
+        if ( !threw || 0 != bank.getNumGenerators() )
+        {
+            std::cout << "Failed to reject an invalid output index." << std::endl;
+            return 5;
+        }
+
+        constexpr size_t numSamples = 100;
+        FlyingPhasorElementType buffers[3][ numSamples ]{};
+        threw = false;
+        try { bank.accumSamples( buffers[0], numSamples ); }
+        catch ( const std::invalid_argument & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a single output buffer for a bank of three outputs." << std::endl;
+            return 5;
+        }
+
+        bank.addGenerator( makeGenerator( 0, unused ), 0 );
+        bank.addGenerator( makeGenerator( 1, unused ), 2 );
+        const FlyingPhasorElementBufferTypePtr pBuffers[3]{ buffers[0], buffers[1], buffers[2] };
+        bank.accumSamples( pBuffers, numSamples );
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( FlyingPhasorElementType{} != buffers[1][i] || FlyingPhasorElementType{} == buffers[2][i] )
+            {
+                std::cout << "Failed output assignment at sample index " << i << "." << std::endl;
+                return 5;
+            }
+        }
+    }
+
+    // Test 6 - An exception thrown by one generator's envelope functor propagates and nothing of the failed
+    // batch is reduced onto the outputs. The bank is usable again once the generator is reset.
+    {
+        constexpr size_t numGenerators = 11;
+        constexpr size_t numSamples = 1000;
+        double unused = 0.0;
+        CombGeneratorBank bank{ 4, 2 };
+        for ( size_t g = 0; numGenerators != g; ++g )
+            bank.addGenerator( makeGenerator( g, unused ), outputOf( g, 2 ) );
+
+        auto throwingFunk = []( size_t, size_t, size_t, double ) -> const double *
+        {
+            throw std::runtime_error{ "Envelope Failure" };
+        };
+        const auto numHarmonics = numHarmonicsOf( 5 );
+        bank.getGenerator( 5 ).reset( numHarmonics, M_PI / double( 2 * numHarmonics + 3 ), nullptr, nullptr,
+                                      throwingFunk );
+
+        const FlyingPhasorElementType initialValue{ 1.0, -1.0 };
+        FlyingPhasorElementType buffers[2][ numSamples ]{};
+        for ( auto & buffer : buffers )
+            for ( auto & sample : buffer ) sample = initialValue;
+        const FlyingPhasorElementBufferTypePtr pBuffers[2]{ buffers[0], buffers[1] };
+        bool threw = false;
+        try { bank.accumSamples( pBuffers, numSamples ); }
+        catch ( const std::runtime_error & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to propagate an envelope functor exception." << std::endl;
+            return 6;
+        }
+        for ( auto & buffer : buffers )
+        {
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                if ( initialValue != buffer[i] )
+                {
+                    std::cout << "Failed Exception Test, a failed batch was reduced at sample index " << i << "."
+                              << std::endl;
+                    return 6;
+                }
+            }
+        }
+
+        bank.getGenerator( 5 ).reset( numHarmonics, M_PI / double( 2 * numHarmonics + 3 ), nullptr, nullptr );
+        bank.accumSamples( pBuffers, numSamples );
+        if ( numSamples != bank.getGenerator( 5 ).getSampleCount() || initialValue == buffers[1][0] )
+        {
+            std::cout << "Failed Exception Test, the bank was not usable after reset." << std::endl;
+            return 6;
+        }
+    }
+
+    return 0;
+}
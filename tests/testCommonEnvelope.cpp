@@ -0,0 +1,233 @@
+/**
+ * @file testCommonEnvelope.cpp
+ * @brief Test Harness for Common Envelope Functors
+ *
+ * A common envelope functor must scale the whole comb, every harmonic at its constant magnitude, by the one envelope
+ * it returns. The functor mutes the comb for one `getSamples` invocation, during which getting samples must write
+ * exact zeros and accumulating samples must leave the buffer as it is. Every engine, harmonic partitioned
+ * synthesis, single precision samples, gating and cloning are exercised, as is the number of functor invocations.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 19;
+    constexpr size_t numSamples = 5000;
+    constexpr size_t muteBegin = 1000;
+    constexpr size_t muteEnd = 1500;
+    constexpr double fundamentalRadiansPerSample = 0.0171;
+    constexpr FlyingPhasorElementType garbage{ 1234.0, -5678.0 };
+
+    // Chunk sizes begin and end a `getSamples` invocation at either end of the muted samples.
+    constexpr size_t chunkSizes[] = { 1, 999, 500, 2500, 1000 };
+
+    double envelopeValue( size_t sampleCount )
+    {
+        return 0.6 + 0.4 * std::cos( 3e-3 * double( sampleCount ) );
+    }
+
+    bool mutedAt( size_t sampleCount )
+    {
+        return muteBegin <= sampleCount && sampleCount < muteEnd;
+    }
+
+    // A functor of the common envelope, muting the comb for the invocation at the start of the muted samples.
+    class CommonEnvelope
+    {
+    public:
+        explicit CommonEnvelope( size_t maxSamples ) : buffer( maxSamples ) {}
+
+        const double * operator()( size_t currentSample, size_t blockSamples )
+        {
+            ++numInvocations;
+            if ( mutedAt( currentSample ) ) return nullptr;
+            for ( size_t n = 0; blockSamples != n; ++n )
+                buffer[n] = envelopeValue( currentSample + n );
+            return buffer.data();
+        }
+
+        std::vector< double > buffer;
+        size_t numInvocations{};
+    };
+
+    FlyingPhasorElementType expectedSample( const CombGeneratorScalarVectorType & mags,
+                                            const CombGeneratorScalarVectorType & phases, size_t sampleIndex )
+    {
+        return envelopeValue( sampleIndex ) *
+               directSample( numHarmonics, fundamentalRadiansPerSample, mags, phases, sampleIndex );
+    }
+
+    // Muted samples must be exactly those the buffer held.
+    bool compareToEnvelope( const FlyingPhasorElementType * pSamples, size_t firstSample, size_t count,
+                            const CombGeneratorScalarVectorType & mags, const CombGeneratorScalarVectorType & phases,
+                            bool accumulated, double tolerance, const char * pTestName )
+    {
+        const auto base = accumulated ? garbage : FlyingPhasorElementType{};
+        for ( size_t n = 0; count != n; ++n )
+        {
+            if ( mutedAt( firstSample + n ) && base != pSamples[n] )
+            {
+                std::cout << "Failed " << pTestName << " muted at sample index " << firstSample + n << "."
+                          << std::endl;
+                return false;
+            }
+        }
+
+        return compareToExpected( pSamples, firstSample, count,
+                                  [ & ]( size_t sampleIndex )
+                                  {
+                                      const auto muted = mutedAt( sampleIndex );
+                                      return muted ? base : base + expectedSample( mags, phases, sampleIndex );
+                                  },
+                                  tolerance * sumOf( mags, numHarmonics ), pTestName );
+    }
+
+    int testCommonEnvelope( CombGeneratorEngineType engineType, size_t numThreads, bool accumulate, int failCode )
+    {
+        // Equal magnitudes and linear phases are accepted by the closed form engine.
+        const auto closedForm = CombGeneratorEngineType::ClosedForm == engineType;
+        const auto mags = closedForm ? makeVector( numHarmonics, 0.0, 1.5 ) : makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = closedForm ? makeVector( numHarmonics, 0.0, 0.25 ) : makeVector( numHarmonics, 2.0, -1.0 );
+
+        CommonEnvelope commonEnvelope{ numSamples };
+        CombGenerator combGenerator{ numHarmonics, engineType, numThreads, 100 };
+        combGenerator.resetWithCommonEnvelope( numHarmonics, fundamentalRadiansPerSample, mags, phases,
+                                               std::ref( commonEnvelope ) );
+        if ( engineType != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed engine selection with a common envelope functor." << std::endl;
+            return failCode;
+        }
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        for ( size_t n = 0; numSamples != n; ++n )
+            buffer[n] = garbage;
+        size_t offset = 0;
+        for ( auto chunkSize : chunkSizes )
+        {
+            if ( accumulate )
+                combGenerator.accumSamples( buffer.get() + offset, chunkSize );
+            else
+                combGenerator.getSamples( buffer.get() + offset, chunkSize );
+            offset += chunkSize;
+        }
+
+        // Invoked once per `getSamples` invocation, rather than once per harmonic.
+        if ( sizeof( chunkSizes ) / sizeof( chunkSizes[0] ) != commonEnvelope.numInvocations )
+        {
+            std::cout << "Failed common envelope functor invocation count with " << commonEnvelope.numInvocations
+                      << "." << std::endl;
+            return failCode;
+        }
+
+        if ( !compareToEnvelope( buffer.get(), 0, numSamples, mags, phases, accumulate, directSumTolerance,
+                                 "Common Envelope Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Getting samples, for every engine.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel,
+                              CombGeneratorEngineType::ClosedForm, CombGeneratorEngineType::InverseFft } )
+    {
+        int testResult = testCommonEnvelope( engineType, 1, false, 1 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 2 - Accumulating samples, for every engine.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel,
+                              CombGeneratorEngineType::ClosedForm, CombGeneratorEngineType::InverseFft } )
+    {
+        int testResult = testCommonEnvelope( engineType, 1, true, 2 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 3 - Harmonic partitioned synthesis.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testCommonEnvelope( engineType, 3, false, 3 );
+        if ( 0 != testResult ) return testResult;
+        testResult = testCommonEnvelope( engineType, 3, true, 3 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 4 - Single precision samples, got and accumulated.
+    for ( auto accumulate : { false, true } )
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        CommonEnvelope commonEnvelope{ numSamples };
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.resetWithCommonEnvelope( numHarmonics, fundamentalRadiansPerSample, mags, phases,
+                                               std::ref( commonEnvelope ) );
+        const CombGeneratorSingleElementType singleGarbage{ float( garbage.real() ), float( garbage.imag() ) };
+        std::unique_ptr< CombGeneratorSingleElementType[] > buffer{ new CombGeneratorSingleElementType[ numSamples ] };
+        for ( size_t n = 0; numSamples != n; ++n )
+            buffer[n] = singleGarbage;
+        size_t offset = 0;
+        for ( auto chunkSize : chunkSizes )
+        {
+            if ( accumulate )
+                combGenerator.accumSamples( buffer.get() + offset, chunkSize );
+            else
+                combGenerator.getSamples( buffer.get() + offset, chunkSize );
+            offset += chunkSize;
+        }
+
+        std::vector< FlyingPhasorElementType > samples( numSamples );
+        for ( size_t n = 0; numSamples != n; ++n )
+            samples[n] = buffer[n] == singleGarbage ? garbage :
+                         FlyingPhasorElementType{ buffer[n].real(), buffer[n].imag() };
+        const auto tolerance = accumulate ? 1e-4 : singlePrecisionTolerance;
+        if ( !compareToEnvelope( samples.data(), 0, numSamples, mags, phases, accumulate, tolerance,
+                                 "Common Envelope Single Precision Test" ) )
+            return 4;
+    }
+
+    // Test 5 - The functor is not invoked while the gate is off. Clones take the functor.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        CommonEnvelope commonEnvelope{ numSamples };
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.setGate( CombGeneratorGateType{ 500, 100, 2000 } );
+        combGenerator.resetWithCommonEnvelope( numHarmonics, fundamentalRadiansPerSample, mags, phases,
+                                               std::ref( commonEnvelope ) );
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), 3000 );
+        if ( 2 != commonEnvelope.numInvocations )
+        {
+            std::cout << "Failed Common Envelope Gate Test with " << commonEnvelope.numInvocations
+                      << " invocations." << std::endl;
+            return 5;
+        }
+
+        auto clonedGenerator = combGenerator.clone();
+        clonedGenerator.clearGate();
+        clonedGenerator.getSamples( buffer.get(), 500 );
+        if ( 3 != commonEnvelope.numInvocations ||
+             !compareToEnvelope( buffer.get(), 3000, 500, mags, phases, false, directSumTolerance,
+                                 "Common Envelope Clone Test" ) )
+            return 5;
+    }
+
+    return 0;
+}
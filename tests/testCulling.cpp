@@ -0,0 +1,316 @@
+/**
+ * @file testCulling.cpp
+ * @brief Test Harness for Culling of Zero Magnitude and Above Nyquist Harmonics
+ *
+ * Culling zero magnitude and above Nyquist harmonics must not change the output, other than to drop harmonics at
+ * or beyond Nyquist when culling them is enabled. Output must match the harmonics not culled summed directly, and
+ * the number of active harmonics reported must be the number not culled. We also verify that envelope functors and
+ * crossfades prevent compaction, that published magnitudes and retunes cull anew and that a clone culls as the
+ * original does.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+#include "PhaseArithmetic.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 24;
+    constexpr size_t numSamples = 2000;
+
+    // An odd only comb, as for a square wave. Even harmonics have zero magnitude.
+    CombGeneratorScalarVectorType makeOddMagnitudes()
+    {
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            magnitudes[i] = ( i & 0x1 ) ? 0.0 : 1.0 / double( i + 1 );
+        return CombGeneratorScalarVectorType{ std::move( magnitudes ) };
+    }
+
+    CombGeneratorScalarVectorType makeMagnitudes()
+    {
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            magnitudes[i] = 2.0 / double( i + 2 );
+        return CombGeneratorScalarVectorType{ std::move( magnitudes ) };
+    }
+
+    CombGeneratorScalarVectorType makePhases()
+    {
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+        return CombGeneratorScalarVectorType{ std::move( phases ) };
+    }
+
+    // Harmonics at or beyond Nyquist are left out of the expected samples when culled.
+    bool compareToSeries( const FlyingPhasorElementType * pSamples, size_t firstSample, size_t count,
+                          double fundamentalRadiansPerSample, const CombGeneratorScalarVectorType & mags,
+                          const CombGeneratorScalarVectorType & phases, bool nyquistCulled, const char * pTestName )
+    {
+        auto numExpected = numHarmonics;
+        while ( nyquistCulled && M_PI <= double( numExpected ) * fundamentalRadiansPerSample )
+            --numExpected;
+        return compareToExpected( pSamples, firstSample, count,
+                                  [ & ]( size_t sampleIndex )
+                                  {
+                                      return directSample( numExpected, fundamentalRadiansPerSample, mags, phases,
+                                                           sampleIndex );
+                                  },
+                                  directSumTolerance * sumOf( mags, numHarmonics ), pTestName );
+    }
+
+    bool checkActive( const CombGenerator & combGenerator, size_t expected, const char * pTestName )
+    {
+        if ( expected != combGenerator.getNumActiveHarmonics() )
+        {
+            std::cout << "Failed " << pTestName << " with " << combGenerator.getNumActiveHarmonics()
+                      << " active harmonics where " << expected << " were expected." << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // Zero magnitude harmonics are culled from the odd only comb.
+    int testZeroMagnitude( CombGeneratorEngineType engineType, size_t numThreads, int failCode )
+    {
+        constexpr double fundamentalRadiansPerSample = 0.0371;
+        const auto mags = makeOddMagnitudes();
+        const auto phases = makePhases();
+
+        CombGenerator combGenerator{ numHarmonics, engineType, numThreads, 100 };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        if ( !checkActive( combGenerator, numHarmonics / 2, "Zero Magnitude Test" ) )
+            return failCode;
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), 333 );
+        combGenerator.getSamples( buffer.get() + 333, numSamples - 333 );
+        if ( !compareToSeries( buffer.get(), 0, numSamples, fundamentalRadiansPerSample, mags, phases, false,
+                               "Zero Magnitude Test" ) )
+            return failCode;
+
+        // Seeking moves only the active harmonics, which is all that is needed.
+        combGenerator.seekTo( 54321 );
+        combGenerator.getSamples( buffer.get(), 100 );
+        if ( !compareToSeries( buffer.get(), 54321, 100, fundamentalRadiansPerSample, mags, phases, false,
+                               "Zero Magnitude Seek Test" ) )
+            return failCode;
+
+        return 0;
+    }
+
+    // Harmonics at or beyond Nyquist are culled when enabled.
+    int testNyquist( CombGeneratorEngineType engineType, int failCode )
+    {
+        // Harmonics 1 through 17 are below Nyquist.
+        constexpr double fundamentalRadiansPerSample = M_PI / 17.5;
+        const auto mags = makeMagnitudes();
+        const auto phases = makePhases();
+
+        CombGenerator combGenerator{ numHarmonics, engineType };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        if ( !checkActive( combGenerator, numHarmonics, "Nyquist Disabled Test" ) )
+            return failCode;
+
+        combGenerator.setNyquistCulling( true );
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        if ( !checkActive( combGenerator, 17, "Nyquist Test" ) )
+            return failCode;
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), numSamples );
+        if ( !compareToSeries( buffer.get(), 0, numSamples, fundamentalRadiansPerSample, mags, phases, true,
+                               "Nyquist Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Zero magnitude harmonics.
+    int testResult = testZeroMagnitude( CombGeneratorEngineType::PhasorBank, 1, 1 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testZeroMagnitude( CombGeneratorEngineType::FusedKernel, 1, 1 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testZeroMagnitude( CombGeneratorEngineType::Automatic, 1, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - Zero magnitude harmonics with harmonic partitioned synthesis.
+    testResult = testZeroMagnitude( CombGeneratorEngineType::PhasorBank, 3, 2 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testZeroMagnitude( CombGeneratorEngineType::FusedKernel, 3, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - Nyquist culling, including engines culling only from the end of the series.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel,
+                              CombGeneratorEngineType::InverseFft } )
+    {
+        testResult = testNyquist( engineType, 3 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 4 - An envelope functor replaces the magnitudes. Zero magnitude harmonics are not culled.
+    {
+        const auto mags = makeOddMagnitudes();
+        std::vector< double > envelope( numSamples, 0.5 );
+        auto envelopeFunk = [ &envelope ]( size_t, size_t, size_t, double )
+        {
+            return static_cast< const double * >( envelope.data() );
+        };
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, 0.0371, mags, nullptr, envelopeFunk );
+        if ( !checkActive( combGenerator, numHarmonics, "Envelope Test" ) )
+            return 4;
+    }
+
+    // Test 5 - Published magnitudes are not culled, so a zero magnitude leaves its harmonic active. The first
+    // publication after a `reset` reinstates harmonics culled by it. A crossfade reinstates every harmonic.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        constexpr double fundamentalRadiansPerSample = 0.0213;
+        const auto oddMags = makeOddMagnitudes();
+        const auto mags = makeMagnitudes();
+        const auto phases = makePhases();
+
+        CombGenerator combGenerator{ numHarmonics, engineType };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        if ( !checkActive( combGenerator, numHarmonics, "Publish Test" ) )
+            return 5;
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), 500 );
+        combGenerator.publishParameters( oddMags, nullptr );
+        combGenerator.getSamples( buffer.get(), 500 );
+        if ( !checkActive( combGenerator, numHarmonics, "Publish Test" ) ||
+             !compareToSeries( buffer.get(), 500, 500, fundamentalRadiansPerSample, oddMags, phases, false,
+                               "Publish Test" ) )
+            return 5;
+
+        combGenerator.publishParameters( mags, nullptr );
+        combGenerator.getSamples( buffer.get(), 500 );
+        if ( !checkActive( combGenerator, numHarmonics, "Publish Test" ) ||
+             !compareToSeries( buffer.get(), 1000, 500, fundamentalRadiansPerSample, mags, phases, false,
+                               "Publish Test" ) )
+            return 5;
+
+        // Culled by a `reset`, then reinstated by a publication and not culled again by the next.
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, oddMags, phases );
+        combGenerator.seekTo( 1500 );
+        combGenerator.publishParameters( mags, nullptr );
+        combGenerator.getSamples( buffer.get(), 100 );
+        if ( !checkActive( combGenerator, numHarmonics, "Reinstate Test" ) ||
+             !compareToSeries( buffer.get(), 1500, 100, fundamentalRadiansPerSample, mags, phases, false,
+                               "Reinstate Test" ) )
+            return 5;
+        combGenerator.publishParameters( oddMags, nullptr );
+        combGenerator.getSamples( buffer.get(), 1 );
+        if ( !checkActive( combGenerator, numHarmonics, "Reinstate Test" ) )
+            return 5;
+
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, oddMags, phases );
+        combGenerator.seekTo( 1501 );
+        combGenerator.publishParameters( mags, nullptr, 100 );
+        combGenerator.getSamples( buffer.get(), 1 );
+        if ( !checkActive( combGenerator, numHarmonics, "Crossfade Test" ) )
+            return 5;
+        combGenerator.getSamples( buffer.get(), 200 );
+        if ( !compareToSeries( buffer.get() + 100, 1602, 100, fundamentalRadiansPerSample, mags, phases, false,
+                               "Crossfade Test" ) )
+            return 5;
+    }
+
+    // Test 6 - A retune culls anew, as does a clone.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        constexpr size_t retuneSample = 700;
+        constexpr double oldRadiansPerSample = M_PI / 20.5;
+        constexpr double newRadiansPerSample = M_PI / 12.5;
+        const auto mags = makeOddMagnitudes();
+        const auto phases = makePhases();
+
+        CombGenerator combGenerator{ numHarmonics, engineType };
+        combGenerator.setNyquistCulling( true );
+        combGenerator.reset( numHarmonics, oldRadiansPerSample, mags, phases );
+        if ( !checkActive( combGenerator, 10, "Retune Test" ) )
+            return 6;
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), retuneSample );
+        combGenerator.retune( newRadiansPerSample );
+        if ( !checkActive( combGenerator, 6, "Retune Test" ) )
+            return 6;
+        combGenerator.getSamples( buffer.get(), numSamples );
+
+        // The reference continues each harmonic from its phase at the retune sample.
+        std::unique_ptr< double[] > retunedPhases{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            retunedPhases[i] = PhaseArithmetic::retunedPhase( phases[i], double( i + 1 ) * oldRadiansPerSample,
+                                                              double( i + 1 ) * newRadiansPerSample, retuneSample );
+        const CombGeneratorScalarVectorType referencePhases{ std::move( retunedPhases ) };
+        if ( !compareToSeries( buffer.get(), retuneSample, numSamples, newRadiansPerSample, mags, referencePhases,
+                               true, "Retune Test" ) )
+            return 6;
+
+        auto clonedGenerator = combGenerator.clone();
+        if ( !clonedGenerator.getNyquistCulling() || !checkActive( clonedGenerator, 6, "Clone Test" ) )
+            return 6;
+        clonedGenerator.getSamples( buffer.get(), 100 );
+        if ( !compareToSeries( buffer.get(), retuneSample + numSamples, 100, newRadiansPerSample, mags,
+                               referencePhases, true, "Clone Test" ) )
+            return 6;
+    }
+
+    // Test 7 - A tone bank is compacted about tones beyond Nyquist, unless an envelope functor is registered.
+    {
+        std::unique_ptr< double[] > rateValues{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            rateValues[i] = ( 2 != i % 3 ) ? 0.01 * double( i + 1 ) : -3.5;
+        const CombGeneratorScalarVectorType rates{ std::move( rateValues ) };
+        const auto mags = makeMagnitudes();
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.setNyquistCulling( true );
+        combGenerator.reset( numHarmonics, rates, mags, nullptr );
+        if ( !checkActive( combGenerator, numHarmonics - numHarmonics / 3, "Tone Bank Test" ) )
+            return 7;
+
+        FlyingPhasorElementType samples[ 100 ];
+        combGenerator.getSamples( samples, 100 );
+        auto expectedFunk = [ & ]( size_t sampleIndex )
+        {
+            FlyingPhasorElementType expected{};
+            for ( size_t i = 0; numHarmonics != i; ++i )
+                if ( 2 != i % 3 )
+                    expected += std::polar( mags[i], PhaseArithmetic::phaseAt( 0.0, rates[i], sampleIndex ) );
+            return expected;
+        };
+        if ( !compareToExpected( samples, 0, 100, expectedFunk, directSumTolerance * sumOf( mags, numHarmonics ),
+                                 "Tone Bank Test" ) )
+            return 7;
+
+        std::vector< double > envelope( numSamples, 1.0 );
+        auto envelopeFunk = [ &envelope ]( size_t, size_t, size_t, double )
+        {
+            return static_cast< const double * >( envelope.data() );
+        };
+        combGenerator.reset( numHarmonics, rates, mags, nullptr, envelopeFunk );
+        if ( !checkActive( combGenerator, numHarmonics - 1, "Tone Bank Envelope Test" ) )
+            return 7;
+    }
+
+    return 0;
+}
@@ -0,0 +1,288 @@
+/**
+ * @file testEnableHarmonic.cpp
+ * @brief Test Harness for Enabling and Disabling Individual Harmonics
+ *
+ * Harmonics are disabled, enabled anew and added beyond the number of harmonics part way through a series, without
+ * a `reset`. Every harmonic, whenever enabled, must be at the phase its starting phase gives it, and harmonics not
+ * acted upon must keep their running phases. Harmonic partitioned synthesis, culled tones,
+ * single precision samples and cloning are exercised, as is the rejection of invalid operations. A disabled
+ * harmonic must be silent under an envelope functor that ignores the nominal magnitudes passed to it.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+#include "PhaseArithmetic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t maxHarmonics = 16;
+    constexpr size_t numHarmonics = 8;
+    constexpr size_t numSamples = 2800;
+    constexpr size_t changeSamples[] = { 700, 1400, 2100 };
+    constexpr double fundamentalRadiansPerSample = 0.0277;
+
+    // The magnitude and starting phase of every harmonic, from each change on.
+    struct Series
+    {
+        std::vector< double > mags = std::vector< double >( maxHarmonics );
+        std::vector< double > phases = std::vector< double >( maxHarmonics );
+        double sumOfMagnitudes{};
+    };
+
+    // Harmonic 2 is disabled at the first change. Harmonic 10 is enabled at the second, extending the series.
+    // Harmonic 2 is enabled at the third, at a new magnitude and starting phase.
+    std::vector< Series > makeSeries( const CombGeneratorScalarVectorType & mags,
+                                      const CombGeneratorScalarVectorType & phases )
+    {
+        std::vector< Series > series( 4 );
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            series[0].mags[i] = mags ? mags[i] : 1.0;
+            series[0].phases[i] = phases[i];
+        }
+        series[1] = series[0];
+        series[1].mags[2] = 0.0;
+        series[2] = series[1];
+        series[2].mags[10] = 0.7;
+        series[2].phases[10] = 0.3;
+        series[3] = series[2];
+        series[3].mags[2] = 1.9;
+        series[3].phases[2] = -0.4;
+        for ( auto & entry : series )
+            for ( auto mag : entry.mags )
+                entry.sumOfMagnitudes += std::abs( mag );
+        return series;
+    }
+
+    void applyChange( CombGenerator & combGenerator, size_t change )
+    {
+        if ( 0 == change )
+            combGenerator.disableHarmonic( 2 );
+        else if ( 1 == change )
+            combGenerator.enableHarmonic( 10, 0.7, 0.3 );
+        else
+            combGenerator.enableHarmonic( 2, 1.9, -0.4 );
+    }
+
+    FlyingPhasorElementType expectedSample( const Series & series, size_t sampleIndex )
+    {
+        FlyingPhasorElementType sample{};
+        for ( size_t i = 0; maxHarmonics != i; ++i )
+        {
+            const auto rate = double( i + 1 ) * fundamentalRadiansPerSample;
+            sample += std::polar( series.mags[i], PhaseArithmetic::phaseAt( series.phases[i], rate, sampleIndex ) );
+        }
+        return sample;
+    }
+
+    // Each span between changes is held to the sum of the magnitudes of its own series.
+    bool compareToSeries( const FlyingPhasorElementType * pSamples, const std::vector< Series > & series,
+                          size_t firstSample, size_t count, double tolerance, const char * pTestName )
+    {
+        for ( size_t n = 0; count != n; )
+        {
+            const auto nextChange = std::upper_bound( std::begin( changeSamples ), std::end( changeSamples ),
+                                                      firstSample + n );
+            const auto & entry = series[ size_t( nextChange - std::begin( changeSamples ) ) ];
+            auto spanEnd = firstSample + count;
+            if ( std::end( changeSamples ) != nextChange && *nextChange < spanEnd )
+                spanEnd = *nextChange;
+
+            if ( !compareToExpected( pSamples + n, firstSample + n, spanEnd - firstSample - n,
+                                     [ &entry ]( size_t sampleIndex ) { return expectedSample( entry, sampleIndex ); },
+                                     tolerance * entry.sumOfMagnitudes, pTestName ) )
+                return false;
+            n = spanEnd - firstSample;
+        }
+        return true;
+    }
+
+    int testEnable( CombGeneratorEngineType engineType, size_t numThreads, const CombGeneratorScalarVectorType & mags,
+                    int failCode )
+    {
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        const auto series = makeSeries( mags, phases );
+
+        CombGenerator combGenerator{ maxHarmonics, engineType, numThreads, 100 };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        size_t offset = 0;
+        for ( size_t change = 0; 3 != change; ++change )
+        {
+            combGenerator.getSamples( buffer.get() + offset, changeSamples[ change ] - offset );
+            offset = changeSamples[ change ];
+            applyChange( combGenerator, change );
+        }
+        combGenerator.getSamples( buffer.get() + offset, numSamples - offset );
+
+        if ( 11 != combGenerator.getNumHarmonics() )
+        {
+            std::cout << "Failed Enable Harmonic Test with " << combGenerator.getNumHarmonics() << " harmonics."
+                      << std::endl;
+            return failCode;
+        }
+
+        if ( !compareToSeries( buffer.get(), series, 0, numSamples, directSumTolerance, "Enable Harmonic Test" ) )
+            return failCode;
+
+        // A clone continues the series as it now is.
+        auto clonedGenerator = combGenerator.clone();
+        FlyingPhasorElementType samples[ 100 ];
+        clonedGenerator.getSamples( samples, 100 );
+        if ( !compareToSeries( samples, series, numSamples, 100, directSumTolerance, "Enable Harmonic Clone Test" ) )
+            return failCode;
+
+        return 0;
+    }
+
+    int testEnableWithEnvelope( CombGeneratorEngineType engineType, size_t numThreads, int failCode )
+    {
+        // The envelope functor delivers unit envelopes throughout, ignoring the nominal magnitudes passed to it.
+        // Harmonics enabled are therefore at unit magnitude, whatever magnitude they are enabled at.
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        auto series = makeSeries( CombGeneratorScalarVectorType{}, phases );
+        for ( auto & entry : series )
+        {
+            entry.sumOfMagnitudes = 0.0;
+            for ( auto & mag : entry.mags )
+            {
+                mag = 0.0 == mag ? 0.0 : 1.0;
+                entry.sumOfMagnitudes += mag;
+            }
+        }
+        const std::vector< double > unitEnvelope( numSamples, 1.0 );
+
+        CombGenerator combGenerator{ maxHarmonics, engineType, numThreads, 100 };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, phases,
+                             [ &unitEnvelope ]( size_t, size_t, size_t, double ) { return unitEnvelope.data(); } );
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        size_t offset = 0;
+        for ( size_t change = 0; 3 != change; ++change )
+        {
+            combGenerator.getSamples( buffer.get() + offset, changeSamples[ change ] - offset );
+            offset = changeSamples[ change ];
+            applyChange( combGenerator, change );
+        }
+        combGenerator.getSamples( buffer.get() + offset, numSamples - offset );
+
+        if ( !compareToSeries( buffer.get(), series, 0, numSamples, directSumTolerance,
+                               "Enable Harmonic Envelope Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Enabling and disabling harmonics.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testEnable( engineType, 1, makeVector( numHarmonics, 1.0, 0.0 ), 1 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 2 - Harmonic partitioned synthesis, with unity magnitudes to begin with.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testEnable( engineType, 3, CombGeneratorScalarVectorType{}, 2 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 3 - Culled tones, which require the engine to be reset.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        std::unique_ptr< double[] > magValues{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            magValues[i] = 4 == i ? 0.0 : 1.0 / double( i + 1 );
+        int testResult = testEnable( engineType, 1, CombGeneratorScalarVectorType{ std::move( magValues ) }, 3 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 4 - Single precision samples.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        const auto series = makeSeries( mags, phases );
+        CombGenerator combGenerator{ maxHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+
+        std::unique_ptr< CombGeneratorSingleElementType[] > buffer{ new CombGeneratorSingleElementType[ numSamples ] };
+        size_t offset = 0;
+        for ( size_t change = 0; 3 != change; ++change )
+        {
+            combGenerator.getSamples( buffer.get() + offset, changeSamples[ change ] - offset );
+            offset = changeSamples[ change ];
+            applyChange( combGenerator, change );
+        }
+        combGenerator.getSamples( buffer.get() + offset, numSamples - offset );
+
+        std::vector< FlyingPhasorElementType > samples( numSamples );
+        for ( size_t n = 0; numSamples != n; ++n )
+            samples[n] = FlyingPhasorElementType{ buffer[n].real(), buffer[n].imag() };
+        if ( !compareToSeries( samples.data(), series, 0, numSamples, singlePrecisionTolerance,
+                               "Enable Harmonic Single Precision Test" ) )
+            return 4;
+    }
+
+    // Test 5 - Invalid operations are rejected.
+    {
+        CombGenerator combGenerator{ maxHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, nullptr );
+        bool threwMax = false;
+        try { combGenerator.enableHarmonic( maxHarmonics, 1.0, 0.0 ); }
+        catch ( const std::length_error & ) { threwMax = true; }
+        bool threwDisable = false;
+        try { combGenerator.disableHarmonic( numHarmonics ); }
+        catch ( const std::invalid_argument & ) { threwDisable = true; }
+
+        combGenerator.reset( numHarmonics, 0.001, 0.01, nullptr, nullptr );
+        bool threwToneBank = false;
+        try { combGenerator.enableHarmonic( numHarmonics, 1.0, 0.0 ); }
+        catch ( const std::logic_error & ) { threwToneBank = true; }
+
+        combGenerator.resetWithChirp( numHarmonics, CombGeneratorChirpType{ 0.01, 1e-6, 0.0 }, nullptr, nullptr );
+        bool threwChirp = false;
+        try { combGenerator.enableHarmonic( 0, 1.0, 0.0 ); }
+        catch ( const std::logic_error & ) { threwChirp = true; }
+
+        CombGenerator closedFormGenerator{ maxHarmonics, CombGeneratorEngineType::ClosedForm };
+        closedFormGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, nullptr );
+        bool threwEngine = false;
+        try { closedFormGenerator.disableHarmonic( 0 ); }
+        catch ( const std::logic_error & ) { threwEngine = true; }
+
+        if ( !threwMax || !threwDisable || !threwToneBank || !threwChirp || !threwEngine )
+        {
+            std::cout << "Failed to reject an invalid harmonic operation." << std::endl;
+            return 5;
+        }
+    }
+
+    // Test 6 - A disabled harmonic is silent whatever an envelope functor makes of its nominal magnitude.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        for ( size_t numThreads : { 1, 3 } )
+        {
+            int testResult = testEnableWithEnvelope( engineType, numThreads, 6 );
+            if ( 0 != testResult ) return testResult;
+        }
+    }
+
+    return 0;
+}
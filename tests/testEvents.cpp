@@ -0,0 +1,373 @@
+/**
+ * @file testEvents.cpp
+ * @brief Test Harness for Scheduled Events
+ *
+ * Frequency hops, magnitude steps, mutes and unmutes are scheduled at sample indices falling in the middle of
+ * `getSamples` buffers. Each event must take effect at exactly its sample index, and each harmonic must continue
+ * at a new rate from its phase at a hop, as the harmonics summed directly with the events applied do. Both
+ * `getSamples` and `accumSamples`, harmonic partitioned synthesis and single precision samples are exercised.
+ * We also verify events applied late after a seek, cloning, `reset` discarding pending events and the rejection
+ * of invalid events. Mutes must silence harmonics under envelope functors that ignore the nominal magnitudes
+ * passed to them, in every form of envelope functor.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+#include "PhaseArithmetic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 11;
+    constexpr size_t numSamples = 3000;
+    constexpr double fundamentalRadiansPerSample = 0.0213;
+    constexpr double sumOfMagnitudes = 20.0;    // An upper bound over every event below.
+
+    const CombGeneratorEventType schedule[] =
+    {
+        { 333, CombGeneratorEventAction::Retune, 0, 0.0371 },
+        { 500, CombGeneratorEventAction::SetMagnitude, 3, 2.5 },
+        { 500, CombGeneratorEventAction::MuteHarmonic, 5, 0.0 },
+        { 1201, CombGeneratorEventAction::Retune, 0, 0.0093 },
+        { 1700, CombGeneratorEventAction::UnmuteHarmonic, 5, 0.0 },
+        { 2000, CombGeneratorEventAction::MuteHarmonic, 0, 0.0 },
+        { 2100, CombGeneratorEventAction::SetMagnitude, 0, 3.0 },
+        { 2500, CombGeneratorEventAction::UnmuteHarmonic, 0, 0.0 },
+        { 2500, CombGeneratorEventAction::SetMagnitude, 10, 0.0 },
+    };
+
+    // The expected series, stepped through sample by sample with the events applied directly.
+    std::vector< FlyingPhasorElementType > expectedSeries( const CombGeneratorScalarVectorType & mags,
+                                                           const CombGeneratorScalarVectorType & phases,
+                                                           const CombGeneratorEventType * pEvents, size_t numEvents )
+    {
+        std::vector< double > startPhases( numHarmonics );
+        std::vector< double > nominals( numHarmonics );
+        std::vector< bool > muted( numHarmonics );
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            startPhases[i] = phases[i];
+            nominals[i] = mags[i];
+        }
+        double rate = fundamentalRadiansPerSample;
+
+        std::vector< FlyingPhasorElementType > series( numSamples );
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            for ( size_t e = 0; numEvents != e; ++e )
+            {
+                const auto & event = pEvents[e];
+                if ( n != event.sampleIndex ) continue;
+                switch ( event.action )
+                {
+                    case CombGeneratorEventAction::Retune:
+                        for ( size_t i = 0; numHarmonics != i; ++i )
+                            startPhases[i] = PhaseArithmetic::retunedPhase( startPhases[i], double( i + 1 ) * rate,
+                                                                            double( i + 1 ) * event.value, n );
+                        rate = event.value;
+                        break;
+                    case CombGeneratorEventAction::SetMagnitude:
+                        nominals[ event.nHarmonic ] = event.value;
+                        break;
+                    case CombGeneratorEventAction::MuteHarmonic:
+                        muted[ event.nHarmonic ] = true;
+                        break;
+                    case CombGeneratorEventAction::UnmuteHarmonic:
+                    default:
+                        muted[ event.nHarmonic ] = false;
+                        break;
+                }
+            }
+
+            for ( size_t i = 0; numHarmonics != i; ++i )
+            {
+                if ( muted[i] ) continue;
+                series[n] += std::polar( nominals[i],
+                                         PhaseArithmetic::phaseAt( startPhases[i], double( i + 1 ) * rate, n ) );
+            }
+        }
+        return series;
+    }
+
+    bool compareToEvents( const FlyingPhasorElementType * pSamples,
+                          const std::vector< FlyingPhasorElementType > & expected, size_t firstSample, size_t count,
+                          FlyingPhasorElementType base, double tolerance, const char * pTestName )
+    {
+        return compareToExpected( pSamples, firstSample, count,
+                                  [ & ]( size_t sampleIndex ) { return base + expected[ sampleIndex ]; },
+                                  tolerance * sumOfMagnitudes, pTestName );
+    }
+
+    int testEvents( CombGeneratorEngineType engineType, size_t numThreads, bool accumulate, int failCode )
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        constexpr auto numEvents = sizeof( schedule ) / sizeof( schedule[0] );
+        const auto expected = expectedSeries( mags, phases, schedule, numEvents );
+
+        CombGenerator combGenerator{ numHarmonics, engineType, numThreads, 100 };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        combGenerator.reserveEvents( numEvents );
+        for ( const auto & event : schedule )
+            combGenerator.scheduleEvent( event );
+        if ( numEvents != combGenerator.getNumPendingEvents() )
+        {
+            std::cout << "Failed Events Test with " << combGenerator.getNumPendingEvents() << " pending." << std::endl;
+            return failCode;
+        }
+
+        constexpr FlyingPhasorElementType garbage{ 1234.0, -5678.0 };
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        for ( size_t n = 0; numSamples != n; ++n )
+            buffer[n] = garbage;
+        size_t offset = 0;
+        for ( size_t chunkSize : { size_t( 1 ), size_t( 400 ), size_t( 1299 ), size_t( 1000 ), size_t( 300 ) } )
+        {
+            if ( accumulate )
+                combGenerator.accumSamples( buffer.get() + offset, chunkSize );
+            else
+                combGenerator.getSamples( buffer.get() + offset, chunkSize );
+            offset += chunkSize;
+        }
+
+        if ( combGenerator.getNumPendingEvents() ||
+             !compareToEvents( buffer.get(), expected, 0, numSamples,
+                               accumulate ? garbage : FlyingPhasorElementType{}, directSumTolerance, "Events Test" ) )
+            return failCode;
+
+        return 0;
+    }
+
+    // The forms in which an envelope functor may be registered.
+    enum class EnvelopeForm { PerHarmonic, Segment, Batch };
+
+    int testMutesWithEnvelope( CombGeneratorEngineType engineType, size_t numThreads, EnvelopeForm form, int failCode )
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        const CombGeneratorEventType mutes[] = { { 500, CombGeneratorEventAction::MuteHarmonic, 5, 0.0 },
+                                                 { 1700, CombGeneratorEventAction::UnmuteHarmonic, 5, 0.0 },
+                                                 { 2000, CombGeneratorEventAction::MuteHarmonic, 0, 0.0 },
+                                                 { 2500, CombGeneratorEventAction::UnmuteHarmonic, 0, 0.0 } };
+        const auto expected = expectedSeries( mags, phases, mutes, sizeof( mutes ) / sizeof( mutes[0] ) );
+
+        // Every form delivers the magnitudes given at reset throughout, ignoring the nominal magnitudes passed.
+        std::vector< double > envelopes( numHarmonics * numSamples );
+        std::vector< CombGeneratorEnvelopeSegmentType > segments( numHarmonics );
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            std::fill( envelopes.begin() + std::ptrdiff_t( i * numSamples ),
+                       envelopes.begin() + std::ptrdiff_t( ( i + 1 ) * numSamples ), mags[i] );
+            segments[i] = CombGeneratorEnvelopeSegmentType{ 0, mags[i], 0.0 };
+        }
+
+        CombGenerator combGenerator{ numHarmonics, engineType, numThreads, 100 };
+        if ( EnvelopeForm::PerHarmonic == form )
+            combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases,
+                                 [ &envelopes ]( size_t, size_t, size_t nHarmonic, double )
+                                 {
+                                     return envelopes.data() + nHarmonic * numSamples;
+                                 } );
+        else if ( EnvelopeForm::Segment == form )
+            combGenerator.resetWithSegmentEnvelope( numHarmonics, fundamentalRadiansPerSample, mags, phases,
+                                                    [ &segments ]( size_t, size_t, size_t nHarmonic, double )
+                                                    {
+                                                        return CombGeneratorEnvelopeSegmentsType{
+                                                            &segments[ nHarmonic ], 1 };
+                                                    } );
+        else
+            combGenerator.resetWithBatchEnvelope( numHarmonics, fundamentalRadiansPerSample, mags, phases,
+                                                  [ &mags ]( size_t, size_t blockSamples, size_t firstHarmonic,
+                                                             size_t rangeHarmonics, double * pMatrix, size_t stride )
+                                                  {
+                                                      for ( size_t n = 0; blockSamples != n; ++n )
+                                                          for ( size_t h = 0; rangeHarmonics != h; ++h )
+                                                              pMatrix[ n * stride + h ] = mags[ firstHarmonic + h ];
+                                                  } );
+        for ( const auto & event : mutes )
+            combGenerator.scheduleEvent( event );
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), 1999 );
+        combGenerator.getSamples( buffer.get() + 1999, numSamples - 1999 );
+        if ( !compareToEvents( buffer.get(), expected, 0, numSamples, FlyingPhasorElementType{}, directSumTolerance,
+                               "Events Envelope Mute Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Getting samples.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testEvents( engineType, 1, false, 1 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 2 - Accumulating samples.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testEvents( engineType, 1, true, 2 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 3 - Harmonic partitioned synthesis.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testEvents( engineType, 3, false, 3 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 4 - Single precision samples.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        const auto expected = expectedSeries( mags, phases, schedule, sizeof( schedule ) / sizeof( schedule[0] ) );
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        for ( const auto & event : schedule )
+            combGenerator.scheduleEvent( event );
+        std::unique_ptr< CombGeneratorSingleElementType[] > buffer{ new CombGeneratorSingleElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), 1234 );
+        combGenerator.getSamples( buffer.get() + 1234, numSamples - 1234 );
+        std::vector< FlyingPhasorElementType > samples( numSamples );
+        for ( size_t n = 0; numSamples != n; ++n )
+            samples[n] = FlyingPhasorElementType{ buffer[n].real(), buffer[n].imag() };
+        if ( !compareToEvents( samples.data(), expected, 0, numSamples, FlyingPhasorElementType{},
+                               singlePrecisionTolerance, "Events Single Precision Test" ) )
+            return 4;
+    }
+
+    // Test 5 - Frequency hops for the closed form engine, which rejects magnitude events.
+    {
+        std::unique_ptr< double[] > magValues{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phaseValues{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magValues[i] = 1.5;
+            phaseValues[i] = 0.1 * double( i );
+        }
+        const CombGeneratorScalarVectorType mags{ std::move( magValues ) };
+        const CombGeneratorScalarVectorType phases{ std::move( phaseValues ) };
+        const CombGeneratorEventType hops[] = { schedule[0], schedule[3] };
+        const auto expected = expectedSeries( mags, phases, hops, 2 );
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::ClosedForm };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        for ( const auto & event : hops )
+            combGenerator.scheduleEvent( event );
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), numSamples );
+        if ( !compareToEvents( buffer.get(), expected, 0, numSamples, FlyingPhasorElementType{}, directSumTolerance,
+                               "Events Closed Form Test" ) )
+            return 5;
+
+        bool threw = false;
+        try { combGenerator.scheduleEvent( { numSamples, CombGeneratorEventAction::MuteHarmonic, 0, 0.0 } ); }
+        catch ( const std::logic_error & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a magnitude event for the ClosedForm engine." << std::endl;
+            return 5;
+        }
+    }
+
+    // Test 6 - Events passed over by a seek are applied late. Clones take magnitudes but not pending events.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        const CombGeneratorEventType steps[] = { { 100, CombGeneratorEventAction::SetMagnitude, 2, 4.0 },
+                                                 { 200, CombGeneratorEventAction::MuteHarmonic, 7, 0.0 } };
+        const auto expected = expectedSeries( mags, phases, steps, 2 );
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        for ( const auto & event : steps )
+            combGenerator.scheduleEvent( event );
+        combGenerator.scheduleEvent( { 1500, CombGeneratorEventAction::Retune, 0, 0.05 } );
+        combGenerator.seekTo( 1000 );
+        FlyingPhasorElementType samples[ 100 ];
+        combGenerator.getSamples( samples, 100 );
+        if ( 1 != combGenerator.getNumPendingEvents() ||
+             !compareToEvents( samples, expected, 1000, 100, FlyingPhasorElementType{}, directSumTolerance,
+                               "Events Late Test" ) )
+            return 6;
+
+        auto clonedGenerator = combGenerator.clone();
+        clonedGenerator.getSamples( samples, 100 );
+        if ( clonedGenerator.getNumPendingEvents() ||
+             !compareToEvents( samples, expected, 1100, 100, FlyingPhasorElementType{}, directSumTolerance,
+                               "Events Clone Test" ) )
+            return 6;
+
+        // The clone's magnitudes are its own. Muting in the original does not reach it.
+        combGenerator.scheduleEvent( { 1100, CombGeneratorEventAction::MuteHarmonic, 2, 0.0 } );
+        combGenerator.getSamples( samples, 1 );
+        clonedGenerator.getSamples( samples, 100 );
+        if ( !compareToEvents( samples, expected, 1200, 100, FlyingPhasorElementType{}, directSumTolerance,
+                               "Events Clone Independence Test" ) )
+            return 6;
+
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        if ( combGenerator.getNumPendingEvents() )
+        {
+            std::cout << "Failed to discard pending events on reset." << std::endl;
+            return 6;
+        }
+    }
+
+    // Test 7 - Invalid events are rejected.
+    {
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, nullptr );
+        combGenerator.skipSamples( 100 );
+
+        bool threwPast = false;
+        try { combGenerator.scheduleEvent( { 99, CombGeneratorEventAction::Retune, 0, 0.01 } ); }
+        catch ( const std::invalid_argument & ) { threwPast = true; }
+        bool threwHarmonic = false;
+        try { combGenerator.scheduleEvent( { 100, CombGeneratorEventAction::MuteHarmonic, numHarmonics, 0.0 } ); }
+        catch ( const std::invalid_argument & ) { threwHarmonic = true; }
+
+        combGenerator.reset( numHarmonics, 0.001, 0.01, nullptr, nullptr );
+        bool threwToneBank = false;
+        try { combGenerator.scheduleEvent( { 0, CombGeneratorEventAction::Retune, 0, 0.02 } ); }
+        catch ( const std::logic_error & ) { threwToneBank = true; }
+
+        if ( !threwPast || !threwHarmonic || !threwToneBank || combGenerator.getNumPendingEvents() )
+        {
+            std::cout << "Failed to reject an invalid event." << std::endl;
+            return 7;
+        }
+    }
+
+    // Test 8 - Mutes silence harmonics whatever an envelope functor makes of the nominal magnitudes passed to it.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        for ( auto form : { EnvelopeForm::PerHarmonic, EnvelopeForm::Segment, EnvelopeForm::Batch } )
+        {
+            for ( size_t numThreads : { 1, 3 } )
+            {
+                int testResult = testMutesWithEnvelope( engineType, numThreads, form, 8 );
+                if ( 0 != testResult ) return testResult;
+            }
+        }
+    }
+
+    return 0;
+}
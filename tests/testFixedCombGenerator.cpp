@@ -0,0 +1,174 @@
+/**
+ * @file testFixedCombGenerator.cpp
+ * @brief Test Harness for the Compile Time Specialized Comb Generator
+ *
+ * Output of a FixedCombGenerator is compared against that of a CombGenerator constructed with the FusedKernel
+ * engine and reset with the same parameters. Envelope policies are compared against the equivalent per harmonic
+ * envelope functor. The delta must be within a few units of rounding relative to the sum of the harmonic magnitudes.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "FixedCombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    double envelopeValue( size_t nHarmonic, size_t sampleCount )
+    {
+        return 0.75 + 0.25 * std::cos( 1e-3 * double( nHarmonic + 1 ) * double( sampleCount ) );
+    }
+
+    // A policy scaling the nominal magnitudes by a slowly varying envelope.
+    struct CosineEnvelope
+    {
+        double operator()( size_t sampleCount, size_t nHarmonic, double nominalMagnitude ) const
+        {
+            return nominalMagnitude * envelopeValue( nHarmonic, sampleCount );
+        }
+    };
+
+    // The equivalent per harmonic envelope functor, with a buffer per harmonic.
+    class PerHarmonicEnvelope
+    {
+    public:
+        PerHarmonicEnvelope( size_t maxHarmonics, size_t maxSamples )
+          : buffers( maxHarmonics, std::vector< double >( maxSamples ) )
+        {
+        }
+
+        const double * operator()( size_t currentSample, size_t numSamples, size_t nHarmonic, double nominalMagnitude )
+        {
+            auto & buffer = buffers[ nHarmonic ];
+            for ( size_t i = 0; numSamples != i; ++i )
+                buffer[i] = nominalMagnitude * envelopeValue( nHarmonic, currentSample + i );
+            return buffer.data();
+        }
+
+        std::vector< std::vector< double > > buffers;
+    };
+
+    template < size_t numHarmonics, typename EnvelopePolicy >
+    int testAgainstRuntime( bool withMagAndPhase, bool accumulate, int failCode )
+    {
+        const double fundamentalRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * 1.0137;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = withMagAndPhase ? 1.0 / double( i + 1 ) : 1.0;
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+
+        FixedCombGenerator< numHarmonics, EnvelopePolicy > fixedGenerator{};
+        if ( withMagAndPhase )
+            fixedGenerator.reset( fundamentalRadiansPerSample, magnitudes.get(), phases.get() );
+        else
+            fixedGenerator.reset( fundamentalRadiansPerSample );
+
+        constexpr size_t maxChunkSize = 5000;
+        constexpr bool enveloped = !std::is_same< EnvelopePolicy, FixedCombGeneratorNominalEnvelope >::value;
+        PerHarmonicEnvelope referenceEnvelope{ numHarmonics, maxChunkSize };
+        CombGeneratorEnvelopeFunkType envelopeFunk{};
+        if ( enveloped )
+            envelopeFunk = std::ref( referenceEnvelope );
+
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+        CombGenerator referenceGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        if ( withMagAndPhase )
+            referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases,
+                                      envelopeFunk );
+        else
+            referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, nullptr, envelopeFunk );
+
+        // Chunk sizes span several tiles, exactly one, and less than one.
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > fixedBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        for ( size_t chunkSize : { size_t( 5000 ), size_t( 300 ), size_t( 64 ), size_t( 3 ) } )
+        {
+            if ( accumulate )
+            {
+                for ( size_t i = 0; chunkSize != i; ++i )
+                    referenceBuffer[i] = fixedBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                referenceGenerator.accumSamples( referenceBuffer.get(), chunkSize );
+                fixedGenerator.accumSamples( fixedBuffer.get(), chunkSize );
+            }
+            else
+            {
+                referenceGenerator.getSamples( referenceBuffer.get(), chunkSize );
+                fixedGenerator.getSamples( fixedBuffer.get(), chunkSize );
+            }
+
+            for ( size_t i = 0; chunkSize != i; ++i )
+            {
+                const auto delta = std::abs( referenceBuffer[i] - fixedBuffer[i] );
+                if ( summationTolerance * sumOfMagnitudes < delta )
+                {
+                    std::cout << "Failed Fixed Comb Generator Test at chunk sample index " << i << " with a delta of "
+                              << delta << "." << std::endl;
+                    return failCode;
+                }
+            }
+        }
+
+        if ( 5367 != fixedGenerator.getSampleCount() )
+        {
+            std::cout << "Failed Fixed Comb Generator sample count with " << fixedGenerator.getSampleCount()
+                      << "." << std::endl;
+            return failCode;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Magnitudes and phases, `getSamples`. The harmonic count is a multiple of the lane width.
+    int testResult = testAgainstRuntime< 16, FixedCombGeneratorNominalEnvelope >( true, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - Defaults, `accumSamples`. The harmonic count is not a multiple of the lane width.
+    testResult = testAgainstRuntime< 37, FixedCombGeneratorNominalEnvelope >( false, true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - An envelope policy against the equivalent envelope functor.
+    testResult = testAgainstRuntime< 12, CosineEnvelope >( true, false, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - A single harmonic.
+    testResult = testAgainstRuntime< 1, FixedCombGeneratorNominalEnvelope >( true, true, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - A newly constructed instance produces zeros.
+    {
+        FixedCombGenerator< 5 > fixedGenerator{};
+        FlyingPhasorElementType buffer[ 10 ];
+        fixedGenerator.getSamples( buffer, 10 );
+        for ( const auto & sample : buffer )
+        {
+            if ( FlyingPhasorElementType{} != sample )
+            {
+                std::cout << "Failed Fixed Comb Generator construction, non zero sample." << std::endl;
+                return 5;
+            }
+        }
+    }
+
+    return 0;
+}
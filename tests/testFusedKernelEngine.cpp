@@ -0,0 +1,140 @@
+/**
+ * @file testFusedKernelEngine.cpp
+ * @brief Test Harness for the Fused Kernel Engine
+ *
+ * The fused kernel engine must agree with the default ReiserRT_FlyingPhasor bank engine within the
+ * tolerance documented by CombGeneratorEngineType. We drive two CombGenerator instances, one per engine,
+ * with identical parameters and compare their output over many irregularly sized `getSamples` and
+ * `accumSamples` invocations, with and without an envelope functor.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+
+#include <memory>
+#include <cmath>
+#include <iostream>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t maxHarmonics = 240;
+    constexpr size_t numHarmonics = 237;    // Deliberately not a multiple of any vector width.
+    constexpr size_t maxEpochSize = 4096;
+    constexpr size_t totalSamples = size_t( 1 ) << 16;
+    constexpr double fundamentalRadiansPerSample = M_PI / 256.0;
+
+    // Chunk sizes cycled through. These cross kernel tile boundaries in various ways.
+    constexpr size_t chunkSizes[] = { 4096, 1, 63, 64, 65, 1000, 4095, 2 };
+
+    CombGeneratorScalarVectorType makeMagnitudes()
+    {
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            magnitudes[i] = 1.0 / double( i + 1 );
+        return CombGeneratorScalarVectorType{ std::move( magnitudes ) };
+    }
+
+    CombGeneratorScalarVectorType makePhases()
+    {
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+        return CombGeneratorScalarVectorType{ std::move( phases ) };
+    }
+
+    double sumOfMagnitudes( const CombGeneratorScalarVectorType & magnitudes )
+    {
+        double sum = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            sum += magnitudes[ std::ptrdiff_t( i ) ];
+        return sum;
+    }
+
+    int compareEngines( const CombGeneratorEnvelopeFunkType & envelopeFunk, bool accumulate, int failCode )
+    {
+        CombGenerator referenceGenerator{ maxHarmonics };
+        CombGenerator fusedGenerator{ maxHarmonics, CombGeneratorEngineType::FusedKernel };
+        if ( CombGeneratorEngineType::FusedKernel != fusedGenerator.getEngineType() )
+        {
+            std::cout << "Failed engine type query." << std::endl;
+            return failCode;
+        }
+
+        auto magnitudes = makeMagnitudes();
+        auto phases = makePhases();
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, phases, envelopeFunk );
+        fusedGenerator.reset( numHarmonics, fundamentalRadiansPerSample, magnitudes, phases, envelopeFunk );
+
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ maxEpochSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > fusedBuffer{ new FlyingPhasorElementType[ maxEpochSize ] };
+
+        const auto tolerance = 4e-12 * sumOfMagnitudes( magnitudes );
+        size_t sampleIndex = 0;
+        for ( size_t chunk = 0; totalSamples > sampleIndex; ++chunk )
+        {
+            const auto numSamples = chunkSizes[ chunk % ( sizeof( chunkSizes ) / sizeof( chunkSizes[0] ) ) ];
+            if ( accumulate )
+            {
+                // Accumulate onto a DC bias as the existing accumulate tests do.
+                for ( size_t i = 0; numSamples != i; ++i )
+                    referenceBuffer[i] = fusedBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                referenceGenerator.accumSamples( referenceBuffer.get(), numSamples );
+                fusedGenerator.accumSamples( fusedBuffer.get(), numSamples );
+            }
+            else
+            {
+                referenceGenerator.getSamples( referenceBuffer.get(), numSamples );
+                fusedGenerator.getSamples( fusedBuffer.get(), numSamples );
+            }
+
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                const auto delta = std::abs( referenceBuffer[i] - fusedBuffer[i] );
+                if ( tolerance < delta )
+                {
+                    std::cout << "Failed engine comparison at sample index " << sampleIndex + i
+                              << " with a delta of " << delta << "." << std::endl;
+                    return failCode;
+                }
+            }
+            sampleIndex += numSamples;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Constant magnitudes, `getSamples`.
+    int testResult = compareEngines( CombGeneratorEnvelopeFunkType{}, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - Constant magnitudes, `accumSamples`.
+    testResult = compareEngines( CombGeneratorEnvelopeFunkType{}, true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // An exponential decay envelope, periodically restarted, applied to every harmonic.
+    std::unique_ptr< double[] > envelopeBuffer{ new double[ maxEpochSize ] };
+    auto envelopeFunk = [ &envelopeBuffer ]( size_t nSample, size_t numSamples, size_t /*nHarmonic*/, double nominalMag )
+    {
+        const auto tau = double( maxEpochSize ) / 2.0;
+        for ( size_t i = 0; numSamples != i; ++i )
+            envelopeBuffer[i] = nominalMag * std::exp( double( nSample++ % maxEpochSize ) / -tau );
+        return static_cast< const double * >( envelopeBuffer.get() );
+    };
+
+    // Test 3 - Envelope functor, `getSamples`.
+    testResult = compareEngines( envelopeFunk, false, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Envelope functor, `accumSamples`.
+    testResult = compareEngines( envelopeFunk, true, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file testGate.cpp
+ * @brief Test Harness for Gated Comb Generation
+ *
+ * A gated CombGenerator must be silent while its gate is off and, while it is on, produce the series as though it
+ * had never been gated, so that every pulse is coherent with the last. Samples are requested in irregular chunks,
+ * straddling gate transitions. While the gate is off, getting samples must write exact zeros and accumulating
+ * samples must leave the buffer as it is.
+ * We also verify gates of explicit toggles, single precision samples, envelope functor invocations, cloning and
+ * the rejection of invalid gates.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 17;
+    constexpr size_t numSamples = 3000;
+    constexpr double fundamentalRadiansPerSample = 0.0193;
+    constexpr CombGeneratorGateType periodicGate{ 100, 10, 37 };
+    constexpr size_t toggleSamples[] = { 5, 250, 1234, 1300, 2500 };
+    constexpr FlyingPhasorElementType garbage{ 1234.0, -5678.0 };
+
+    using GateFunkType = std::function< bool( size_t ) >;
+
+    bool periodicOn( size_t sampleIndex )
+    {
+        return periodicGate.startOffsetSamples <= sampleIndex &&
+               ( sampleIndex - periodicGate.startOffsetSamples ) % periodicGate.pulseRepetitionSamples <
+                   periodicGate.pulseWidthSamples;
+    }
+
+    bool toggledOn( size_t sampleIndex )
+    {
+        size_t numToggled = 0;
+        for ( auto toggleSample : toggleSamples )
+            if ( toggleSample <= sampleIndex ) ++numToggled;
+        return numToggled & 0x1;
+    }
+
+    // Samples while the gate is off must be exactly those the buffer held.
+    bool compareToGate( const FlyingPhasorElementType * pSamples, size_t firstSample, size_t count,
+                        const CombGeneratorScalarVectorType & mags, const CombGeneratorScalarVectorType & phases,
+                        const GateFunkType & gateOn, bool accumulated, const char * pTestName )
+    {
+        const auto base = accumulated ? garbage : FlyingPhasorElementType{};
+        for ( size_t n = 0; count != n; ++n )
+        {
+            if ( !gateOn( firstSample + n ) && base != pSamples[n] )
+            {
+                std::cout << "Failed " << pTestName << " with the gate off at sample index " << firstSample + n
+                          << "." << std::endl;
+                return false;
+            }
+        }
+
+        return compareToExpected( pSamples, firstSample, count,
+                                  [ & ]( size_t sampleIndex )
+                                  {
+                                      if ( !gateOn( sampleIndex ) ) return base;
+                                      return base + directSample( numHarmonics, fundamentalRadiansPerSample, mags,
+                                                                  phases, sampleIndex );
+                                  },
+                                  directSumTolerance * sumOf( mags, numHarmonics ), pTestName );
+    }
+
+    int testGate( CombGeneratorEngineType engineType, size_t numThreads, bool toggled, bool accumulate,
+                  int failCode )
+    {
+        // Equal magnitudes and linear phases are accepted by the closed form engine.
+        const auto closedForm = CombGeneratorEngineType::ClosedForm == engineType;
+        const auto mags = closedForm ? makeVector( numHarmonics, 0.0, 1.5 ) : makeVector( numHarmonics, 1.0, 0.0 );
+        std::unique_ptr< double[] > phaseValues{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            phaseValues[i] = closedForm ? 0.1 * double( i ) : std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+        const CombGeneratorScalarVectorType phases{ std::move( phaseValues ) };
+
+        CombGenerator combGenerator{ numHarmonics, engineType, numThreads, 100 };
+        if ( toggled )
+            combGenerator.setGate( toggleSamples, sizeof( toggleSamples ) / sizeof( toggleSamples[0] ) );
+        else
+            combGenerator.setGate( periodicGate );
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        for ( size_t n = 0; numSamples != n; ++n )
+            buffer[n] = garbage;
+        size_t offset = 0;
+        for ( size_t chunkSize : { size_t( 1 ), size_t( 40 ), size_t( 333 ), size_t( 1500 ), size_t( 1126 ) } )
+        {
+            if ( accumulate )
+                combGenerator.accumSamples( buffer.get() + offset, chunkSize );
+            else
+                combGenerator.getSamples( buffer.get() + offset, chunkSize );
+            offset += chunkSize;
+        }
+
+        if ( numSamples != combGenerator.getSampleCount() )
+        {
+            std::cout << "Failed Gate Test sample count with " << combGenerator.getSampleCount() << "." << std::endl;
+            return failCode;
+        }
+
+        if ( !compareToGate( buffer.get(), 0, numSamples, mags, phases,
+                             toggled ? GateFunkType{ toggledOn } : GateFunkType{ periodicOn }, accumulate,
+                             "Gate Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - A periodic gate, for every engine.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel,
+                              CombGeneratorEngineType::ClosedForm, CombGeneratorEngineType::InverseFft } )
+    {
+        int testResult = testGate( engineType, 1, false, false, 1 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 2 - Accumulating through a periodic gate.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testGate( engineType, 1, false, true, 2 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 3 - A gate of explicit toggles, with and without harmonic partitioned synthesis.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testGate( engineType, 1, true, false, 3 );
+        if ( 0 != testResult ) return testResult;
+        testResult = testGate( engineType, 3, true, true, 3 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 4 - Single precision samples through a periodic gate.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.setGate( periodicGate );
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        std::unique_ptr< CombGeneratorSingleElementType[] > buffer{ new CombGeneratorSingleElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), 777 );
+        combGenerator.getSamples( buffer.get() + 777, numSamples - 777 );
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            const FlyingPhasorElementType sample{ buffer[n].real(), buffer[n].imag() };
+            FlyingPhasorElementType expected{};
+            if ( periodicOn( n ) )
+                expected = directSample( numHarmonics, fundamentalRadiansPerSample, mags, phases, n );
+            if ( singlePrecisionTolerance * sumOf( mags, numHarmonics ) < std::abs( sample - expected ) ||
+                 ( !periodicOn( n ) && FlyingPhasorElementType{} != sample ) )
+            {
+                std::cout << "Failed Gate Single Precision Test at sample index " << n << "." << std::endl;
+                return 4;
+            }
+        }
+    }
+
+    // Test 5 - Envelope functors are only invoked while the gate is on.
+    {
+        bool invokedWhileOff = false;
+        std::unique_ptr< double[] > envelope{ new double[ numSamples ] };
+        for ( size_t n = 0; numSamples != n; ++n )
+            envelope[n] = 1.0;
+        auto envelopeFunk = [ &invokedWhileOff, &envelope ]( size_t currentSample, size_t blockSamples, size_t,
+                                                             double )
+        {
+            for ( size_t n = 0; blockSamples != n; ++n )
+                invokedWhileOff = invokedWhileOff || !periodicOn( currentSample + n );
+            return static_cast< const double * >( envelope.get() );
+        };
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.setGate( periodicGate );
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, nullptr, envelopeFunk );
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        combGenerator.getSamples( buffer.get(), numSamples );
+        if ( invokedWhileOff )
+        {
+            std::cout << "Failed Gate Envelope Test with an invocation while the gate was off." << std::endl;
+            return 5;
+        }
+    }
+
+    // Test 6 - Cloning carries the gate over. Clearing it removes it. Invalid gates are rejected.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::PhasorBank };
+        if ( combGenerator.isGated() )
+        {
+            std::cout << "Failed Gate Test, gated after construction." << std::endl;
+            return 6;
+        }
+        combGenerator.setGate( periodicGate );
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases );
+        combGenerator.skipSamples( 1000 );
+
+        auto clonedGenerator = combGenerator.clone();
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        clonedGenerator.getSamples( buffer.get(), 500 );
+        if ( !clonedGenerator.isGated() ||
+             !compareToGate( buffer.get(), 1000, 500, mags, phases, periodicOn, false, "Gate Clone Test" ) )
+            return 6;
+
+        clonedGenerator.clearGate();
+        clonedGenerator.getSamples( buffer.get(), 500 );
+        if ( clonedGenerator.isGated() ||
+             !compareToGate( buffer.get(), 1500, 500, mags, phases, []( size_t ) { return true; }, false,
+                             "Gate Clear Test" ) )
+            return 6;
+
+        bool threw = false;
+        try { combGenerator.setGate( CombGeneratorGateType{ 10, 11, 0 } ); }
+        catch ( const std::invalid_argument & ) { threw = true; }
+        const size_t descending[] = { 10, 10 };
+        bool threwDescending = false;
+        try { combGenerator.setGate( descending, 2 ); }
+        catch ( const std::invalid_argument & ) { threwDescending = true; }
+        if ( !threw || !threwDescending )
+        {
+            std::cout << "Failed to reject an invalid gate." << std::endl;
+            return 6;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/**
+ * @file testHarmonicPartitioning.cpp
+ * @brief Test Harness for Harmonic Partitioned Multithreaded Sample Generation
+ *
+ * Output of a CombGenerator constructed with several threads is compared against that of a single threaded one,
+ * reset identically. Each harmonic advances identically either way. Only the order of summation differs,
+ * so the delta must be within a few units of rounding, relative to the sum of the harmonic magnitudes.
+ * We also verify that envelope functors are invoked as documented and that results are deterministic.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+
+#include <atomic>
+#include <memory>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr double summationTolerance = 1e-14;
+
+    // An envelope of slow amplitude modulation, differing per harmonic, with a buffer per harmonic.
+    class PerHarmonicEnvelope
+    {
+    public:
+        PerHarmonicEnvelope( size_t maxHarmonics, size_t maxSamples )
+          : buffers( maxHarmonics, std::vector< double >( maxSamples ) )
+        {
+        }
+
+        const double * operator()( size_t currentSample, size_t numSamples, size_t nHarmonic, double )
+        {
+            ++numInvocations;
+            auto & buffer = buffers[ nHarmonic ];
+            for ( size_t i = 0; numSamples != i; ++i )
+                buffer[i] = 0.75 + 0.25 * std::cos( 1e-3 * double( nHarmonic + 1 ) * double( currentSample + i ) );
+            return buffer.data();
+        }
+
+        std::vector< std::vector< double > > buffers;
+        std::atomic< size_t > numInvocations{};
+    };
+
+    int testAgainstSingleThreaded( CombGeneratorEngineType engineType, size_t numHarmonics, size_t numThreads,
+                                   bool useEnvelope, bool accumulate, int failCode )
+    {
+        const double fundamentalRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * 1.0137;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 );
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+
+        // Chunk sizes are not multiples of the partition tile, and the last is too small to partition.
+        constexpr size_t maxChunkSize = 5000;
+        PerHarmonicEnvelope referenceEnvelope{ numHarmonics, maxChunkSize };
+        PerHarmonicEnvelope threadedEnvelope{ numHarmonics, maxChunkSize };
+        CombGeneratorEnvelopeFunkType referenceFunk{};
+        CombGeneratorEnvelopeFunkType threadedFunk{};
+        if ( useEnvelope )
+        {
+            referenceFunk = std::ref( referenceEnvelope );
+            threadedFunk = std::ref( threadedEnvelope );
+        }
+
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        CombGenerator threadedGenerator{ numHarmonics, engineType, numThreads, 1000 };
+        if ( numThreads != threadedGenerator.getNumThreads() || 1 != referenceGenerator.getNumThreads() )
+        {
+            std::cout << "Failed number of threads query." << std::endl;
+            return failCode;
+        }
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases, referenceFunk );
+        threadedGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases, threadedFunk );
+
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > threadedBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        for ( size_t chunkSize : { size_t( 5000 ), size_t( 4097 ), size_t( 3 ) } )
+        {
+            if ( accumulate )
+            {
+                for ( size_t i = 0; chunkSize != i; ++i )
+                    referenceBuffer[i] = threadedBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                referenceGenerator.accumSamples( referenceBuffer.get(), chunkSize );
+                threadedGenerator.accumSamples( threadedBuffer.get(), chunkSize );
+            }
+            else
+            {
+                referenceGenerator.getSamples( referenceBuffer.get(), chunkSize );
+                threadedGenerator.getSamples( threadedBuffer.get(), chunkSize );
+            }
+
+            for ( size_t i = 0; chunkSize != i; ++i )
+            {
+                const auto delta = std::abs( referenceBuffer[i] - threadedBuffer[i] );
+                if ( summationTolerance * sumOfMagnitudes < delta )
+                {
+                    std::cout << "Failed Harmonic Partitioning Test at chunk sample index " << i << " with a delta of "
+                              << delta << "." << std::endl;
+                    return failCode;
+                }
+            }
+        }
+
+        if ( referenceGenerator.getSampleCount() != threadedGenerator.getSampleCount() )
+        {
+            std::cout << "Failed sample count with " << threadedGenerator.getSampleCount() << "." << std::endl;
+            return failCode;
+        }
+
+        // Partitioned chunks invoke the functor once per harmonic per tile, three tiles each. The small chunk does not
+        // partition and invokes it once per harmonic.
+        if ( useEnvelope && ( 3 + 3 + 1 ) * numHarmonics != threadedEnvelope.numInvocations )
+        {
+            std::cout << "Failed envelope functor invocation count with " << threadedEnvelope.numInvocations
+                      << "." << std::endl;
+            return failCode;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - The fused kernel engine, `getSamples`. The harmonic count is not a multiple of the lane width.
+    int testResult = testAgainstSingleThreaded( CombGeneratorEngineType::FusedKernel, 100, 4, false, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - The phasor bank engine, `accumSamples`, with more threads than make sense for the work.
+    testResult = testAgainstSingleThreaded( CombGeneratorEngineType::PhasorBank, 13, 8, false, true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - The fused kernel engine with an envelope functor.
+    testResult = testAgainstSingleThreaded( CombGeneratorEngineType::FusedKernel, 37, 3, true, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - The phasor bank engine with an envelope functor.
+    testResult = testAgainstSingleThreaded( CombGeneratorEngineType::PhasorBank, 12, 3, true, false, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - Results are deterministic, bit for bit, from run to run.
+    {
+        constexpr size_t numHarmonics = 64;
+        constexpr size_t numSamples = 10000;
+        std::unique_ptr< FlyingPhasorElementType[] > firstBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< FlyingPhasorElementType[] > secondBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        for ( auto pBuffer : { firstBuffer.get(), secondBuffer.get() } )
+        {
+            CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel, 4, 1 };
+            combGenerator.reset( numHarmonics, M_PI / 200.0, nullptr, nullptr );
+            combGenerator.getSamples( pBuffer, numSamples );
+        }
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( firstBuffer[i] != secondBuffer[i] )
+            {
+                std::cout << "Failed Determinism Test at sample index " << i << "." << std::endl;
+                return 5;
+            }
+        }
+    }
+
+    // Test 6 - An exception thrown by the envelope functor, on one partition of a later tile, propagates rather
+    // than leave the other workers waiting. The generator is usable again after a reset.
+    for ( auto engineType : { CombGeneratorEngineType::FusedKernel, CombGeneratorEngineType::PhasorBank } )
+    {
+        constexpr size_t numHarmonics = 64;
+        constexpr size_t numSamples = 5000;
+        PerHarmonicEnvelope envelope{ numHarmonics, numSamples };
+        auto throwingFunk = [ &envelope ]( size_t currentSample, size_t numSamples, size_t nHarmonic, double rate )
+        {
+            if ( 40 == nHarmonic && currentSample )
+                throw std::runtime_error{ "Envelope Failure" };
+            return envelope( currentSample, numSamples, nHarmonic, rate );
+        };
+
+        CombGenerator combGenerator{ numHarmonics, engineType, 4, 1 };
+        combGenerator.reset( numHarmonics, M_PI / 200.0, nullptr, nullptr, throwingFunk );
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        bool caught = false;
+        try
+        {
+            combGenerator.getSamples( buffer.get(), numSamples );
+        }
+        catch ( const std::runtime_error & )
+        {
+            caught = true;
+        }
+        if ( !caught )
+        {
+            std::cout << "Failed Envelope Exception Test, the exception was not propagated." << std::endl;
+            return 6;
+        }
+
+        combGenerator.reset( numHarmonics, M_PI / 200.0, nullptr, nullptr );
+        combGenerator.getSamples( buffer.get(), numSamples );
+        if ( numSamples != combGenerator.getSampleCount() )
+        {
+            std::cout << "Failed Envelope Exception Test, with a sample count of " << combGenerator.getSampleCount()
+                      << " after reset." << std::endl;
+            return 6;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file testInverseFftEngine.cpp
+ * @brief Test Harness for the Inverse FFT Block Synthesis Engine
+ *
+ * The inverse FFT engine does not produce results bit identical to ReiserRT_FlyingPhasor instances.
+ * Here we repeat the `testMagAndPhaseNoEnvelope` expectations, except that the delta must be within the
+ * spur free dynamic range documented by CombGeneratorEngineType, rather than exactly zero.
+ * We also verify that the engine's error does not grow with sample count, against an extended precision
+ * reference, and that engine selection behaves as documented.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "FlyingPhasorToneGenerator.h"
+
+#include <memory>
+#include <cmath>
+#include <vector>
+#include <iostream>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    // Spur free dynamic range against the PhasorBank engine, relative to the sum of the harmonic magnitudes.
+    constexpr double sfdrTolerance = 2e-13;     // Better than 250 dB.
+
+    // Error against exact synthesis, relative to the sum of the harmonic magnitudes.
+    constexpr double exactTolerance = 1e-14;
+
+    int testMagPhaseNoEnvelope( bool accumulate, int failCode )
+    {
+        // Construct a CombGenerator specifying a maximum number of harmonics tones
+        constexpr size_t maxHarmonics = 4;
+        CombGenerator combGenerator{ maxHarmonics, CombGeneratorEngineType::InverseFft };
+
+        // Initialize Mags and Phase. We will use incrementally changing magnitudes and phase.
+        constexpr size_t numHarmonics = 3;
+        constexpr double fundamentalRadiansPerSample = M_PI / 8.0;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for (size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 4.0 - double(i);
+            phases[i] = double(i) * M_PI / 32;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample,
+                             sharedMagnitudes, sharedPhases );
+        if ( CombGeneratorEngineType::InverseFft != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed active engine type query." << std::endl;
+            return failCode;
+        }
+
+        // Produce samples, onto a DC bias when accumulating.
+        constexpr size_t maxEpochSize = 4096;
+        std::unique_ptr< FlyingPhasorElementType[] > epochSampleBuffer{ new FlyingPhasorElementType [ maxEpochSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > compareSampleBuffer{ new FlyingPhasorElementType[ maxEpochSize ] };
+        if ( accumulate )
+        {
+            for ( size_t i = 0; maxEpochSize != i; ++i )
+                epochSampleBuffer[i] = compareSampleBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+            combGenerator.accumSamples( epochSampleBuffer.get(), maxEpochSize );
+        }
+        else
+        {
+            for ( size_t i = 0; maxEpochSize != i; ++i )
+                compareSampleBuffer[i] = FlyingPhasorElementType{};
+            combGenerator.getSamples( epochSampleBuffer.get(), maxEpochSize );
+        }
+
+        // Remove the tones with FlyingPhasors. What remains must be within our spur free dynamic range.
+        std::vector< FlyingPhasorToneGenerator > spectralLineGenerators{ numHarmonics };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            spectralLineGenerators[i].reset( double(i+1) * fundamentalRadiansPerSample, sharedPhases[ std::ptrdiff_t(i) ] );
+            spectralLineGenerators[i].accumSamplesScaled( compareSampleBuffer.get(), maxEpochSize,
+                sharedMagnitudes[ std::ptrdiff_t(i) ] );
+        }
+        for ( size_t i = 0; maxEpochSize != i; ++i )
+        {
+            const auto delta = std::abs( epochSampleBuffer[i] - compareSampleBuffer[i] );
+            if ( sfdrTolerance * sumOfMagnitudes < delta )
+            {
+                std::cout << "Failed SFDR Test at epoch sample index " << i << " with a delta of "
+                          << delta << "." << std::endl;
+                return failCode;
+            }
+        }
+
+        return 0;
+    }
+
+    int testNoErrorGrowth( int failCode )
+    {
+        // Many harmonics, off bin, with varied magnitudes and phases.
+        constexpr size_t numHarmonics = 237;
+        constexpr double fundamentalRadiansPerSample = M_PI / 256.0 * 1.0137;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 );
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::InverseFft };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases );
+
+        // Run well past where the recursive engines would have drifted, checking the final epoch.
+        constexpr size_t epochSize = 4096;
+        constexpr size_t numEpochs = 256;
+        std::unique_ptr< FlyingPhasorElementType[] > epochSampleBuffer{ new FlyingPhasorElementType [ epochSize ] };
+        for ( size_t epoch = 0; numEpochs != epoch; ++epoch )
+            combGenerator.getSamples( epochSampleBuffer.get(), epochSize );
+
+        const auto firstSample = ( numEpochs - 1 ) * epochSize;
+        for ( size_t i = 0; epochSize > i; i += 61 )
+        {
+            long double real = 0.0L;
+            long double imag = 0.0L;
+            for ( size_t h = 0; numHarmonics != h; ++h )
+            {
+                const auto rate = double( h + 1 ) * fundamentalRadiansPerSample;
+                const auto phase = (long double)sharedPhases[ std::ptrdiff_t( h ) ] +
+                                   (long double)rate * (long double)( firstSample + i );
+                real += sharedMagnitudes[ std::ptrdiff_t( h ) ] * std::cos( phase );
+                imag += sharedMagnitudes[ std::ptrdiff_t( h ) ] * std::sin( phase );
+            }
+            const auto delta = std::abs( epochSampleBuffer[i] - FlyingPhasorElementType{ double( real ), double( imag ) } );
+            if ( exactTolerance * sumOfMagnitudes < delta )
+            {
+                std::cout << "Failed Error Growth Test at sample index " << firstSample + i << " with a delta of "
+                          << delta << "." << std::endl;
+                return failCode;
+            }
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - The `getSamples` operation after `reset` with specific parameters.
+    int testResult = testMagPhaseNoEnvelope( false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - The `accumSamples` operation after `reset` with specific parameters.
+    testResult = testMagPhaseNoEnvelope( true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - Error against exact synthesis does not grow with sample count.
+    testResult = testNoErrorGrowth( 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Engine selection. An envelope functor defers to the fused kernel engine
+    // and a newly set engine type takes effect at the next `reset`.
+    {
+        CombGenerator combGenerator{ 4, CombGeneratorEngineType::InverseFft };
+        auto envelopeFunk = []( size_t, size_t, size_t, double ) { return static_cast< const double * >( nullptr ); };
+        combGenerator.reset( 3, M_PI / 8.0, nullptr, nullptr, envelopeFunk );
+        if ( CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed to defer to the FusedKernel engine with an envelope functor." << std::endl;
+            return 4;
+        }
+
+        combGenerator.setEngineType( CombGeneratorEngineType::PhasorBank );
+        if ( CombGeneratorEngineType::PhasorBank != combGenerator.getEngineType() ||
+             CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed engine type queries after setting the engine type." << std::endl;
+            return 4;
+        }
+
+        combGenerator.reset( 3, M_PI / 8.0, nullptr, nullptr );
+        if ( CombGeneratorEngineType::PhasorBank != combGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed to put the newly set engine type into effect at reset." << std::endl;
+            return 4;
+        }
+    }
+
+    return 0;
+}
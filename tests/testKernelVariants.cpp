@@ -0,0 +1,116 @@
+/**
+ * @file testKernelVariants.cpp
+ * @brief Test Harness for Run Time Kernel Variant Selection
+ *
+ * Here we verify that kernel variants may be forced through the API override and the environment
+ * variable, that a forced variant never exceeds what the processor supports, and that every variant
+ * produces the same signal as the baseline variant within the documented tolerance.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+
+#include <memory>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+using namespace ReiserRT::Signal;
+
+namespace
+{
+    constexpr size_t numHarmonics = 100;
+    constexpr size_t maxEpochSize = 4096;
+    constexpr size_t numEpochs = 16;
+    constexpr double fundamentalRadiansPerSample = M_PI / 512.0;
+
+    void generate( CombGenerator & combGenerator, FlyingPhasorElementBufferTypePtr pBuffer )
+    {
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, nullptr );
+        for ( size_t i = 0; numEpochs != i; ++i )
+            combGenerator.getSamples( pBuffer + i * maxEpochSize, maxEpochSize );
+    }
+}
+
+int main()
+{
+    // Make sure the environment does not interfere until we want it to.
+    unsetenv( "REISER_RT_COMBGENERATOR_KERNEL" );
+
+    // Automatic selection determines the fastest supported variant. It is never `Automatic`.
+    CombGenerator::setKernelVariantOverride( CombGeneratorKernelVariant::Automatic );
+    const auto fastest = CombGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel }.getKernelVariant();
+    if ( CombGeneratorKernelVariant::Automatic == fastest )
+    {
+        std::cout << "Failed automatic selection. Automatic should never be selected." << std::endl;
+        return 1;
+    }
+
+    // Baseline reference.
+    constexpr size_t totalSamples = numEpochs * maxEpochSize;
+    std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ totalSamples ] };
+    std::unique_ptr< FlyingPhasorElementType[] > variantBuffer{ new FlyingPhasorElementType[ totalSamples ] };
+    CombGenerator::setKernelVariantOverride( CombGeneratorKernelVariant::Baseline );
+    {
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        if ( CombGeneratorKernelVariant::Baseline != combGenerator.getKernelVariant() )
+        {
+            std::cout << "Failed to force the baseline variant." << std::endl;
+            return 2;
+        }
+        generate( combGenerator, referenceBuffer.get() );
+    }
+
+    // Every variant, forced through the API, agrees with the baseline.
+    const auto tolerance = 4e-12 * double( numHarmonics );
+    for ( auto variant : { CombGeneratorKernelVariant::Avx2, CombGeneratorKernelVariant::Avx512 } )
+    {
+        CombGenerator::setKernelVariantOverride( variant );
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        const auto selected = combGenerator.getKernelVariant();
+        const auto expected = fastest < variant ? fastest : variant;
+        if ( expected != selected )
+        {
+            std::cout << "Failed forced selection of variant " << int( variant ) << ". Selected "
+                      << int( selected ) << " and expected " << int( expected ) << "." << std::endl;
+            return 3;
+        }
+
+        generate( combGenerator, variantBuffer.get() );
+        for ( size_t i = 0; totalSamples != i; ++i )
+        {
+            if ( tolerance < std::abs( referenceBuffer[i] - variantBuffer[i] ) )
+            {
+                std::cout << "Failed variant " << int( selected ) << " comparison at sample index "
+                          << i << "." << std::endl;
+                return 4;
+            }
+        }
+    }
+
+    // The environment variable is honored when there is no API override.
+    CombGenerator::setKernelVariantOverride( CombGeneratorKernelVariant::Automatic );
+    setenv( "REISER_RT_COMBGENERATOR_KERNEL", "baseline", 1 );
+    if ( CombGeneratorKernelVariant::Baseline !=
+         CombGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel }.getKernelVariant() )
+    {
+        std::cout << "Failed to force the baseline variant through the environment." << std::endl;
+        return 5;
+    }
+
+    // The API override takes precedence over the environment variable.
+    CombGenerator::setKernelVariantOverride( CombGeneratorKernelVariant::Avx2 );
+    const auto expected = fastest < CombGeneratorKernelVariant::Avx2 ? fastest : CombGeneratorKernelVariant::Avx2;
+    if ( expected != CombGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel }.getKernelVariant() )
+    {
+        std::cout << "Failed API override precedence over the environment." << std::endl;
+        return 6;
+    }
+
+    CombGenerator::setKernelVariantOverride( CombGeneratorKernelVariant::Automatic );
+    unsetenv( "REISER_RT_COMBGENERATOR_KERNEL" );
+
+    return 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file testMutedEnvelope.cpp
+ * @brief Test Harness for Harmonics Muted by an Envelope Functor
+ *
+ * An envelope functor mutes some harmonics for some blocks by returning nullptr. Muted harmonics must be silent
+ * for those blocks and must resume at the phase they would have had were they never muted. Both `getSamples`
+ * and `accumSamples`, harmonic partitioned synthesis and single precision samples are exercised, as is a block
+ * in which every harmonic is muted.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+#include "PhaseArithmetic.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 13;
+    constexpr size_t blockSamples = 250;
+    constexpr size_t numBlocks = 8;
+    constexpr double fundamentalRadiansPerSample = 0.0417;
+
+    // Odd numbered blocks mute the even harmonics. The fourth block mutes every harmonic.
+    bool muted( size_t block, size_t nHarmonic )
+    {
+        return 3 == block || ( ( block & 0x1 ) && !( nHarmonic & 0x1 ) );
+    }
+
+    FlyingPhasorElementType expectedSample( const CombGeneratorScalarVectorType & mags,
+                                            const CombGeneratorScalarVectorType & phases, size_t sampleIndex )
+    {
+        FlyingPhasorElementType sample{};
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            if ( muted( sampleIndex / blockSamples, i ) ) continue;
+            const auto phase = PhaseArithmetic::phaseAt( phases[i], double( i + 1 ) * fundamentalRadiansPerSample,
+                                                         sampleIndex );
+            sample += std::polar( mags[i], phase );
+        }
+        return sample;
+    }
+
+    int testMuted( CombGeneratorEngineType engineType, size_t numThreads, bool accumulate, int failCode )
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+
+        // Envelopes are the nominal magnitudes, one buffer per harmonic as partitioned synthesis requires.
+        std::vector< std::vector< double > > envelopes( numHarmonics, std::vector< double >( blockSamples ) );
+        auto envelopeFunk = [ &envelopes ]( size_t currentSample, size_t numSamples, size_t nHarmonic,
+                                            double nominalMag ) -> const double *
+        {
+            if ( muted( currentSample / blockSamples, nHarmonic ) )
+                return nullptr;
+            auto & envelope = envelopes[ nHarmonic ];
+            for ( size_t n = 0; numSamples != n; ++n )
+                envelope[n] = nominalMag;
+            return envelope.data();
+        };
+
+        CombGenerator combGenerator{ numHarmonics, engineType, numThreads, 100 };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases, envelopeFunk );
+
+        // The buffer starts out with garbage that getting samples must overwrite, even when all are muted.
+        constexpr FlyingPhasorElementType garbage{ 1234.0, -5678.0 };
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ blockSamples ] };
+        for ( size_t block = 0; numBlocks != block; ++block )
+        {
+            for ( size_t n = 0; blockSamples != n; ++n )
+                buffer[n] = garbage;
+            if ( accumulate )
+                combGenerator.accumSamples( buffer.get(), blockSamples );
+            else
+                combGenerator.getSamples( buffer.get(), blockSamples );
+
+            if ( !compareToExpected( buffer.get(), block * blockSamples, blockSamples,
+                                     [ & ]( size_t sampleIndex )
+                                     {
+                                         return expectedSample( mags, phases, sampleIndex ) +
+                                                ( accumulate ? garbage : 0.0 );
+                                     },
+                                     directSumTolerance * sumOf( mags, numHarmonics ), "Muted Envelope Test" ) )
+                return failCode;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Getting samples.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testMuted( engineType, 1, false, 1 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 2 - Accumulating samples.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testMuted( engineType, 1, true, 2 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 3 - Harmonic partitioned synthesis.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        int testResult = testMuted( engineType, 3, false, 3 );
+        if ( 0 != testResult ) return testResult;
+    }
+
+    // Test 4 - Single precision samples, converted from double precision in chunks.
+    {
+        const auto mags = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+        std::vector< double > envelope( blockSamples );
+        auto envelopeFunk = [ &envelope ]( size_t currentSample, size_t numSamples, size_t nHarmonic,
+                                           double nominalMag ) -> const double *
+        {
+            if ( muted( currentSample / blockSamples, nHarmonic ) )
+                return nullptr;
+            for ( size_t n = 0; numSamples != n; ++n )
+                envelope[n] = nominalMag;
+            return envelope.data();
+        };
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, phases, envelopeFunk );
+        std::vector< CombGeneratorSingleElementType > buffer( blockSamples );
+        for ( size_t block = 0; numBlocks != block; ++block )
+        {
+            combGenerator.getSamples( buffer.data(), blockSamples );
+            for ( size_t n = 0; blockSamples != n; ++n )
+            {
+                const auto sampleIndex = block * blockSamples + n;
+                const FlyingPhasorElementType sample{ buffer[n].real(), buffer[n].imag() };
+                const auto expected = expectedSample( mags, phases, sampleIndex );
+                if ( singlePrecisionTolerance * sumOf( mags, numHarmonics ) < std::abs( sample - expected ) )
+                {
+                    std::cout << "Failed Muted Envelope Single Precision Test at sample index " << sampleIndex
+                              << "." << std::endl;
+                    return 4;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
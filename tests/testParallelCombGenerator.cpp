@@ -0,0 +1,177 @@
+/**
+ * @file testParallelCombGenerator.cpp
+ * @brief Test Harness for the Time Partitioned Parallel Comb Generator
+ *
+ * A ParallelCombGenerator must produce the samples a single threaded CombGenerator, reset identically, produces,
+ * however its workers divide each request between them. Workers seek to their segments, so samples agree only to
+ * the rounding of phases computed directly. We also verify `accumSamples`, single precision output after a seek,
+ * the sample count and that a clone continues where its prototype is.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "HarmonicSeriesFixture.h"
+#include "ParallelCombGenerator.h"
+
+#include <memory>
+#include <cmath>
+#include <iostream>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    struct CombSetup
+    {
+        explicit CombSetup( size_t theNumHarmonics )
+          : numHarmonics{ theNumHarmonics }
+          , fundamentalRadiansPerSample{ M_PI / double( 2 * numHarmonics + 3 ) * 1.0137 }
+        {
+            std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+            std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+            for ( size_t i = 0; numHarmonics != i; ++i )
+            {
+                magnitudes[i] = 1.0 / double( i + 1 );
+                phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+                sumOfMagnitudes += magnitudes[i];
+            }
+            sharedMagnitudes = CombGeneratorScalarVectorType{ std::move( magnitudes ) };
+            sharedPhases = CombGeneratorScalarVectorType{ std::move( phases ) };
+        }
+
+        void reset( CombGenerator & combGenerator ) const
+        {
+            combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases );
+        }
+
+        const size_t numHarmonics;
+        const double fundamentalRadiansPerSample;
+        double sumOfMagnitudes{};
+        CombGeneratorScalarVectorType sharedMagnitudes{};
+        CombGeneratorScalarVectorType sharedPhases{};
+    };
+
+    int testAgainstSingleThreaded( CombGeneratorEngineType engineType, size_t numHarmonics, bool accumulate, int failCode )
+    {
+        const CombSetup combSetup{ numHarmonics };
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        CombGenerator prototype{ numHarmonics, engineType };
+        combSetup.reset( referenceGenerator );
+        combSetup.reset( prototype );
+
+        // Four workers of at least 1000 samples each. Chunk sizes vary, so some use fewer workers.
+        ParallelCombGenerator parallelGenerator{ prototype, 4, 1000 };
+        if ( 4 != parallelGenerator.getNumWorkers() )
+        {
+            std::cout << "Failed number of workers query." << std::endl;
+            return failCode;
+        }
+
+        constexpr size_t maxChunkSize = 50000;
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > parallelBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        for ( size_t chunkSize : { size_t( 50000 ), size_t( 1500 ), size_t( 999 ), size_t( 40001 ) } )
+        {
+            if ( accumulate )
+            {
+                for ( size_t i = 0; chunkSize != i; ++i )
+                    referenceBuffer[i] = parallelBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                referenceGenerator.accumSamples( referenceBuffer.get(), chunkSize );
+                parallelGenerator.accumSamples( parallelBuffer.get(), chunkSize );
+            }
+            else
+            {
+                referenceGenerator.getSamples( referenceBuffer.get(), chunkSize );
+                parallelGenerator.getSamples( parallelBuffer.get(), chunkSize );
+            }
+
+            // Sample indices reported are those within the chunk.
+            if ( !compareToExpected( parallelBuffer.get(), 0, chunkSize,
+                                     [ & ]( size_t sampleIndex ) { return referenceBuffer[ sampleIndex ]; },
+                                     directSumTolerance * combSetup.sumOfMagnitudes, "Parallel Test" ) )
+                return failCode;
+        }
+
+        if ( referenceGenerator.getSampleCount() != parallelGenerator.getSampleCount() )
+        {
+            std::cout << "Failed sample count with " << parallelGenerator.getSampleCount() << "." << std::endl;
+            return failCode;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - The phasor bank engine, `getSamples`.
+    int testResult = testAgainstSingleThreaded( CombGeneratorEngineType::PhasorBank, 12, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - The fused kernel engine, `accumSamples`.
+    testResult = testAgainstSingleThreaded( CombGeneratorEngineType::FusedKernel, 37, true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - The inverse FFT engine, `getSamples`.
+    testResult = testAgainstSingleThreaded( CombGeneratorEngineType::InverseFft, 600, false, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Single precision output, after seeking.
+    {
+        const CombSetup combSetup{ 37 };
+        CombGenerator referenceGenerator{ 37, CombGeneratorEngineType::FusedKernel };
+        combSetup.reset( referenceGenerator );
+        ParallelCombGenerator parallelGenerator{ referenceGenerator, 3, 1000 };
+
+        constexpr size_t chunkSize = 30000;
+        constexpr size_t seekIndex = 1234567;
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ chunkSize ] };
+        std::unique_ptr< CombGeneratorSingleElementType[] > parallelBuffer{ new CombGeneratorSingleElementType[ chunkSize ] };
+        referenceGenerator.seekTo( seekIndex );
+        parallelGenerator.seekTo( seekIndex );
+        referenceGenerator.getSamples( referenceBuffer.get(), chunkSize );
+        parallelGenerator.getSamples( parallelBuffer.get(), chunkSize );
+        for ( size_t i = 0; chunkSize != i; ++i )
+        {
+            const FlyingPhasorElementType single{ parallelBuffer[i].real(), parallelBuffer[i].imag() };
+            const auto delta = std::abs( referenceBuffer[i] - single );
+            if ( singlePrecisionTolerance * combSetup.sumOfMagnitudes < delta )
+            {
+                std::cout << "Failed Single Precision Parallel Test at sample index " << i << " with a delta of "
+                          << delta << "." << std::endl;
+                return 4;
+            }
+        }
+    }
+
+    // Test 5 - A clone continues where its prototype is, with the same engine.
+    {
+        const CombSetup combSetup{ 12 };
+        CombGenerator prototype{ 12, CombGeneratorEngineType::Automatic };
+        combSetup.reset( prototype );
+        constexpr size_t numSamples = 1000;
+        std::unique_ptr< FlyingPhasorElementType[] > prototypeBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< FlyingPhasorElementType[] > cloneBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        prototype.getSamples( prototypeBuffer.get(), numSamples );
+
+        auto clone = prototype.clone();
+        if ( numSamples != clone.getSampleCount() || prototype.getNumHarmonics() != clone.getNumHarmonics() ||
+             prototype.getActiveEngineType() != clone.getActiveEngineType() ||
+             prototype.getEngineType() != clone.getEngineType() )
+        {
+            std::cout << "Failed clone queries." << std::endl;
+            return 5;
+        }
+
+        prototype.getSamples( prototypeBuffer.get(), numSamples );
+        clone.getSamples( cloneBuffer.get(), numSamples );
+        if ( !compareToExpected( cloneBuffer.get(), 0, numSamples,
+                                 [ & ]( size_t sampleIndex ) { return prototypeBuffer[ sampleIndex ]; },
+                                 directSumTolerance * combSetup.sumOfMagnitudes, "Clone Test" ) )
+            return 5;
+    }
+
+    return 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file testParameterUpdates.cpp
+ * @brief Test Harness for Live Parameter Updates
+ *
+ * Output of a CombGenerator adopting published parameters is compared against that of a reference CombGenerator
+ * producing the same series by other means, with an envelope functor for crossfades, or with a `reset` and a seek
+ * for new starting phases. The delta must be within a few units of rounding relative to the sum of the harmonic
+ * magnitudes. We also publish from another thread while samples are being produced.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 21;
+    constexpr double fundamentalRadiansPerSample = M_PI / 64.0 * 1.0137;
+
+    // Magnitudes of the crossfade from one magnitude vector to another, as documented, for a reference generator.
+    class CrossfadeEnvelope
+    {
+    public:
+        CrossfadeEnvelope( CombGeneratorScalarVectorType theFrom, CombGeneratorScalarVectorType theTo,
+                           size_t theStart, size_t theLength, size_t maxSamples )
+          : from{ std::move( theFrom ) }, to{ std::move( theTo ) }, start{ theStart }, length{ theLength }
+          , buffers( numHarmonics, std::vector< double >( maxSamples ) )
+        {
+        }
+
+        const double * operator()( size_t currentSample, size_t numSamples, size_t nHarmonic, double )
+        {
+            auto & buffer = buffers[ nHarmonic ];
+            for ( size_t i = 0; numSamples != i; ++i )
+            {
+                const auto n = currentSample + i;
+                const auto ramp = n < start ? 0.0 : std::min( double( n - start + 1 ) / double( length ), 1.0 );
+                buffer[i] = ramp < 1.0 ? from[ nHarmonic ] + ( to[ nHarmonic ] - from[ nHarmonic ] ) * ramp
+                                       : to[ nHarmonic ];
+            }
+            return buffer.data();
+        }
+
+    private:
+        CombGeneratorScalarVectorType from;
+        CombGeneratorScalarVectorType to;
+        size_t start;
+        size_t length;
+        std::vector< std::vector< double > > buffers;
+    };
+
+    bool compare( const FlyingPhasorElementType * pA, const FlyingPhasorElementType * pB, size_t numSamples,
+                  double sumOfMagnitudes, const char * pTestName )
+    {
+        return compareToExpected( pA, 0, numSamples, [ pB ]( size_t sampleIndex ) { return pB[ sampleIndex ]; },
+                                  summationTolerance * sumOfMagnitudes, pTestName );
+    }
+
+    // Magnitudes are updated part way through, with and without a crossfade. Chunks straddle the crossfade.
+    int testMagnitudeUpdate( CombGeneratorEngineType engineType, size_t numThreads, size_t crossfadeSamples,
+                             int failCode )
+    {
+        constexpr size_t numSamples = 3000;
+        constexpr size_t updateSample = 1000;
+        const auto mags1 = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto mags2 = makeVector( numHarmonics, -0.5, 0.25 );
+        const auto phases = makeVector( numHarmonics, 2.0, -1.0 );
+
+        CombGenerator updatedGenerator{ numHarmonics, engineType, numThreads, 100 };
+        updatedGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags1, phases );
+
+        // The reference ramps its magnitudes with an envelope. A zero length ramp is a step.
+        CrossfadeEnvelope crossfadeEnvelope{ mags1, mags2, updateSample, std::max( crossfadeSamples, size_t( 1 ) ),
+                                             numSamples };
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags1, phases,
+                                  std::ref( crossfadeEnvelope ) );
+
+        std::unique_ptr< FlyingPhasorElementType[] > updatedBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        size_t offset = 0;
+        for ( size_t chunkSize : { size_t( 600 ), size_t( 400 ), size_t( 300 ), size_t( 3 ), size_t( 1697 ) } )
+        {
+            if ( updateSample == offset )
+                updatedGenerator.publishParameters( mags2, nullptr, crossfadeSamples );
+            updatedGenerator.getSamples( updatedBuffer.get() + offset, chunkSize );
+            referenceGenerator.getSamples( referenceBuffer.get() + offset, chunkSize );
+            offset += chunkSize;
+        }
+
+        const auto sumOfMagnitudes = std::max( sumOf( mags1, numHarmonics ), sumOf( mags2, numHarmonics ) );
+        if ( !compare( updatedBuffer.get(), referenceBuffer.get(), numSamples, sumOfMagnitudes,
+                       "Magnitude Update Test" ) )
+            return failCode;
+
+        return 0;
+    }
+
+    // New starting phases move each harmonic to where it would be had it been reset with them.
+    int testPhaseUpdate( CombGeneratorEngineType engineType, int failCode )
+    {
+        constexpr size_t numSamples = 500;
+        constexpr size_t updateSample = 700;
+        const auto mags1 = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto mags2 = makeVector( numHarmonics, 0.5, 0.5 );
+        const auto phases1 = makeVector( numHarmonics, 2.0, -1.0 );
+        const auto phases2 = makeVector( numHarmonics, -3.0, 1.5 );
+
+        CombGenerator updatedGenerator{ numHarmonics, engineType };
+        updatedGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags1, phases1 );
+        std::unique_ptr< FlyingPhasorElementType[] > updatedBuffer{ new FlyingPhasorElementType[ updateSample ] };
+        updatedGenerator.getSamples( updatedBuffer.get(), updateSample );
+        updatedGenerator.publishParameters( mags2, phases2 );
+        updatedGenerator.getSamples( updatedBuffer.get(), numSamples );
+
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags2, phases2 );
+        referenceGenerator.seekTo( updateSample );
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        referenceGenerator.getSamples( referenceBuffer.get(), numSamples );
+
+        if ( !compare( updatedBuffer.get(), referenceBuffer.get(), numSamples, sumOf( mags2, numHarmonics ),
+                       "Phase Update Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Magnitude updates without a crossfade.
+    int testResult = testMagnitudeUpdate( CombGeneratorEngineType::PhasorBank, 1, 0, 1 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testMagnitudeUpdate( CombGeneratorEngineType::FusedKernel, 1, 0, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - Magnitude updates with a crossfade spanning several chunks.
+    testResult = testMagnitudeUpdate( CombGeneratorEngineType::PhasorBank, 1, 500, 2 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testMagnitudeUpdate( CombGeneratorEngineType::FusedKernel, 1, 500, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - A crossfade applied by harmonic partitioned synthesis.
+    testResult = testMagnitudeUpdate( CombGeneratorEngineType::FusedKernel, 3, 777, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Starting phase updates.
+    testResult = testPhaseUpdate( CombGeneratorEngineType::PhasorBank, 4 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testPhaseUpdate( CombGeneratorEngineType::FusedKernel, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - Publication from another thread while samples are produced. Once the publishing thread is done,
+    // the last publication is adopted and a further publication takes effect as any other would.
+    {
+        constexpr size_t chunkSize = 128;
+        // The third harmonic of the second is zero. Publishing it must not cull the harmonic, which would reset
+        // the engine and seek the phasors.
+        const auto mags1 = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto mags2 = makeVector( numHarmonics, -0.5, 0.25 );
+        const auto mags3 = makeVector( numHarmonics, 0.75, 0.125 );
+        CombGenerator updatedGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        updatedGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags1, nullptr );
+
+        std::atomic< bool > done{};
+        std::thread publisher{ [ & ]()
+        {
+            for ( size_t i = 0; !done; ++i )
+                updatedGenerator.publishParameters( i & 0x1 ? mags1 : mags2, nullptr, i % 3 * 50 );
+        } };
+        std::unique_ptr< FlyingPhasorElementType[] > updatedBuffer{ new FlyingPhasorElementType[ chunkSize ] };
+        size_t numChunks = 0;
+        for ( ; 2000 != numChunks; ++numChunks )
+            updatedGenerator.getSamples( updatedBuffer.get(), chunkSize );
+        done = true;
+        publisher.join();
+
+        updatedGenerator.publishParameters( mags3, nullptr );
+        updatedGenerator.getSamples( updatedBuffer.get(), chunkSize );
+
+        // Magnitudes do not alter the phasor trajectory, which depends only upon the chunking.
+        CombGenerator referenceGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags3, nullptr );
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ chunkSize ] };
+        for ( size_t i = 0; numChunks + 1 != i; ++i )
+            referenceGenerator.getSamples( referenceBuffer.get(), chunkSize );
+
+        if ( !compare( updatedBuffer.get(), referenceBuffer.get(), chunkSize, sumOf( mags3, numHarmonics ),
+                       "Concurrent Publication Test" ) )
+            return 5;
+    }
+
+    // Test 6 - A reset discards a publication not yet adopted.
+    {
+        const auto mags1 = makeVector( numHarmonics, 1.0, 0.0 );
+        const auto mags2 = makeVector( numHarmonics, -0.5, 0.25 );
+        CombGenerator updatedGenerator{ numHarmonics, CombGeneratorEngineType::PhasorBank };
+        updatedGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags1, nullptr );
+        updatedGenerator.publishParameters( mags2, nullptr, 100 );
+        updatedGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags1, nullptr );
+
+        CombGenerator referenceGenerator{ numHarmonics, CombGeneratorEngineType::PhasorBank };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags1, nullptr );
+
+        FlyingPhasorElementType updatedBuffer[ 200 ];
+        FlyingPhasorElementType referenceBuffer[ 200 ];
+        updatedGenerator.getSamples( updatedBuffer, 200 );
+        referenceGenerator.getSamples( referenceBuffer, 200 );
+        if ( !compare( updatedBuffer, referenceBuffer, 200, sumOf( mags1, numHarmonics ), "Reset Discard Test" ) )
+            return 6;
+    }
+
+    // Test 7 - Engines unable to apply updates reject them.
+    {
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::ClosedForm };
+        combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, nullptr, nullptr );
+        bool threw = false;
+        try { combGenerator.publishParameters( nullptr, nullptr ); }
+        catch ( const std::logic_error & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a parameter update for the ClosedForm engine." << std::endl;
+            return 7;
+        }
+    }
+
+    return 0;
+}
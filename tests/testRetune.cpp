@@ -0,0 +1,177 @@
+/**
+ * @file testRetune.cpp
+ * @brief Test Harness for the Retune Operation
+ *
+ * A CombGenerator retuned part way through must continue as a reference CombGenerator does, reset with the new
+ * fundamental and the starting phases documented for a retune, then sought to the retune sample. We also verify
+ * that the first sample after a retune continues each harmonic from its phase before it, and that a clone
+ * continues the retuned series.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+#include "PhaseArithmetic.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t retuneSample = 777;
+    constexpr size_t numSamples = 1000;
+
+    struct Series
+    {
+        CombGeneratorScalarVectorType magVector;
+        CombGeneratorScalarVectorType phaseVector;
+        double sumOfMagnitudes;
+    };
+
+    // Equal magnitudes and linear phases are required by the closed form engine. Otherwise, vary them.
+    Series makeSeries( size_t numHarmonics, bool linearPhase )
+    {
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = linearPhase ? 2.0 : 1.0 / double( i + 1 );
+            phases[i] = linearPhase ? 0.3 + 0.1 * double( i ) : std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        return Series{ CombGeneratorScalarVectorType{ std::move( magnitudes ) },
+                       CombGeneratorScalarVectorType{ std::move( phases ) }, sumOfMagnitudes };
+    }
+
+    // The starting phases which continue each harmonic at the new rate from the retune sample.
+    CombGeneratorScalarVectorType retunedPhases( const Series & series, size_t numHarmonics,
+                                                 double oldRadiansPerSample, double newRadiansPerSample )
+    {
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            phases[i] = PhaseArithmetic::retunedPhase( series.phaseVector[i], double( i + 1 ) * oldRadiansPerSample,
+                                                       double( i + 1 ) * newRadiansPerSample, retuneSample );
+        return CombGeneratorScalarVectorType{ std::move( phases ) };
+    }
+
+    bool compare( const FlyingPhasorElementType * pA, const FlyingPhasorElementType * pB, size_t count,
+                  double sumOfMagnitudes, const char * pTestName )
+    {
+        return compareToExpected( pA, 0, count, [ pB ]( size_t sampleIndex ) { return pB[ sampleIndex ]; },
+                                  directSumTolerance * sumOfMagnitudes, pTestName );
+    }
+
+    int testRetune( CombGeneratorEngineType engineType, size_t numHarmonics, bool linearPhase, int failCode )
+    {
+        const double oldRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * 1.0137;
+        const double newRadiansPerSample = oldRadiansPerSample * 0.8123;
+        const auto series = makeSeries( numHarmonics, linearPhase );
+
+        // The retuned generator is one larger than needed. Its spare generator must be left alone.
+        CombGenerator retunedGenerator{ numHarmonics + 1, engineType };
+        retunedGenerator.reset( numHarmonics, oldRadiansPerSample, series.magVector, series.phaseVector );
+        std::unique_ptr< FlyingPhasorElementType[] > retunedBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        retunedGenerator.getSamples( retunedBuffer.get(), retuneSample );
+        retunedGenerator.retune( newRadiansPerSample );
+        if ( retuneSample != retunedGenerator.getSampleCount() )
+        {
+            std::cout << "Failed sample count after retuning with " << retunedGenerator.getSampleCount() << "."
+                      << std::endl;
+            return failCode;
+        }
+        retunedGenerator.getSamples( retunedBuffer.get(), numSamples );
+
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        referenceGenerator.reset( numHarmonics, newRadiansPerSample, series.magVector,
+                                  retunedPhases( series, numHarmonics, oldRadiansPerSample, newRadiansPerSample ) );
+        referenceGenerator.seekTo( retuneSample );
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        referenceGenerator.getSamples( referenceBuffer.get(), numSamples );
+        if ( !compare( retunedBuffer.get(), referenceBuffer.get(), numSamples, series.sumOfMagnitudes,
+                       "Retune Test" ) )
+            return failCode;
+
+        // Seeking back extrapolates at the new rate, as the reference does.
+        retunedGenerator.seekTo( 100 );
+        referenceGenerator.seekTo( 100 );
+        retunedGenerator.getSamples( retunedBuffer.get(), numSamples );
+        referenceGenerator.getSamples( referenceBuffer.get(), numSamples );
+        if ( !compare( retunedBuffer.get(), referenceBuffer.get(), numSamples, series.sumOfMagnitudes,
+                       "Retune Seek Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - The phasor bank engine.
+    int testResult = testRetune( CombGeneratorEngineType::PhasorBank, 12, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - The fused kernel engine.
+    testResult = testRetune( CombGeneratorEngineType::FusedKernel, 37, false, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - The closed form engine.
+    testResult = testRetune( CombGeneratorEngineType::ClosedForm, 37, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - The inverse FFT engine.
+    testResult = testRetune( CombGeneratorEngineType::InverseFft, 600, false, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - Phase continuity. The sample at the retune has each harmonic at the phase it would have had
+    // without it. The next is each advanced by its new rate.
+    {
+        constexpr size_t numHarmonics = 5;
+        const double oldRadiansPerSample = 0.05;
+        const double newRadiansPerSample = 0.0731;
+        const auto series = makeSeries( numHarmonics, false );
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        combGenerator.reset( numHarmonics, oldRadiansPerSample, series.magVector, series.phaseVector );
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ retuneSample ] };
+        combGenerator.getSamples( buffer.get(), retuneSample );
+        combGenerator.retune( newRadiansPerSample );
+        FlyingPhasorElementType samples[ 2 ];
+        combGenerator.getSamples( samples, 2 );
+
+        FlyingPhasorElementType expected[ 2 ]{};
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            const auto phase = series.phaseVector[i] + double( i + 1 ) * oldRadiansPerSample * double( retuneSample );
+            expected[0] += std::polar( series.magVector[i], phase );
+            expected[1] += std::polar( series.magVector[i], phase + double( i + 1 ) * newRadiansPerSample );
+        }
+        if ( !compare( samples, expected, 2, series.sumOfMagnitudes, "Phase Continuity Test" ) )
+            return 5;
+    }
+
+    // Test 6 - A clone of a retuned generator continues the retuned series.
+    {
+        constexpr size_t numHarmonics = 9;
+        const auto series = makeSeries( numHarmonics, false );
+        CombGenerator retunedGenerator{ numHarmonics, CombGeneratorEngineType::PhasorBank };
+        retunedGenerator.reset( numHarmonics, 0.04, series.magVector, series.phaseVector );
+        std::unique_ptr< FlyingPhasorElementType[] > retunedBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        retunedGenerator.getSamples( retunedBuffer.get(), retuneSample );
+        retunedGenerator.retune( 0.061 );
+        auto clonedGenerator = retunedGenerator.clone();
+        retunedGenerator.getSamples( retunedBuffer.get(), numSamples );
+        std::unique_ptr< FlyingPhasorElementType[] > clonedBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        clonedGenerator.getSamples( clonedBuffer.get(), numSamples );
+        if ( !compare( retunedBuffer.get(), clonedBuffer.get(), numSamples, series.sumOfMagnitudes,
+                       "Retuned Clone Test" ) )
+            return 6;
+    }
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file testScintillationEngine.cpp
+ * @brief Test Harness for the Scintillation Engine of the Test Utilities
+ *
+ * The scintillation engine was rebuilt around structure of arrays state, evaluating each envelope from its distance
+ * into a decorrelation interval rather than accumulating a slope sample by sample. Reference envelopes below were
+ * captured from the previous, per harmonic, implementation. It drew each harmonic's next target magnitude at every
+ * boundary, ramping to it over the interval that follows, from an initial magnitude of zero. Boundary `b` of the
+ * present engine is therefore the target drawn at boundary `b - 1`, and boundary zero is zero. Targets are drawn from
+ * a fixed seed of std::mt19937, whose output the standard specifies. Envelopes got whole, in chunks, harmonic major
+ * or sample major and over harmonic ranges must be within a few units of rounding of the reference.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "ScintillationEngine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t numHarmonics = 3;
+    constexpr size_t numSamples = 40;
+    constexpr size_t decorrelationSamples = 8;
+    constexpr double tolerance = 2e-13;
+
+    // Captured from the previous implementation, harmonic major.
+    constexpr double referenceEnvelopes[ numHarmonics ][ numSamples ] =
+    {
+        {
+            0, 0.092178028222406283, 0.18435605644481257, 0.27653408466721885,
+            0.36871211288962513, 0.46089014111203142, 0.5530681693344377, 0.64524619755684398,
+            0.73742422577925026, 0.82810289808548987, 0.91878157039172947, 1.0094602426979691,
+            1.1001389150042087, 1.1908175873104483, 1.2814962596166879, 1.3721749319229275,
+            1.4628536042291671, 1.4875746375910239, 1.5122956709528808, 1.5370167043147376,
+            1.5617377376765944, 1.5864587710384512, 1.6111798044003081, 1.6359008377621649,
+            1.6606218711240217, 1.5294893878162839, 1.398356904508546, 1.2672244212008081,
+            1.1360919378930703, 1.0049594545853324, 0.87382697127759457, 0.74269448796985671,
+            0.61156200466211885, 0.73774324367695954, 0.86392448269180022, 0.99010572170664091,
+            1.1162869607214816, 1.2424681997363223, 1.368649438751163, 1.4948306777660036
+        },
+        {
+            0, 0.084970509400591254, 0.16994101880118251, 0.25491152820177376,
+            0.33988203760236502, 0.42485254700295627, 0.50982305640354753, 0.59479356580413878,
+            0.67976407520473003, 0.68863118723675143, 0.69749829926877283, 0.70636541130079422,
+            0.71523252333281562, 0.72409963536483701, 0.73296674739685841, 0.7418338594288798,
+            0.7507009714609012, 0.83470134189701639, 0.91870171233313158, 1.0027020827692468,
+            1.086702453205362, 1.1707028236414772, 1.2547031940775923, 1.3387035645137075,
+            1.4227039349498227, 1.3056281602184754, 1.188552385487128, 1.0714766107557807,
+            0.95440083602443337, 0.83732506129308604, 0.7202492865617387, 0.60317351183039136,
+            0.48609773709904402, 0.57982094390899874, 0.67354415071895346, 0.76726735752890818,
+            0.8609905643388629, 0.95471377114881761, 1.0484369779587723, 1.142160184768727
+        },
+        {
+            0, 0.13052688899915665, 0.26105377799831331, 0.39158066699746996,
+            0.52210755599662662, 0.65263444499578327, 0.78316133399493992, 0.91368822299409658,
+            1.0442151119932532, 1.0413486533798277, 1.0384821947664022, 1.0356157361529768,
+            1.0327492775395513, 1.0298828189261258, 1.0270163603127003, 1.0241499016992748,
+            1.0212834430858493, 0.98773009328579064, 0.954176743485732, 0.92062339368567336,
+            0.88707004388561472, 0.85351669408555608, 0.81996334428549744, 0.7864099944854388,
+            0.75285664468538016, 0.81449317418446299, 0.87612970368354581, 0.93776623318262864,
+            0.99940276268171147, 1.0610392921807943, 1.1226758216798771, 1.1843123511789599,
+            1.2459488806780428, 1.2570777669461677, 1.2682066532142926, 1.2793355394824175,
+            1.2904644257505424, 1.3015933120186673, 1.3127221982867923, 1.3238510845549172
+        }
+    };
+
+    // The targets of each harmonic, drawn harmonic by harmonic as the reference was.
+    std::vector< std::vector< double > > makeTargets()
+    {
+        std::mt19937 generator{ 4242 };
+        std::vector< std::vector< double > > targets( numHarmonics );
+        for ( auto & harmonicTargets : targets )
+            for ( size_t b = 0; numSamples / decorrelationSamples + 1 != b; ++b )
+                harmonicTargets.push_back( 0.25 + 1.5 * double( generator() ) / 4294967296.0 );
+        return targets;
+    }
+
+    // An envelope buffer, indexed by harmonic and sample, compared against the reference.
+    bool compareToReference( const std::vector< double > & envelopes, size_t harmonicStride, size_t sampleStride,
+                             const char * pTestName )
+    {
+        for ( size_t h = 0; numHarmonics != h; ++h )
+        {
+            for ( size_t n = 0; numSamples != n; ++n )
+            {
+                const auto delta = std::abs( envelopes[ h * harmonicStride + n * sampleStride ] -
+                                             referenceEnvelopes[h][n] );
+                if ( tolerance < delta )
+                {
+                    std::cout << "Failed " << pTestName << " for harmonic " << h << " at sample index " << n
+                              << " with a delta of " << delta << "." << std::endl;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    const auto targets = makeTargets();
+    const ScintillationEngine::ScintillateFunkType scintillateFunk =
+        [ &targets ]( double * pMagnitudes, size_t firstHarmonic, size_t numRangeHarmonics, size_t boundaryIndex )
+    {
+        for ( size_t h = 0; numRangeHarmonics != h; ++h )
+            pMagnitudes[h] = boundaryIndex ? targets[ firstHarmonic + h ][ boundaryIndex - 1 ] : 0.0;
+    };
+
+    ScintillationEngine engine{ numHarmonics };
+    engine.reset( decorrelationSamples );
+    std::vector< double > envelopes( numHarmonics * numSamples );
+
+    // Test 1 - Harmonic major, every harmonic and every sample at once.
+    engine.run( envelopes.data(), numSamples, 1, 0, numSamples, 0, numHarmonics, scintillateFunk );
+    if ( !compareToReference( envelopes, numSamples, 1, "Whole Envelope Test" ) )
+        return 1;
+
+    // Test 2 - Harmonic major, in chunks beginning and ending on and off decorrelation boundaries.
+    std::fill( envelopes.begin(), envelopes.end(), -1.0 );
+    size_t sampleCounter = 0;
+    for ( size_t chunkSize : { 5, 3, 1, 15, 16 } )
+    {
+        engine.run( envelopes.data() + sampleCounter, numSamples, 1, sampleCounter, chunkSize, 0, numHarmonics,
+                    scintillateFunk );
+        sampleCounter += chunkSize;
+    }
+    if ( !compareToReference( envelopes, numSamples, 1, "Chunked Envelope Test" ) )
+        return 2;
+
+    // Test 3 - Sample major, over two harmonic ranges.
+    std::fill( envelopes.begin(), envelopes.end(), -1.0 );
+    engine.run( envelopes.data(), 1, numHarmonics, 0, numSamples, 0, 1, scintillateFunk );
+    engine.run( envelopes.data() + 1, 1, numHarmonics, 0, numSamples, 1, numHarmonics - 1, scintillateFunk );
+    if ( !compareToReference( envelopes, 1, numHarmonics, "Sample Major Envelope Test" ) )
+        return 3;
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file testScintillationStreams.cpp
+ * @brief Test Harness for Reproducible Scintillation Envelopes
+ *
+ * The scintillation envelope functor of the test utilities draws the magnitude of each harmonic, at each
+ * decorrelation boundary, from a counter based stream of the seed, the harmonic and the boundary. Its envelopes
+ * must therefore be bit identical however they are requested, whole or in chunks of any size, a harmonic at a time
+ * or as a batch over harmonic ranges, and by any number of threads. CombGenerator output is compared across thread
+ * counts and chunk sizes, to within a few units of rounding relative to the sum of the nominal magnitudes, as
+ * synthesis itself rounds differently by chunk and harmonic range.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "CombScintillationEnvelopeFunctor.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numHarmonics = 23;
+    constexpr size_t mutedHarmonic = 4;
+    constexpr size_t decorrelationSamples = 97;
+    constexpr size_t numSamples = 6000;
+    constexpr size_t maxEpochSize = 4096;
+    constexpr uint32_t seed = 4242;
+    constexpr double fundamentalRadiansPerSample = 0.0123;
+
+    // Chunk sizes begin and end invocations on and off decorrelation boundaries.
+    constexpr size_t wholeChunkSizes[] = { 4096, 1904 };
+    constexpr size_t oddChunkSizes[] = { 1, 96, 97, 1000, 3, 2048, 2755 };
+
+    CombGeneratorScalarVectorType makeMags()
+    {
+        std::unique_ptr< double[] > values{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            values[i] = mutedHarmonic == i ? 0.0 : 1.0 / double( i + 1 );
+        return CombGeneratorScalarVectorType{ std::move( values ) };
+    }
+
+    CombGeneratorScalarVectorType makePhases()
+    {
+        std::unique_ptr< double[] > values{ new double[ numHarmonics ] };
+        for ( size_t i = 0; numHarmonics != i; ++i )
+            values[i] = 0.3 * double( i ) - 1.0;
+        return CombGeneratorScalarVectorType{ std::move( values ) };
+    }
+
+    // The sample major envelope matrix, got in chunks, a harmonic at a time or for every harmonic at once.
+    template< size_t numChunks >
+    std::vector< double > getEnvelopes( const size_t ( & chunkSizes )[ numChunks ], bool perHarmonic,
+                                        uint32_t theSeed )
+    {
+        CombScintillationEnvelopeFunctor functor{ numHarmonics, maxEpochSize };
+        functor.reset( numHarmonics, decorrelationSamples, makeMags(), theSeed );
+
+        std::vector< double > envelopes( numSamples * numHarmonics );
+        size_t offset = 0;
+        for ( auto chunkSize : chunkSizes )
+        {
+            auto pRows = envelopes.data() + offset * numHarmonics;
+            if ( perHarmonic )
+            {
+                // Harmonics are invoked in reverse, as no thread is obliged to invoke them in order.
+                for ( size_t h = numHarmonics; 0 != h--; )
+                {
+                    auto pEnvelope = functor( offset, chunkSize, h, 0.0 );
+                    for ( size_t n = 0; chunkSize != n; ++n )
+                        pRows[ n * numHarmonics + h ] = pEnvelope ? pEnvelope[n] : 0.0;
+                }
+            }
+            else
+                functor.fillEnvelopeMatrix( offset, chunkSize, 0, numHarmonics, pRows, numHarmonics );
+            offset += chunkSize;
+        }
+        return envelopes;
+    }
+
+    template< size_t numChunks >
+    std::vector< FlyingPhasorElementType > getSamples( const size_t ( & chunkSizes )[ numChunks ], bool perHarmonic,
+                                                       size_t numThreads )
+    {
+        CombScintillationEnvelopeFunctor functor{ numHarmonics, maxEpochSize };
+        const auto mags = makeMags();
+        functor.reset( numHarmonics, decorrelationSamples, mags, seed );
+
+        CombGenerator combGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel, numThreads, 100 };
+        if ( perHarmonic )
+            combGenerator.reset( numHarmonics, fundamentalRadiansPerSample, mags, makePhases(), std::ref( functor ) );
+        else
+            combGenerator.resetWithBatchEnvelope( numHarmonics, fundamentalRadiansPerSample, mags, makePhases(),
+                [ &functor ]( size_t currentSample, size_t blockSamples, size_t firstHarmonic, size_t rangeHarmonics,
+                              double * pEnvelopeMatrix, size_t stride )
+                {
+                    functor.fillEnvelopeMatrix( currentSample, blockSamples, firstHarmonic, rangeHarmonics,
+                                                pEnvelopeMatrix, stride );
+                } );
+
+        std::vector< FlyingPhasorElementType > samples( numSamples );
+        size_t offset = 0;
+        for ( auto chunkSize : chunkSizes )
+        {
+            combGenerator.getSamples( samples.data() + offset, chunkSize );
+            offset += chunkSize;
+        }
+        return samples;
+    }
+
+    bool compareSamples( const std::vector< FlyingPhasorElementType > & samples,
+                         const std::vector< FlyingPhasorElementType > & reference, const char * pTestName )
+    {
+        return compareToExpected( samples.data(), 0, numSamples,
+                                  [ &reference ]( size_t sampleIndex ) { return reference[ sampleIndex ]; },
+                                  summationTolerance * sumOf( makeMags(), numHarmonics ), pTestName );
+    }
+}
+
+int main()
+{
+    const auto reference = getEnvelopes( wholeChunkSizes, false, seed );
+
+    // Test 1 - Envelopes are continuous, ramping linearly between boundaries, and the muted harmonic is zero.
+    for ( size_t h = 0; numHarmonics != h; ++h )
+    {
+        for ( size_t n = 1; numSamples - 1 != n; ++n )
+        {
+            const auto envelope = reference[ n * numHarmonics + h ];
+            const auto secondDifference = reference[ ( n + 1 ) * numHarmonics + h ] - 2.0 * envelope +
+                                          reference[ ( n - 1 ) * numHarmonics + h ];
+            if ( ( mutedHarmonic == h ) != ( 0.0 == envelope ) || envelope < 0.0 ||
+                 ( 0 != n % decorrelationSamples && 1e-12 < std::abs( secondDifference ) ) )
+            {
+                std::cout << "Failed Scintillation Ramp Test for harmonic " << h << " at sample index " << n << "."
+                          << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // Test 2 - Bit identical envelopes in any chunking, a harmonic at a time or at once.
+    for ( auto perHarmonic : { false, true } )
+    {
+        if ( reference != getEnvelopes( oddChunkSizes, perHarmonic, seed ) ||
+             reference != getEnvelopes( wholeChunkSizes, perHarmonic, seed ) )
+        {
+            std::cout << "Failed Scintillation Chunking Test, " << ( perHarmonic ? "per harmonic" : "batch" )
+                      << " form." << std::endl;
+            return 2;
+        }
+    }
+
+    // Test 3 - Another seed draws other envelopes.
+    if ( reference == getEnvelopes( wholeChunkSizes, false, seed + 1 ) )
+    {
+        std::cout << "Failed Scintillation Seed Test." << std::endl;
+        return 3;
+    }
+
+    // Test 4 - Samples to within rounding in any chunking, by any number of threads, the functor being invoked
+    // concurrently for harmonic ranges.
+    for ( auto perHarmonic : { false, true } )
+    {
+        const auto referenceSamples = getSamples( wholeChunkSizes, perHarmonic, 1 );
+        for ( size_t numThreads : { 1, 2, 3 } )
+        {
+            if ( !compareSamples( getSamples( oddChunkSizes, perHarmonic, numThreads ), referenceSamples,
+                                  "Scintillation Thread Test" ) )
+                return 4;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file testSeek.cpp
+ * @brief Test Harness for the Skip Samples and Seek To Operations
+ *
+ * Samples produced after skipping forward, or seeking back to the start, must be those a second CombGenerator
+ * produces by getting every sample in between, in every engine. Seeking computes phases directly rather than by
+ * recursion, so the two agree only to the rounding of each. We also verify the sample count reported and that
+ * seen by an envelope functor.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <memory>
+#include <cmath>
+#include <iostream>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    int testSeek( CombGeneratorEngineType engineType, size_t numHarmonics, bool linearPhase, int failCode )
+    {
+        // Equal magnitudes and linear phases are required by the closed form engine. Otherwise, vary them.
+        const double fundamentalRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * 1.0137;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = linearPhase ? 2.0 : 1.0 / double( i + 1 );
+            phases[i] = linearPhase ? 0.3 + 0.1 * double( i )
+                                    : std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        CombGenerator seekingGenerator{ numHarmonics, engineType };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases );
+        seekingGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases );
+        if ( engineType != seekingGenerator.getActiveEngineType() )
+        {
+            std::cout << "Failed active engine type query." << std::endl;
+            return failCode;
+        }
+
+        // Capture the first epoch for comparison after seeking backwards.
+        constexpr size_t epochSize = 1000;
+        std::unique_ptr< FlyingPhasorElementType[] > firstBuffer{ new FlyingPhasorElementType[ epochSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ epochSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > seekBuffer{ new FlyingPhasorElementType[ epochSize ] };
+        referenceGenerator.getSamples( firstBuffer.get(), epochSize );
+
+        // The reference gets every sample. The seeking generator skips all but the last epoch.
+        // Both are then positioned at the start of the last epoch.
+        constexpr size_t numEpochs = 100;
+        for ( size_t epoch = 2; numEpochs != epoch; ++epoch )
+            referenceGenerator.getSamples( referenceBuffer.get(), epochSize );
+        seekingGenerator.skipSamples( epochSize );
+        seekingGenerator.skipSamples( ( numEpochs - 2 ) * epochSize );
+        if ( ( numEpochs - 1 ) * epochSize != seekingGenerator.getSampleCount() )
+        {
+            std::cout << "Failed sample count after skipping with " << seekingGenerator.getSampleCount() << "." << std::endl;
+            return failCode;
+        }
+
+        // Compare the last epoch.
+        referenceGenerator.getSamples( referenceBuffer.get(), epochSize );
+        seekingGenerator.getSamples( seekBuffer.get(), epochSize );
+        constexpr size_t lastEpochSample = ( numEpochs - 1 ) * epochSize;
+        if ( !compareToExpected( seekBuffer.get(), lastEpochSample, epochSize,
+                                 [ & ]( size_t sampleIndex )
+                                 {
+                                     return referenceBuffer[ sampleIndex - lastEpochSample ];
+                                 },
+                                 directSumTolerance * sumOfMagnitudes, "Skip Test" ) )
+            return failCode;
+
+        // Seek back to the start and compare the first epoch.
+        seekingGenerator.seekTo( 0 );
+        seekingGenerator.getSamples( seekBuffer.get(), epochSize );
+        if ( !compareToExpected( seekBuffer.get(), 0, epochSize,
+                                 [ & ]( size_t sampleIndex ) { return firstBuffer[ sampleIndex ]; },
+                                 directSumTolerance * sumOfMagnitudes, "Seek To Test" ) )
+            return failCode;
+        if ( epochSize != seekingGenerator.getSampleCount() )
+        {
+            std::cout << "Failed sample count after seeking with " << seekingGenerator.getSampleCount() << "." << std::endl;
+            return failCode;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - The phasor bank engine.
+    int testResult = testSeek( CombGeneratorEngineType::PhasorBank, 12, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - The fused kernel engine.
+    testResult = testSeek( CombGeneratorEngineType::FusedKernel, 37, false, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - The closed form engine.
+    testResult = testSeek( CombGeneratorEngineType::ClosedForm, 37, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - The inverse FFT engine.
+    testResult = testSeek( CombGeneratorEngineType::InverseFft, 600, false, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - An envelope functor sees the sample index after seeking, for each engine supporting envelopes.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        constexpr size_t numSamples = 16;
+        double envelope[ numSamples ];
+        for ( auto & value : envelope ) value = 1.0;
+        size_t lastCurrentSample = 0;
+        auto envelopeFunk = [ &envelope, &lastCurrentSample ]( size_t currentSample, size_t, size_t, double )
+        {
+            lastCurrentSample = currentSample;
+            return static_cast< const double * >( envelope );
+        };
+
+        CombGenerator combGenerator{ 4, engineType };
+        combGenerator.reset( 3, M_PI / 8.0, nullptr, nullptr, envelopeFunk );
+        FlyingPhasorElementType sampleBuffer[ numSamples ];
+        combGenerator.getSamples( sampleBuffer, numSamples );
+        combGenerator.seekTo( 123456789 );
+        combGenerator.getSamples( sampleBuffer, numSamples );
+        if ( 123456789 != lastCurrentSample || 123456789 + numSamples != combGenerator.getSampleCount() )
+        {
+            std::cout << "Failed envelope functor current sample after seeking with " << lastCurrentSample
+                      << "." << std::endl;
+            return 5;
+        }
+    }
+
+    // Test 6 - Sample counts advance without harmonics and return to zero on reset.
+    {
+        CombGenerator combGenerator{ 4 };
+        constexpr size_t numSamples = 16;
+        FlyingPhasorElementType sampleBuffer[ numSamples ];
+        combGenerator.getSamples( sampleBuffer, numSamples );
+        combGenerator.accumSamples( sampleBuffer, numSamples );
+        combGenerator.skipSamples( numSamples );
+        if ( 3 * numSamples != combGenerator.getSampleCount() )
+        {
+            std::cout << "Failed sample count without harmonics with " << combGenerator.getSampleCount() << "." << std::endl;
+            return 6;
+        }
+
+        combGenerator.reset();
+        if ( 0 != combGenerator.getSampleCount() )
+        {
+            std::cout << "Failed sample count after pure reset with " << combGenerator.getSampleCount() << "." << std::endl;
+            return 6;
+        }
+    }
+
+    return 0;
+}
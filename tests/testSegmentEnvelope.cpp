@@ -0,0 +1,236 @@
+/**
+ * @file testSegmentEnvelope.cpp
+ * @brief Test Harness for Segment Envelope Functors
+ *
+ * Output of a CombGenerator reset with a segment envelope functor is compared against that of one reset with
+ * the equivalent per harmonic envelope functor. Envelopes are piecewise linear in the sample count, with breakpoints
+ * at a period particular to each harmonic, so both forms apply the same envelopes and the delta must be within
+ * a few units of rounding relative to the sum of the harmonic magnitudes. One harmonic is muted throughout.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t mutedHarmonic = 2;
+
+    size_t breakpointPeriod( size_t nHarmonic )
+    {
+        return 37 + 5 * nHarmonic;
+    }
+
+    double breakpointValue( size_t nHarmonic, size_t nBreakpoint )
+    {
+        return 0.75 + 0.25 * std::cos( 0.7 * double( nHarmonic + 1 ) * double( nBreakpoint ) );
+    }
+
+    double breakpointSlope( size_t nHarmonic, size_t nBreakpoint )
+    {
+        return ( breakpointValue( nHarmonic, nBreakpoint + 1 ) - breakpointValue( nHarmonic, nBreakpoint ) ) /
+               double( breakpointPeriod( nHarmonic ) );
+    }
+
+    double envelopeValue( size_t nHarmonic, size_t sampleCount )
+    {
+        const auto period = breakpointPeriod( nHarmonic );
+        const auto nBreakpoint = sampleCount / period;
+        return breakpointValue( nHarmonic, nBreakpoint ) +
+               breakpointSlope( nHarmonic, nBreakpoint ) * double( sampleCount % period );
+    }
+
+    // The per harmonic form, with a buffer per harmonic so that it may be invoked concurrently.
+    class PerHarmonicEnvelope
+    {
+    public:
+        PerHarmonicEnvelope( size_t maxHarmonics, size_t maxSamples )
+          : buffers( maxHarmonics, std::vector< double >( maxSamples ) )
+        {
+        }
+
+        const double * operator()( size_t currentSample, size_t numSamples, size_t nHarmonic, double )
+        {
+            if ( mutedHarmonic == nHarmonic ) return nullptr;
+            auto & buffer = buffers[ nHarmonic ];
+            for ( size_t i = 0; numSamples != i; ++i )
+                buffer[i] = envelopeValue( nHarmonic, currentSample + i );
+            return buffer.data();
+        }
+
+        std::vector< std::vector< double > > buffers;
+    };
+
+    // The segment form, a segment per breakpoint period the block overlaps, with segment storage per harmonic.
+    class SegmentEnvelope
+    {
+    public:
+        explicit SegmentEnvelope( size_t maxHarmonics ) : segments( maxHarmonics ) {}
+
+        CombGeneratorEnvelopeSegmentsType operator()( size_t currentSample, size_t numSamples, size_t nHarmonic,
+                                                      double )
+        {
+            if ( mutedHarmonic == nHarmonic ) return CombGeneratorEnvelopeSegmentsType{};
+
+            const auto period = breakpointPeriod( nHarmonic );
+            auto & list = segments[ nHarmonic ];
+            list.clear();
+            for ( size_t offset = 0; numSamples > offset; )
+            {
+                const auto sampleCount = currentSample + offset;
+                list.push_back( { offset, envelopeValue( nHarmonic, sampleCount ),
+                                  breakpointSlope( nHarmonic, sampleCount / period ) } );
+                offset += period - sampleCount % period;
+            }
+            return CombGeneratorEnvelopeSegmentsType{ list.data(), list.size() };
+        }
+
+        std::vector< std::vector< CombGeneratorEnvelopeSegmentType > > segments;
+    };
+
+    int testAgainstPerHarmonic( CombGeneratorEngineType engineType, size_t numHarmonics, size_t numThreads,
+                                bool accumulate, int failCode )
+    {
+        const double fundamentalRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * 1.0137;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 );
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+
+        constexpr size_t maxChunkSize = 5000;
+        PerHarmonicEnvelope referenceEnvelope{ numHarmonics, maxChunkSize };
+        SegmentEnvelope segmentEnvelope{ numHarmonics };
+
+        CombGenerator referenceGenerator{ numHarmonics, engineType };
+        CombGenerator segmentGenerator{ numHarmonics, engineType, numThreads, 1000 };
+        referenceGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases,
+                                  std::ref( referenceEnvelope ) );
+        segmentGenerator.resetWithSegmentEnvelope( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes,
+                                                   sharedPhases, std::ref( segmentEnvelope ) );
+
+        // Chunk sizes span many breakpoint periods, a few, and less than one.
+        std::unique_ptr< FlyingPhasorElementType[] > referenceBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        std::unique_ptr< FlyingPhasorElementType[] > segmentBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        for ( size_t chunkSize : { size_t( 5000 ), size_t( 300 ), size_t( 41 ), size_t( 3 ), size_t( 1 ) } )
+        {
+            if ( accumulate )
+            {
+                for ( size_t i = 0; chunkSize != i; ++i )
+                    referenceBuffer[i] = segmentBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                referenceGenerator.accumSamples( referenceBuffer.get(), chunkSize );
+                segmentGenerator.accumSamples( segmentBuffer.get(), chunkSize );
+            }
+            else
+            {
+                referenceGenerator.getSamples( referenceBuffer.get(), chunkSize );
+                segmentGenerator.getSamples( segmentBuffer.get(), chunkSize );
+            }
+
+            for ( size_t i = 0; chunkSize != i; ++i )
+            {
+                const auto delta = std::abs( referenceBuffer[i] - segmentBuffer[i] );
+                if ( summationTolerance * sumOfMagnitudes < delta )
+                {
+                    std::cout << "Failed Segment Envelope Test at chunk sample index " << i << " with a delta of "
+                              << delta << "." << std::endl;
+                    return failCode;
+                }
+            }
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - The fused kernel engine, `getSamples`. The harmonic count is not a multiple of the lane width.
+    int testResult = testAgainstPerHarmonic( CombGeneratorEngineType::FusedKernel, 37, 1, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - The phasor bank engine, `accumSamples`.
+    testResult = testAgainstPerHarmonic( CombGeneratorEngineType::PhasorBank, 12, 1, true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - The fused kernel engine, harmonic partitioned over several threads.
+    testResult = testAgainstPerHarmonic( CombGeneratorEngineType::FusedKernel, 100, 3, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - The phasor bank engine, harmonic partitioned over several threads.
+    testResult = testAgainstPerHarmonic( CombGeneratorEngineType::PhasorBank, 13, 4, false, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - Single precision samples follow the double precision samples.
+    {
+        constexpr size_t numHarmonics = 24;
+        constexpr size_t numSamples = 1000;
+        SegmentEnvelope doubleEnvelope{ numHarmonics };
+        SegmentEnvelope singleEnvelope{ numHarmonics };
+        CombGenerator doubleGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        CombGenerator singleGenerator{ numHarmonics, CombGeneratorEngineType::FusedKernel };
+        doubleGenerator.resetWithSegmentEnvelope( numHarmonics, M_PI / 64.0, nullptr, nullptr,
+                                                  std::ref( doubleEnvelope ) );
+        singleGenerator.resetWithSegmentEnvelope( numHarmonics, M_PI / 64.0, nullptr, nullptr,
+                                                  std::ref( singleEnvelope ) );
+
+        std::unique_ptr< FlyingPhasorElementType[] > doubleBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< CombGeneratorSingleElementType[] > singleBuffer{ new CombGeneratorSingleElementType[ numSamples ] };
+        doubleGenerator.getSamples( doubleBuffer.get(), numSamples );
+        singleGenerator.getSamples( singleBuffer.get(), numSamples );
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            const FlyingPhasorElementType single{ singleBuffer[i].real(), singleBuffer[i].imag() };
+            if ( singlePrecisionTolerance * double( numHarmonics ) < std::abs( single - doubleBuffer[i] ) )
+            {
+                std::cout << "Failed Single Precision Segment Envelope Test at sample index " << i << "." << std::endl;
+                return 5;
+            }
+        }
+    }
+
+    // Test 6 - Engine selection. The closed form engine rejects a segment envelope functor, others defer.
+    {
+        SegmentEnvelope segmentEnvelope{ 8 };
+        CombGenerator closedForm{ 8, CombGeneratorEngineType::ClosedForm };
+        bool threw = false;
+        try { closedForm.resetWithSegmentEnvelope( 8, M_PI / 64.0, nullptr, nullptr, std::ref( segmentEnvelope ) ); }
+        catch ( const std::invalid_argument & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a segment envelope functor for the ClosedForm engine." << std::endl;
+            return 6;
+        }
+
+        for ( auto engineType : { CombGeneratorEngineType::Automatic, CombGeneratorEngineType::InverseFft } )
+        {
+            CombGenerator combGenerator{ 8, engineType };
+            combGenerator.resetWithSegmentEnvelope( 8, M_PI / 64.0, nullptr, nullptr, std::ref( segmentEnvelope ) );
+            if ( CombGeneratorEngineType::FusedKernel != combGenerator.getActiveEngineType() )
+            {
+                std::cout << "Failed engine selection with a segment envelope functor." << std::endl;
+                return 6;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file testSinglePrecision.cpp
+ * @brief Test Harness for the Single Precision Sample Path
+ *
+ * Single precision output is compared against double precision output from a second CombGenerator
+ * instance, reset identically. The delta must be within the single precision tolerance documented by
+ * `CombGenerator::getSamples`, relative to the sum of the harmonic magnitudes. We run long enough, in
+ * irregular chunk sizes, to see any drift of the single precision phasors should re-anchoring fail.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <memory>
+#include <cmath>
+#include <iostream>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    int testAgainstDouble( CombGeneratorEngineType engineType, size_t numHarmonics, bool useEnvelope,
+                           bool accumulate, int failCode )
+    {
+        // Varied magnitudes and phases, slightly off any bin.
+        const double fundamentalRadiansPerSample = M_PI / double( 2 * numHarmonics + 3 ) * 1.0137;
+        std::unique_ptr< double[] > magnitudes{ new double[ numHarmonics ] };
+        std::unique_ptr< double[] > phases{ new double[ numHarmonics ] };
+        double sumOfMagnitudes = 0.0;
+        for ( size_t i = 0; numHarmonics != i; ++i )
+        {
+            magnitudes[i] = 1.0 / double( i + 1 );
+            phases[i] = std::fmod( double( i * i ) * 0.1, 2.0 * M_PI ) - M_PI;
+            sumOfMagnitudes += magnitudes[i];
+        }
+        CombGeneratorScalarVectorType sharedMagnitudes{ std::move( magnitudes ) };
+        CombGeneratorScalarVectorType sharedPhases{ std::move( phases ) };
+
+        // A slow amplitude modulation, identical for every harmonic and continuous across invocations.
+        constexpr size_t maxChunkSize = 1021;
+        std::unique_ptr< double[] > envelope{ new double[ maxChunkSize ] };
+        CombGeneratorEnvelopeFunkType envelopeFunk{};
+        if ( useEnvelope )
+        {
+            envelopeFunk = [ &envelope ]( size_t currentSample, size_t numSamples, size_t, double )
+            {
+                for ( size_t i = 0; numSamples != i; ++i )
+                    envelope[i] = 0.75 + 0.25 * std::cos( 1e-3 * double( currentSample + i ) );
+                return static_cast< const double * >( envelope.get() );
+            };
+        }
+
+        CombGenerator doubleGenerator{ numHarmonics, engineType };
+        CombGenerator singleGenerator{ numHarmonics, engineType };
+        doubleGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases, envelopeFunk );
+        singleGenerator.reset( numHarmonics, fundamentalRadiansPerSample, sharedMagnitudes, sharedPhases, envelopeFunk );
+
+        // Produce samples in irregular chunk sizes, onto a DC bias when accumulating.
+        std::unique_ptr< FlyingPhasorElementType[] > doubleBuffer{ new FlyingPhasorElementType[ maxChunkSize ] };
+        std::unique_ptr< CombGeneratorSingleElementType[] > singleBuffer{ new CombGeneratorSingleElementType[ maxChunkSize ] };
+        constexpr size_t totalSamples = size_t( 1 ) << 18;
+        size_t sampleCount = 0;
+        for ( size_t chunk = 0; totalSamples > sampleCount; ++chunk )
+        {
+            const size_t chunkSize = 1 + ( chunk * 337 ) % maxChunkSize;
+            if ( accumulate )
+            {
+                for ( size_t i = 0; chunkSize != i; ++i )
+                {
+                    doubleBuffer[i] = FlyingPhasorElementType{ 1.0, 0.0 };
+                    singleBuffer[i] = CombGeneratorSingleElementType{ 1.0F, 0.0F };
+                }
+                doubleGenerator.accumSamples( doubleBuffer.get(), chunkSize );
+                singleGenerator.accumSamples( singleBuffer.get(), chunkSize );
+            }
+            else
+            {
+                doubleGenerator.getSamples( doubleBuffer.get(), chunkSize );
+                singleGenerator.getSamples( singleBuffer.get(), chunkSize );
+            }
+
+            for ( size_t i = 0; chunkSize != i; ++i )
+            {
+                const FlyingPhasorElementType single{ singleBuffer[i].real(), singleBuffer[i].imag() };
+                const auto delta = std::abs( doubleBuffer[i] - single );
+                if ( singlePrecisionTolerance * sumOfMagnitudes < delta )
+                {
+                    std::cout << "Failed Single Precision Test at sample index " << sampleCount + i
+                              << " with a delta of " << delta << "." << std::endl;
+                    return failCode;
+                }
+            }
+            sampleCount += chunkSize;
+        }
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - Native single precision synthesis by the fused kernel engine, `getSamples`.
+    int testResult = testAgainstDouble( CombGeneratorEngineType::FusedKernel, 37, false, false, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - Native single precision synthesis by the fused kernel engine, `accumSamples`.
+    testResult = testAgainstDouble( CombGeneratorEngineType::FusedKernel, 37, false, true, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - The fused kernel engine with an envelope functor converts from double precision.
+    testResult = testAgainstDouble( CombGeneratorEngineType::FusedKernel, 37, true, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - The phasor bank engine converts from double precision.
+    testResult = testAgainstDouble( CombGeneratorEngineType::PhasorBank, 5, false, false, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - The inverse FFT engine delivers single precision directly from its blocks.
+    testResult = testAgainstDouble( CombGeneratorEngineType::InverseFft, 600, false, true, 5 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 6 - No harmonics yields zeros for `getSamples` and leaves `accumSamples` buffers untouched.
+    {
+        CombGenerator combGenerator{ 4 };
+        constexpr size_t numSamples = 100;
+        std::unique_ptr< CombGeneratorSingleElementType[] > singleBuffer{ new CombGeneratorSingleElementType[ numSamples ] };
+        for ( size_t i = 0; numSamples != i; ++i )
+            singleBuffer[i] = CombGeneratorSingleElementType{ 1.0F, 1.0F };
+        combGenerator.accumSamples( singleBuffer.get(), numSamples );
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( CombGeneratorSingleElementType{ 1.0F, 1.0F } != singleBuffer[i] )
+            {
+                std::cout << "Failed to leave the buffer untouched accumulating no harmonics." << std::endl;
+                return 6;
+            }
+        }
+        combGenerator.getSamples( singleBuffer.get(), numSamples );
+        for ( size_t i = 0; numSamples != i; ++i )
+        {
+            if ( CombGeneratorSingleElementType{} != singleBuffer[i] )
+            {
+                std::cout << "Failed to produce zeros for no harmonics." << std::endl;
+                return 6;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file testToneBank.cpp
+ * @brief Test Harness for Tone Banks at Arbitrary Rates
+ *
+ * Output of a CombGenerator reset with stretched partials, or with an offset comb, must follow each tone at its own
+ * rate from its starting phase, as the tones summed directly do. An offset comb with a zero offset must be bit
+ * identical to the harmonic series it describes.
+ * We also verify envelope functors, harmonic partitioned synthesis, seeking, cloning and the engines and operations
+ * which reject tone banks.
+ *
+ * @authors Frank Reiser
+ * @date Initiated October 16th, 2026
+ */
+
+#include "CombGenerator.h"
+#include "HarmonicSeriesFixture.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ReiserRT::Signal;
+using namespace HarmonicSeriesFixture;
+
+namespace
+{
+    constexpr size_t numTones = 19;
+    constexpr size_t numSamples = 3000;
+
+    // Stretched partials, each slightly sharp of the harmonic it would be.
+    CombGeneratorScalarVectorType makeStretchedRates( double fundamentalRadiansPerSample )
+    {
+        std::unique_ptr< double[] > rates{ new double[ numTones ] };
+        for ( size_t i = 0; numTones != i; ++i )
+            rates[i] = fundamentalRadiansPerSample * std::pow( double( i + 1 ), 1.02 );
+        return CombGeneratorScalarVectorType{ std::move( rates ) };
+    }
+
+    bool compareToTones( const FlyingPhasorElementType * pSamples, size_t firstSample, size_t count,
+                         const CombGeneratorScalarVectorType & rates, const CombGeneratorScalarVectorType & mags,
+                         const CombGeneratorScalarVectorType & phases, const char * pTestName )
+    {
+        return compareToExpected( pSamples, firstSample, count,
+                                  [ & ]( size_t sampleIndex )
+                                  {
+                                      return directSample( numTones, rates, mags, phases, sampleIndex );
+                                  },
+                                  directSumTolerance * sumOf( mags, numTones ), pTestName );
+    }
+
+    // An offset comb with no offset is the harmonic series of its spacing.
+    int testZeroOffset( CombGeneratorEngineType engineType, int failCode )
+    {
+        const auto mags = makeVector( numTones, 1.0, 0.0 );
+        const auto phases = makeVector( numTones, 2.0, -1.0 );
+        const double spacingRadiansPerSample = M_PI / 64.0 * 1.0137;
+
+        CombGenerator harmonicGenerator{ numTones, engineType };
+        harmonicGenerator.reset( numTones, spacingRadiansPerSample, mags, phases );
+        CombGenerator offsetGenerator{ numTones, engineType };
+        offsetGenerator.reset( numTones, 0.0, spacingRadiansPerSample, mags, phases );
+
+        std::unique_ptr< FlyingPhasorElementType[] > harmonicBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        std::unique_ptr< FlyingPhasorElementType[] > offsetBuffer{ new FlyingPhasorElementType[ numSamples ] };
+        harmonicGenerator.getSamples( harmonicBuffer.get(), numSamples );
+        offsetGenerator.getSamples( offsetBuffer.get(), numSamples );
+        for ( size_t n = 0; numSamples != n; ++n )
+        {
+            if ( harmonicBuffer[n] != offsetBuffer[n] )
+            {
+                std::cout << "Failed Zero Offset Test at sample index " << n << "." << std::endl;
+                return failCode;
+            }
+        }
+
+        return 0;
+    }
+
+    // Stretched partials, in irregular chunks, with an optional envelope functor of unity.
+    int testToneBank( CombGeneratorEngineType engineType, size_t numThreads, bool enveloped, int failCode )
+    {
+        const auto rates = makeStretchedRates( 0.0123 );
+        const auto mags = makeVector( numTones, 1.0, 0.0 );
+        const auto phases = makeVector( numTones, 2.0, -1.0 );
+
+        std::vector< std::vector< double > > envelopes( numTones, std::vector< double >( numSamples ) );
+        auto envelopeFunk = [ &envelopes ]( size_t, size_t blockSamples, size_t nTone, double magnitude )
+        {
+            auto & envelope = envelopes[ nTone ];
+            for ( size_t n = 0; blockSamples != n; ++n )
+                envelope[n] = magnitude;
+            return static_cast< const double * >( envelope.data() );
+        };
+
+        CombGenerator combGenerator{ numTones, engineType, numThreads, 100 };
+        combGenerator.reset( numTones, rates, mags, phases, enveloped ? CombGeneratorEnvelopeFunkType{ envelopeFunk }
+                                                                    : CombGeneratorEnvelopeFunkType{} );
+
+        std::unique_ptr< FlyingPhasorElementType[] > buffer{ new FlyingPhasorElementType[ numSamples ] };
+        size_t offset = 0;
+        for ( size_t chunkSize : { size_t( 1 ), size_t( 777 ), size_t( 100 ), size_t( 2122 ) } )
+        {
+            combGenerator.getSamples( buffer.get() + offset, chunkSize );
+            offset += chunkSize;
+        }
+
+        if ( !compareToTones( buffer.get(), 0, numSamples, rates, mags, phases, "Tone Bank Test" ) )
+            return failCode;
+
+        return 0;
+    }
+}
+
+int main()
+{
+    // Test 1 - A zero offset comb is bit identical to the harmonic series.
+    int testResult = testZeroOffset( CombGeneratorEngineType::PhasorBank, 1 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testZeroOffset( CombGeneratorEngineType::FusedKernel, 1 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 2 - Stretched partials.
+    testResult = testToneBank( CombGeneratorEngineType::PhasorBank, 1, false, 2 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testToneBank( CombGeneratorEngineType::Automatic, 1, false, 2 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 3 - Stretched partials with an envelope functor.
+    testResult = testToneBank( CombGeneratorEngineType::PhasorBank, 1, true, 3 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testToneBank( CombGeneratorEngineType::FusedKernel, 1, true, 3 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 4 - Harmonic partitioned synthesis.
+    testResult = testToneBank( CombGeneratorEngineType::PhasorBank, 3, false, 4 );
+    if ( 0 != testResult ) return testResult;
+    testResult = testToneBank( CombGeneratorEngineType::InverseFft, 3, false, 4 );
+    if ( 0 != testResult ) return testResult;
+
+    // Test 5 - An offset comb, seeking and cloning.
+    for ( auto engineType : { CombGeneratorEngineType::PhasorBank, CombGeneratorEngineType::FusedKernel } )
+    {
+        constexpr double offsetRadiansPerSample = 0.0031;
+        constexpr double spacingRadiansPerSample = 0.0117;
+        std::unique_ptr< double[] > rateValues{ new double[ numTones ] };
+        for ( size_t i = 0; numTones != i; ++i )
+            rateValues[i] = offsetRadiansPerSample + double( i + 1 ) * spacingRadiansPerSample;
+        const CombGeneratorScalarVectorType rates{ std::move( rateValues ) };
+        const auto mags = makeVector( numTones, 1.0, 0.5 );
+        const auto phases = makeVector( numTones, -2.0, 1.0 );
+
+        CombGenerator combGenerator{ numTones, engineType };
+        combGenerator.reset( numTones, offsetRadiansPerSample, spacingRadiansPerSample, mags, phases );
+        combGenerator.seekTo( 123456 );
+        FlyingPhasorElementType samples[ 100 ];
+        combGenerator.getSamples( samples, 100 );
+        if ( !compareToTones( samples, 123456, 100, rates, mags, phases, "Offset Comb Seek Test" ) )
+            return 5;
+
+        auto clonedGenerator = combGenerator.clone();
+        clonedGenerator.getSamples( samples, 100 );
+        if ( !compareToTones( samples, 123556, 100, rates, mags, phases, "Offset Comb Clone Test" ) )
+            return 5;
+    }
+
+    // Test 6 - Engines unable to take arbitrary rates reject tone banks, as do operations requiring a fundamental.
+    {
+        CombGenerator closedFormGenerator{ numTones, CombGeneratorEngineType::ClosedForm };
+        bool threw = false;
+        try { closedFormGenerator.reset( numTones, 0.001, 0.01, nullptr, nullptr ); }
+        catch ( const std::invalid_argument & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a tone bank for the ClosedForm engine." << std::endl;
+            return 6;
+        }
+
+        CombGenerator combGenerator{ numTones, CombGeneratorEngineType::FusedKernel };
+        threw = false;
+        try { combGenerator.reset( numTones, CombGeneratorScalarVectorType{}, nullptr, nullptr ); }
+        catch ( const std::invalid_argument & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject an empty rate vector." << std::endl;
+            return 6;
+        }
+
+        combGenerator.reset( numTones, 0.001, 0.01, nullptr, nullptr );
+        threw = false;
+        try { combGenerator.retune( 0.02 ); }
+        catch ( const std::logic_error & ) { threw = true; }
+        if ( !threw )
+        {
+            std::cout << "Failed to reject a retune of a tone bank." << std::endl;
+            return 6;
+        }
+    }
+
+    return 0;
+}